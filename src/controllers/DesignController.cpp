@@ -1,8 +1,10 @@
 #include "DesignController.h"
 #include "../utils/Logger.h"
 #include "../scene/SceneManager.h"
+#include "../scene/PartitionedSceneManager.h"
 #include <algorithm>
 #include <cmath>
+#include <limits>
 #include <set>
 
 namespace KitchenCAD {
@@ -18,38 +20,73 @@ DesignController::DesignController(std::unique_ptr<ISceneManager> sceneManager,
     , currentHistoryIndex_(0)
     , maxHistorySize_(100)
 {
+    connectSceneManager();
+}
+
+void DesignController::connectSceneManager() {
     // Set up scene manager callbacks
-    if (sceneManager_) {
-        sceneManager_->setObjectAddedCallback([this](const ObjectId& id) {
-            notifyObjectAdded(id);
-        });
-        
-        sceneManager_->setObjectRemovedCallback([this](const ObjectId& id) {
-            notifyObjectRemoved(id);
-        });
-        
-        sceneManager_->setObjectModifiedCallback([this](const ObjectId& id) {
-            notifyObjectModified(id);
-        });
-        
-        sceneManager_->setSelectionChangedCallback([this](const std::vector<ObjectId>& selection) {
-            selectedObjects_ = selection;
-            notifySelectionChanged();
-        });
+    if (!sceneManager_) return;
+    
+    sceneManager_->setChangeSetCallback([this](const SceneChangeSet& changes) {
+        notifyChanges(changes);
+    });
+    
+    sceneManager_->setSelectionChangedCallback([this](const std::vector<ObjectId>& selection) {
+        selectedObjects_ = selection;
+        notifySelectionChanged();
+    });
+    
+    if (!eventLoopPoster_) {
+        sceneManager_->setChangeFlushScheduler(nullptr);
+        return;
     }
+    
+    sceneManager_->setChangeFlushScheduler([this]() {
+        eventLoopPoster_([this]() {
+            if (sceneManager_) {
+                sceneManager_->flushChanges();
+            }
+        });
+    });
+}
+
+void DesignController::setEventLoopPoster(std::function<void(std::function<void()>)> post) {
+    eventLoopPoster_ = std::move(post);
+    connectSceneManager();
+}
+
+void DesignController::chooseSceneManagerFor(const Project& project) {
+    bool partitioned = dynamic_cast<Scene::PartitionedSceneManager*>(sceneManager_.get()) != nullptr;
+    bool single = dynamic_cast<Scene::SceneManager*>(sceneManager_.get()) != nullptr;
+    if (!partitioned && !single) return;
+    
+    // Large projects are partitioned so edits in one room do not wait on readers of another
+    bool wantPartitioned = project.getObjects().size() >= Scene::kPartitionedSceneObjectThreshold;
+    if (wantPartitioned == partitioned) return;
+    
+    LOG_INFO(std::string("Switching to a ") + (wantPartitioned ? "partitioned" : "single") + " scene for " +
+             std::to_string(project.getObjects().size()) + " objects");
+    sceneManager_ = Scene::createSceneManager(project.getObjects().size());
+    connectSceneManager();
 }
 
 void DesignController::setCurrentProject(Project* project) {
     currentProject_ = project;
     
+    if (sceneManager_ && project) {
+        chooseSceneManagerFor(*project);
+    }
+    
     if (sceneManager_) {
         sceneManager_->clear();
         
         // Load project objects into scene manager
         if (project) {
+            // One change set for the whole project rather than one event per object
+            SceneChangeBatch batch(*sceneManager_);
             for (const auto& object : project->getObjects()) {
-                // Create a copy for the scene manager
-                auto objectCopy = std::make_unique<SceneObject>(*object);
+                // Create a copy for the scene manager, allocated from the project's pool
+                auto objectCopy = project->createObject(*object);
                 sceneManager_->addObject(std::move(objectCopy));
             }
         }
@@ -82,7 +119,7 @@ std::string DesignController::addObjectFromCatalog(const std::string& catalogIte
     }
     
     // Create scene object
-    auto sceneObject = std::make_unique<SceneObject>(catalogItemId);
+    auto sceneObject = currentProject_->createObject(catalogItemId);
     sceneObject->setTransform(snappedTransform);
     
     // Record operation for undo
@@ -90,7 +127,7 @@ std::string DesignController::addObjectFromCatalog(const std::string& catalogIte
     record.afterState = sceneObject->toJson();
     
     // Add to project and scene
-    std::string objectId = currentProject_->addObject(std::make_unique<SceneObject>(*sceneObject));
+    std::string objectId = currentProject_->addObject(currentProject_->createObject(*sceneObject));
     sceneManager_->addObject(std::move(sceneObject));
     
     recordOperation(record);
@@ -156,6 +193,9 @@ bool DesignController::translateObject(const std::string& objectId, const Vector
     // Apply snapping
     newTransform.translation = applySnapping(newTransform.translation);
     
+    // Stop at the first object in the way, so fast drags cannot tunnel through walls or units
+    newTransform = sceneManager_->checkSweptCollision(objectId, object->getTransform(), newTransform).transform;
+    
     // Validate new position
     if (!validateOperation(objectId, newTransform)) {
         notifyError("Invalid position for object");
@@ -297,7 +337,7 @@ std::string DesignController::duplicateObject(const std::string& objectId, const
     }
     
     // Create duplicate with offset
-    auto duplicate = std::make_unique<SceneObject>(*originalObject);
+    auto duplicate = currentProject_->createObject(*originalObject);
     Transform3D newTransform = duplicate->getTransform();
     newTransform.translation = newTransform.translation + offset;
     newTransform.translation = applySnapping(newTransform.translation);
@@ -310,7 +350,7 @@ std::string DesignController::duplicateObject(const std::string& objectId, const
     }
     
     // Add to project and scene
-    std::string newObjectId = currentProject_->addObject(std::make_unique<SceneObject>(*duplicate));
+    std::string newObjectId = currentProject_->addObject(currentProject_->createObject(*duplicate));
     sceneManager_->addObject(std::move(duplicate));
     
     // Record operation for undo
@@ -574,12 +614,14 @@ Point3D DesignController::snapToObjects(const Point3D& point) const {
     Point3D closestPoint = point;
     double minDistance = snapDistance;
     
-    // Check all objects for snap points
-    sceneManager_->forEachObject([&](const ObjectId& id, const SceneObject* object) {
+    // An object's snap point lies within its bounds, so only objects whose
+    // bounds are within snap distance can qualify. The nearest bounds need not
+    // hold the nearest snap point, so every such object is ranked
+    const ISceneManager& scene = *sceneManager_;
+    for (const auto& id : scene.findNearestObjects(point, std::numeric_limits<size_t>::max(), snapDistance)) {
+        const SceneObject* object = scene.getObject(id);
         if (object) {
-            // Get object bounds and check corners/edges for snapping
-            Transform3D transform = object->getTransform();
-            Point3D objectPos = transform.translation;
+            Point3D objectPos = object->getTransform().translation;
             
             double distance = point.distanceTo(objectPos);
             if (distance < minDistance) {
@@ -587,7 +629,7 @@ Point3D DesignController::snapToObjects(const Point3D& point) const {
                 closestPoint = objectPos;
             }
         }
-    });
+    }
     
     return closestPoint;
 }
@@ -627,13 +669,7 @@ std::vector<ValidationError> DesignController::validateObjectPlacement(const std
     SceneObject tempObject(*object);
     tempObject.setTransform(transform);
     
-    // Cast ISceneManager to concrete SceneManager for validation
-    auto* concreteSceneManager = dynamic_cast<const SceneManager*>(sceneManager_.get());
-    if (!concreteSceneManager) {
-        return {}; // Return empty validation errors if cast fails
-    }
-    
-    ValidationContext context(concreteSceneManager, currentProject_);
+    ValidationContext context(sceneManager_.get(), currentProject_);
     return validationService_->validateObject(tempObject, context);
 }
 
@@ -646,13 +682,7 @@ bool DesignController::isValidPosition(const std::string& catalogItemId, const T
     SceneObject tempObject(catalogItemId);
     tempObject.setTransform(transform);
     
-    // Cast ISceneManager to concrete SceneManager for validation
-    auto* concreteSceneManager = dynamic_cast<const SceneManager*>(sceneManager_.get());
-    if (!concreteSceneManager) {
-        return true; // Assume valid if cast fails
-    }
-    
-    ValidationContext context(concreteSceneManager, currentProject_);
+    ValidationContext context(sceneManager_.get(), currentProject_);
     auto errors = validationService_->validatePlacement(tempObject, transform, context);
     
     // Check if there are any critical errors
@@ -681,7 +711,7 @@ bool DesignController::undo() {
         case DesignOperation::RemoveObject:
             // Recreate object from beforeState
             if (!record.beforeState.empty()) {
-                auto object = std::make_unique<SceneObject>();
+                auto object = currentProject_->createObject();
                 object->fromJson(record.beforeState);
                 currentProject_->addObject(std::move(object));
                 success = true;
@@ -724,7 +754,7 @@ bool DesignController::redo() {
         case DesignOperation::AddObject:
             // Recreate object from afterState
             if (!record.afterState.empty()) {
-                auto object = std::make_unique<SceneObject>();
+                auto object = currentProject_->createObject();
                 object->fromJson(record.afterState);
                 currentProject_->addObject(std::move(object));
                 success = true;
@@ -825,6 +855,8 @@ bool DesignController::alignObjects(AlignmentType alignment) {
     }
     
     BoundingBox bounds = getSelectionBounds();
+    std::vector<ObjectTransform> transforms;
+    transforms.reserve(selectedObjects_.size());
     
     for (const auto& objectId : selectedObjects_) {
         SceneObject* object = currentProject_->getObject(objectId);
@@ -859,10 +891,13 @@ bool DesignController::alignObjects(AlignmentType alignment) {
             }
             
             object->setTransform(transform);
-            sceneManager_->moveObject(objectId, transform);
+            transforms.emplace_back(objectId, transform);
         }
     }
     
+    // One batched move instead of a lock, index update and event per object
+    sceneManager_->applyTransforms(transforms);
+    
     return true;
 }
 
@@ -904,6 +939,9 @@ bool DesignController::distributeObjects(DistributionType distribution) {
     double spacing = totalDistance / (sortedObjects.size() - 1);
     
     // Distribute objects
+    std::vector<ObjectTransform> transforms;
+    transforms.reserve(sortedObjects.size());
+    
     for (size_t i = 1; i < sortedObjects.size() - 1; ++i) {
         SceneObject* object = currentProject_->getObject(sortedObjects[i].first);
         if (object) {
@@ -923,10 +961,12 @@ bool DesignController::distributeObjects(DistributionType distribution) {
             }
             
             object->setTransform(transform);
-            sceneManager_->moveObject(sortedObjects[i].first, transform);
+            transforms.emplace_back(sortedObjects[i].first, transform);
         }
     }
     
+    sceneManager_->applyTransforms(transforms);
+    
     return true;
 }
 
@@ -962,6 +1002,34 @@ void DesignController::notifyObjectModified(const std::string& objectId) {
     }
 }
 
+void DesignController::notifyObjectsModified(const std::vector<std::string>& objectIds) {
+    if (objectsModifiedCallback_) {
+        objectsModifiedCallback_(objectIds);
+        return;
+    }
+    
+    for (const auto& objectId : objectIds) {
+        notifyObjectModified(objectId);
+    }
+}
+
+void DesignController::notifyChanges(const SceneChangeSet& changes) {
+    if (changesCallback_) {
+        changesCallback_(changes);
+        return;
+    }
+    
+    for (const auto& objectId : changes.removed) {
+        notifyObjectRemoved(objectId);
+    }
+    for (const auto& objectId : changes.added) {
+        notifyObjectAdded(objectId);
+    }
+    if (!changes.modified.empty()) {
+        notifyObjectsModified(changes.modified);
+    }
+}
+
 void DesignController::notifySelectionChanged() {
     if (selectionChangedCallback_) {
         selectionChangedCallback_(selectedObjects_);
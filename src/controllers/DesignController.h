@@ -92,9 +92,14 @@ private:
     std::function<void(const std::string&)> objectAddedCallback_;
     std::function<void(const std::string&)> objectRemovedCallback_;
     std::function<void(const std::string&)> objectModifiedCallback_;
+    std::function<void(const std::vector<std::string>&)> objectsModifiedCallback_;
+    std::function<void(const SceneChangeSet&)> changesCallback_;
     std::function<void(const std::vector<std::string>&)> selectionChangedCallback_;
     std::function<void(const std::vector<ValidationError>&)> validationCallback_;
     std::function<void(const std::string&)> errorCallback_;
+    
+    // Posts scene change flushes to the host's event loop; kept for replacement scenes
+    std::function<void(std::function<void()>)> eventLoopPoster_;
 
 public:
     /**
@@ -379,6 +384,32 @@ public:
         objectModifiedCallback_ = callback;
     }
     
+    /**
+     * @brief Set callback for multi-object edits such as align and distribute
+     */
+    void setObjectsModifiedCallback(std::function<void(const std::vector<std::string>&)> callback) {
+        objectsModifiedCallback_ = callback;
+    }
+    
+    /**
+     * @brief Set callback receiving scene changes as coalesced change sets
+     * 
+     * When set it replaces the added, removed and modified callbacks, so a
+     * panel can relayout once per bulk import or multi-object edit.
+     */
+    void setChangesCallback(std::function<void(const SceneChangeSet&)> callback) {
+        changesCallback_ = callback;
+    }
+    
+    /**
+     * @brief Deliver scene changes once per event loop iteration
+     * 
+     * Changes made outside a batch are collected until the posted task runs,
+     * so a burst of edits in one iteration reaches the views as one change set.
+     * @param post Runs a task on the next event loop iteration
+     */
+    void setEventLoopPoster(std::function<void(std::function<void()>)> post);
+    
     /**
      * @brief Set callback for selection changed events
      */
@@ -401,6 +432,19 @@ public:
     }
 
 private:
+    /**
+     * @brief Subscribe to the scene manager's changes and selection
+     */
+    void connectSceneManager();
+    
+    /**
+     * @brief Switch between the single and the partitioned scene to suit the project's size
+     * 
+     * Only the built-in scene managers are swapped; any other implementation
+     * passed to the constructor is kept.
+     */
+    void chooseSceneManagerFor(const Project& project);
+    
     /**
      * @brief Record operation for undo/redo
      */
@@ -412,6 +456,8 @@ private:
     void notifyObjectAdded(const std::string& objectId);
     void notifyObjectRemoved(const std::string& objectId);
     void notifyObjectModified(const std::string& objectId);
+    void notifyObjectsModified(const std::vector<std::string>& objectIds);
+    void notifyChanges(const SceneChangeSet& changes);
     void notifySelectionChanged();
     void notifyValidation(const std::vector<ValidationError>& errors);
     void notifyError(const std::string& error);
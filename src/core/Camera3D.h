@@ -3,6 +3,7 @@
 #include "../geometry/Point3D.h"
 #include "../geometry/Vector3D.h"
 #include "../geometry/Matrix4x4.h"
+#include "../geometry/Geometry.h"
 #include <cmath>
 
 namespace KitchenCAD {
@@ -160,6 +161,11 @@ public:
         return getProjectionMatrix() * getViewMatrix();
     }
     
+    // View volume in world space, for culling against scene bounds
+    Geometry::Frustum getFrustum() const {
+        return Geometry::Frustum::fromMatrix(getViewProjectionMatrix());
+    }
+    
     // Ray casting
     struct Ray {
         Geometry::Point3D origin;
@@ -4,6 +4,8 @@
 #include "Vector3D.h"
 #include "Transform3D.h"
 #include <algorithm>
+#include <array>
+#include <cmath>
 #include <vector>
 #include <limits>
 
@@ -202,26 +204,41 @@ struct BoundingBox {
     
     // Transformation
     BoundingBox transformed(const Transform3D& transform) const {
+        return transformed(transform.toMatrix());
+    }
+    
+    /**
+     * @brief Box around this one after a matrix transform
+     * 
+     * For affine matrices the result comes straight from the centre and
+     * extents (each new half-extent is the absolute matrix applied to the old
+     * one), which matches transforming all eight corners without doing so.
+     */
+    BoundingBox transformed(const Matrix4x4& matrix) const {
         if (isEmpty()) return *this;
         
-        // Transform all 8 corners of the bounding box
-        std::vector<Point3D> corners = {
-            Point3D(min.x, min.y, min.z),
-            Point3D(max.x, min.y, min.z),
-            Point3D(min.x, max.y, min.z),
-            Point3D(max.x, max.y, min.z),
-            Point3D(min.x, min.y, max.z),
-            Point3D(max.x, min.y, max.z),
-            Point3D(min.x, max.y, max.z),
-            Point3D(max.x, max.y, max.z)
-        };
-        
-        BoundingBox result;
-        for (const auto& corner : corners) {
-            Point3D transformedCorner = transform.transformPoint(corner);
-            result.expand(transformedCorner);
+        if (!matrix.isAffine()) {
+            std::array<Point3D, 8> corners = {
+                Point3D(min.x, min.y, min.z),
+                Point3D(max.x, min.y, min.z),
+                Point3D(min.x, max.y, min.z),
+                Point3D(max.x, max.y, min.z),
+                Point3D(min.x, min.y, max.z),
+                Point3D(max.x, min.y, max.z),
+                Point3D(min.x, max.y, max.z),
+                Point3D(max.x, max.y, max.z)
+            };
+            matrix.transformPoints(corners);
+            
+            BoundingBox result;
+            for (const auto& corner : corners) {
+                result.expand(corner);
+            }
+            return result;
         }
         
+        BoundingBox result;
+        MatrixKernels::transformBounds(matrix.data(), this, &result, 1);
         return result;
     }
     
@@ -0,0 +1,119 @@
+#pragma once
+
+#include "Transform3D.h"
+#include "Matrix4x4.h"
+#include "BoundingBox.h"
+#include <span>
+
+namespace KitchenCAD {
+namespace Geometry {
+
+/**
+ * @brief Transform3D that keeps its world matrix between uses
+ * 
+ * Building a matrix from translation, rotation and scale costs six trig
+ * calls. This type builds it on first use after a change and hands out the
+ * stored one until translation, rotation or scale change again. Pure
+ * translations patch the stored matrix in place instead of invalidating it.
+ * 
+ * Like other geometry values it is not synchronized: a const read that
+ * finds the matrix stale rebuilds it, so call matrix() after modifying an
+ * instance that other threads will read.
+ */
+class CachedTransform3D {
+public:
+    CachedTransform3D() = default;
+    
+    CachedTransform3D(const Transform3D& transform)
+        : transform_(transform), dirty_(true) {}
+    
+    // Components
+    const Transform3D& get() const { return transform_; }
+    const Point3D& translation() const { return transform_.translation; }
+    const Vector3D& rotation() const { return transform_.rotation; }
+    const Vector3D& scale() const { return transform_.scale; }
+    
+    void set(const Transform3D& transform) {
+        transform_ = transform;
+        dirty_ = true;
+    }
+    
+    void setTranslation(const Point3D& translation) {
+        transform_.translation = translation;
+        if (!dirty_) {
+            matrix_(0, 3) = translation.x;
+            matrix_(1, 3) = translation.y;
+            matrix_(2, 3) = translation.z;
+        }
+    }
+    
+    void setRotation(const Vector3D& rotation) {
+        transform_.rotation = rotation;
+        dirty_ = true;
+    }
+    
+    void setScale(const Vector3D& scale) {
+        transform_.scale = scale;
+        dirty_ = true;
+    }
+    
+    void translate(const Vector3D& delta) {
+        setTranslation(transform_.translation + delta);
+    }
+    
+    void rotate(const Vector3D& deltaRotation) {
+        transform_.rotate(deltaRotation);
+        dirty_ = true;
+    }
+    
+    void scaleBy(const Vector3D& scaleFactors) {
+        transform_.scaleBy(scaleFactors);
+        dirty_ = true;
+    }
+    
+    bool isDirty() const { return dirty_; }
+    
+    /**
+     * @brief World matrix, rebuilt only if a component changed since the last call
+     */
+    const Matrix4x4& matrix() const {
+        if (dirty_) {
+            matrix_ = transform_.toMatrix();
+            dirty_ = false;
+        }
+        return matrix_;
+    }
+    
+    // Transform points, vectors and boxes with the cached matrix
+    Point3D transformPoint(const Point3D& point) const {
+        return matrix().transformPoint(point);
+    }
+    
+    Vector3D transformVector(const Vector3D& vector) const {
+        return matrix().transformVector(vector);
+    }
+    
+    void transformPoints(std::span<Point3D> points) const {
+        matrix().transformPoints(points);
+    }
+    
+    BoundingBox transformBounds(const BoundingBox& box) const {
+        return box.transformed(matrix());
+    }
+    
+    bool operator==(const CachedTransform3D& other) const {
+        return transform_ == other.transform_;
+    }
+    
+    bool operator!=(const CachedTransform3D& other) const {
+        return !(*this == other);
+    }
+
+private:
+    Transform3D transform_;
+    mutable Matrix4x4 matrix_;      // Identity matches the default transform
+    mutable bool dirty_ = false;
+};
+
+} // namespace Geometry
+} // namespace KitchenCAD
\ No newline at end of file
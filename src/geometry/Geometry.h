@@ -13,11 +13,16 @@
 #include "Vector3D.h"
 #include "Matrix4x4.h"
 #include "Transform3D.h"
+#include "CachedTransform3D.h"
 #include "BoundingBox.h"
+#include "OrientedBoundingBox.h"
 
 // Utility classes
 #include "GeometryUtils.h"
 
+#include <array>
+#include <cmath>
+
 namespace KitchenCAD {
 namespace Geometry {
 
@@ -152,6 +157,120 @@ struct Ray {
     }
 };
 
+/**
+ * @brief Plane in the form normal . p + distance = 0
+ */
+struct Plane {
+    Vector3D normal;
+    double distance;
+    
+    Plane() : normal(0, 0, 1), distance(0.0) {}
+    Plane(const Vector3D& normal, double distance) : normal(normal), distance(distance) {}
+    Plane(const Vector3D& normal, const Point3D& point)
+        : normal(normal), distance(-(normal.x * point.x + normal.y * point.y + normal.z * point.z)) {}
+    
+    double signedDistance(const Point3D& point) const {
+        return normal.x * point.x + normal.y * point.y + normal.z * point.z + distance;
+    }
+    
+    Plane normalized() const {
+        double length = normal.length();
+        return length > 0.0 ? Plane(normal / length, distance / length) : *this;
+    }
+};
+
+/**
+ * @brief View volume bounded by six inward-facing planes
+ */
+struct Frustum {
+    enum PlaneIndex { Left = 0, Right, Bottom, Top, Near, Far };
+    
+    std::array<Plane, 6> planes;
+    
+    Frustum() = default;
+    explicit Frustum(const std::array<Plane, 6>& planes) : planes(planes) {}
+    
+    /**
+     * @brief Extract the planes of an OpenGL-style view-projection matrix
+     */
+    static Frustum fromMatrix(const Matrix4x4& viewProjection) {
+        auto row = [&](int r) {
+            return std::array<double, 4>{viewProjection(r, 0), viewProjection(r, 1),
+                                         viewProjection(r, 2), viewProjection(r, 3)};
+        };
+        auto combine = [](const std::array<double, 4>& a, const std::array<double, 4>& b, double sign) {
+            return Plane(Vector3D(a[0] + sign * b[0], a[1] + sign * b[1], a[2] + sign * b[2]),
+                         a[3] + sign * b[3]).normalized();
+        };
+        
+        auto w = row(3);
+        Frustum frustum;
+        frustum.planes[Left] = combine(w, row(0), 1.0);
+        frustum.planes[Right] = combine(w, row(0), -1.0);
+        frustum.planes[Bottom] = combine(w, row(1), 1.0);
+        frustum.planes[Top] = combine(w, row(1), -1.0);
+        frustum.planes[Near] = combine(w, row(2), 1.0);
+        frustum.planes[Far] = combine(w, row(2), -1.0);
+        return frustum;
+    }
+    
+    /**
+     * @brief Conservative box test: false only if the box is fully outside one plane
+     */
+    bool intersects(const BoundingBox& bbox) const {
+        if (bbox.isEmpty()) return false;
+        
+        for (const auto& plane : planes) {
+            // Corner furthest along the plane normal
+            Point3D positive(plane.normal.x >= 0.0 ? bbox.max.x : bbox.min.x,
+                             plane.normal.y >= 0.0 ? bbox.max.y : bbox.min.y,
+                             plane.normal.z >= 0.0 ? bbox.max.z : bbox.min.z);
+            if (plane.signedDistance(positive) < 0.0) {
+                return false;
+            }
+        }
+        
+        return true;
+    }
+    
+    bool contains(const Point3D& point) const {
+        for (const auto& plane : planes) {
+            if (plane.signedDistance(point) < 0.0) return false;
+        }
+        return true;
+    }
+    
+    /**
+     * @brief Box around the eight corners; unbounded if the planes do not close a volume
+     */
+    BoundingBox bounds() const {
+        const double inf = std::numeric_limits<double>::infinity();
+        BoundingBox result;
+        
+        for (int nearFar : {Near, Far}) {
+            for (int leftRight : {Left, Right}) {
+                for (int bottomTop : {Bottom, Top}) {
+                    const Plane& a = planes[nearFar];
+                    const Plane& b = planes[leftRight];
+                    const Plane& c = planes[bottomTop];
+                    
+                    Vector3D bc = b.normal.cross(c.normal);
+                    double det = a.normal.dot(bc);
+                    if (std::abs(det) < 1e-12) {
+                        return BoundingBox(Point3D(-inf, -inf, -inf), Point3D(inf, inf, inf));
+                    }
+                    
+                    Vector3D corner = (bc * a.distance + c.normal.cross(a.normal) * b.distance +
+                                       a.normal.cross(b.normal) * c.distance) / -det;
+                    result.expand(Point3D(corner.x, corner.y, corner.z));
+                }
+            }
+        }
+        
+        return result;
+    }
+};
+
 /**
  * @brief Utility functions for common geometric operations
  */
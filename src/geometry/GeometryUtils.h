@@ -4,6 +4,7 @@
 #include "Vector3D.h"
 #include "Transform3D.h"
 #include "BoundingBox.h"
+#include "MatrixKernels.h"
 #include <vector>
 #include <cmath>
 
@@ -228,6 +229,16 @@ public:
         return bbox.transformed(transform);
     }
     
+    /**
+     * @brief Transform many boxes by one transform, building its matrix once
+     */
+    static std::vector<BoundingBox> transformBoundingBoxes(const std::vector<BoundingBox>& boxes,
+                                                           const Transform3D& transform) {
+        std::vector<BoundingBox> result(boxes.size());
+        MatrixKernels::transformBounds(transform.toMatrix().data(), boxes.data(), result.data(), boxes.size());
+        return result;
+    }
+    
     static std::vector<BoundingBox> subdivideBoundingBox(const BoundingBox& bbox, int subdivisions) {
         std::vector<BoundingBox> result;
         
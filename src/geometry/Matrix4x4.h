@@ -2,8 +2,10 @@
 
 #include "Point3D.h"
 #include "Vector3D.h"
+#include "MatrixKernels.h"
 #include <array>
 #include <cmath>
+#include <span>
 
 namespace KitchenCAD {
 namespace Geometry {
@@ -38,17 +40,9 @@ public:
     
     // Matrix operations
     Matrix4x4 operator*(const Matrix4x4& other) const {
-        Matrix4x4 result;
-        for (int i = 0; i < 4; ++i) {
-            for (int j = 0; j < 4; ++j) {
-                double sum = 0.0;
-                for (int k = 0; k < 4; ++k) {
-                    sum += (*this)(i, k) * other(k, j);
-                }
-                result(i, j) = sum;
-            }
-        }
-        return result;
+        std::array<double, 16> result;
+        MatrixKernels::multiply(data(), other.data(), result.data());
+        return Matrix4x4(result);
     }
     
     Matrix4x4& operator*=(const Matrix4x4& other) {
@@ -77,6 +71,31 @@ public:
         return Vector3D(x, y, z);
     }
     
+    /**
+     * @brief Transform points in place (w = 1)
+     * 
+     * Reads the matrix once for the whole batch and skips the perspective
+     * divide when the bottom row is (0, 0, 0, 1), as for every placement
+     * transform. Affine batches run on the widest SIMD kernel available.
+     */
+    void transformPoints(std::span<Point3D> points) const {
+        if (!isAffine()) {
+            for (auto& point : points) {
+                point = transformPoint(point);
+            }
+            return;
+        }
+        
+        MatrixKernels::transformPoints(data(), points.data(), points.size());
+    }
+    
+    /**
+     * @brief Whether the bottom row is (0, 0, 0, 1), i.e. no projection
+     */
+    bool isAffine() const {
+        return (*this)(3, 0) == 0.0 && (*this)(3, 1) == 0.0 && (*this)(3, 2) == 0.0 && (*this)(3, 3) == 1.0;
+    }
+    
     // Matrix utilities
     void setIdentity() {
         data_.fill(0.0);
@@ -106,20 +125,13 @@ public:
     }
     
     Matrix4x4 inverse() const {
-        double det = determinant();
-        if (std::abs(det) < 1e-9) {
+        std::array<double, 16> result;
+        if (!MatrixKernels::inverse(data(), result.data(), 1e-9)) {
             // Return identity if matrix is not invertible
             Matrix4x4 identity;
             return identity;
         }
-        
-        Matrix4x4 result;
-        for (int i = 0; i < 4; ++i) {
-            for (int j = 0; j < 4; ++j) {
-                result(j, i) = cofactor(i, j) / det;  // Transposed cofactor matrix
-            }
-        }
-        return result;
+        return Matrix4x4(result);
     }
     
     // Static factory methods
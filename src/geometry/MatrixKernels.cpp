@@ -0,0 +1,533 @@
+#include "MatrixKernels.h"
+#include "BoundingBox.h"
+#include <atomic>
+#include <cmath>
+
+#if defined(__x86_64__) || defined(_M_X64) || defined(__i386__) || defined(_M_IX86)
+#define KITCHENCAD_MATRIX_X86 1
+#include <immintrin.h>
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+#endif
+
+#if defined(KITCHENCAD_MATRIX_X86) && (defined(__GNUC__) || defined(__clang__))
+#define KITCHENCAD_TARGET(isa) __attribute__((target(isa)))
+#else
+#define KITCHENCAD_TARGET(isa)
+#endif
+
+namespace KitchenCAD {
+namespace Geometry {
+
+namespace {
+
+// Kernels store x, y and z with one two-lane and one single-lane write
+static_assert(sizeof(Point3D) == 3 * sizeof(double), "Point3D must be three packed doubles");
+
+// Element (row, col) of a column-major matrix
+inline double at(const double* m, int row, int col) {
+    return m[col * 4 + row];
+}
+
+/**
+ * @brief 2x2 minors of the top two rows (s) and bottom two rows (c), and the determinant
+ */
+struct Minors {
+    double s[6];
+    double c[6];
+    double determinant;
+};
+
+Minors computeMinors(const double* m) {
+    Minors minors;
+    minors.s[0] = at(m, 0, 0) * at(m, 1, 1) - at(m, 1, 0) * at(m, 0, 1);
+    minors.s[1] = at(m, 0, 0) * at(m, 1, 2) - at(m, 1, 0) * at(m, 0, 2);
+    minors.s[2] = at(m, 0, 0) * at(m, 1, 3) - at(m, 1, 0) * at(m, 0, 3);
+    minors.s[3] = at(m, 0, 1) * at(m, 1, 2) - at(m, 1, 1) * at(m, 0, 2);
+    minors.s[4] = at(m, 0, 1) * at(m, 1, 3) - at(m, 1, 1) * at(m, 0, 3);
+    minors.s[5] = at(m, 0, 2) * at(m, 1, 3) - at(m, 1, 2) * at(m, 0, 3);
+    
+    minors.c[0] = at(m, 2, 0) * at(m, 3, 1) - at(m, 3, 0) * at(m, 2, 1);
+    minors.c[1] = at(m, 2, 0) * at(m, 3, 2) - at(m, 3, 0) * at(m, 2, 2);
+    minors.c[2] = at(m, 2, 0) * at(m, 3, 3) - at(m, 3, 0) * at(m, 2, 3);
+    minors.c[3] = at(m, 2, 1) * at(m, 3, 2) - at(m, 3, 1) * at(m, 2, 2);
+    minors.c[4] = at(m, 2, 1) * at(m, 3, 3) - at(m, 3, 1) * at(m, 2, 3);
+    minors.c[5] = at(m, 2, 2) * at(m, 3, 3) - at(m, 3, 2) * at(m, 2, 3);
+    
+    minors.determinant = minors.s[0] * minors.c[5] - minors.s[1] * minors.c[4] + minors.s[2] * minors.c[3] +
+                         minors.s[3] * minors.c[2] - minors.s[4] * minors.c[1] + minors.s[5] * minors.c[0];
+    return minors;
+}
+
+void multiplyScalar(const double* a, const double* b, double* result) {
+    double product[16];
+    for (int col = 0; col < 4; ++col) {
+        for (int row = 0; row < 4; ++row) {
+            product[col * 4 + row] = at(a, row, 0) * at(b, 0, col) + at(a, row, 1) * at(b, 1, col) +
+                                     at(a, row, 2) * at(b, 2, col) + at(a, row, 3) * at(b, 3, col);
+        }
+    }
+    for (int i = 0; i < 16; ++i) {
+        result[i] = product[i];
+    }
+}
+
+/**
+ * @brief One adjugate entry, x - y + z, negated for odd positions
+ * 
+ * Written as sign * ((x - y) + z) so the vector kernels, which flip the sign
+ * last, produce the same bits.
+ */
+inline double cofactorTerm(double x, double y, double z, bool negate) {
+    double value = (x - y) + z;
+    return negate ? -value : value;
+}
+
+void inverseScalar(const double* m, const Minors& minors, double* result) {
+    const double* s = minors.s;
+    const double* c = minors.c;
+    const double invDet = 1.0 / minors.determinant;
+    
+    // Row r of the adjugate for columns 0 and 1 uses the c minors, columns 2 and 3 the s minors
+    double adjugate[4][4] = {
+        {cofactorTerm(at(m, 1, 1) * c[5], at(m, 1, 2) * c[4], at(m, 1, 3) * c[3], false),
+         cofactorTerm(at(m, 0, 1) * c[5], at(m, 0, 2) * c[4], at(m, 0, 3) * c[3], true),
+         cofactorTerm(at(m, 3, 1) * s[5], at(m, 3, 2) * s[4], at(m, 3, 3) * s[3], false),
+         cofactorTerm(at(m, 2, 1) * s[5], at(m, 2, 2) * s[4], at(m, 2, 3) * s[3], true)},
+        {cofactorTerm(at(m, 1, 0) * c[5], at(m, 1, 2) * c[2], at(m, 1, 3) * c[1], true),
+         cofactorTerm(at(m, 0, 0) * c[5], at(m, 0, 2) * c[2], at(m, 0, 3) * c[1], false),
+         cofactorTerm(at(m, 3, 0) * s[5], at(m, 3, 2) * s[2], at(m, 3, 3) * s[1], true),
+         cofactorTerm(at(m, 2, 0) * s[5], at(m, 2, 2) * s[2], at(m, 2, 3) * s[1], false)},
+        {cofactorTerm(at(m, 1, 0) * c[4], at(m, 1, 1) * c[2], at(m, 1, 3) * c[0], false),
+         cofactorTerm(at(m, 0, 0) * c[4], at(m, 0, 1) * c[2], at(m, 0, 3) * c[0], true),
+         cofactorTerm(at(m, 3, 0) * s[4], at(m, 3, 1) * s[2], at(m, 3, 3) * s[0], false),
+         cofactorTerm(at(m, 2, 0) * s[4], at(m, 2, 1) * s[2], at(m, 2, 3) * s[0], true)},
+        {cofactorTerm(at(m, 1, 0) * c[3], at(m, 1, 1) * c[1], at(m, 1, 2) * c[0], true),
+         cofactorTerm(at(m, 0, 0) * c[3], at(m, 0, 1) * c[1], at(m, 0, 2) * c[0], false),
+         cofactorTerm(at(m, 3, 0) * s[3], at(m, 3, 1) * s[1], at(m, 3, 2) * s[0], true),
+         cofactorTerm(at(m, 2, 0) * s[3], at(m, 2, 1) * s[1], at(m, 2, 2) * s[0], false)}
+    };
+    
+    for (int row = 0; row < 4; ++row) {
+        for (int col = 0; col < 4; ++col) {
+            result[col * 4 + row] = adjugate[row][col] * invDet;
+        }
+    }
+}
+
+void transformPointsScalar(const double* m, Point3D* points, size_t count) {
+    for (size_t i = 0; i < count; ++i) {
+        const double x = points[i].x, y = points[i].y, z = points[i].z;
+        points[i].x = at(m, 0, 0) * x + at(m, 0, 1) * y + at(m, 0, 2) * z + at(m, 0, 3);
+        points[i].y = at(m, 1, 0) * x + at(m, 1, 1) * y + at(m, 1, 2) * z + at(m, 1, 3);
+        points[i].z = at(m, 2, 0) * x + at(m, 2, 1) * y + at(m, 2, 2) * z + at(m, 2, 3);
+    }
+}
+
+void transformBoundsScalar(const double* m, const BoundingBox* boxes, BoundingBox* result, size_t count) {
+    for (size_t i = 0; i < count; ++i) {
+        if (boxes[i].isEmpty()) {
+            result[i] = boxes[i];
+            continue;
+        }
+        
+        const Point3D center = boxes[i].center();
+        const Vector3D half = boxes[i].size() * 0.5;
+        
+        Point3D newCenter;
+        Point3D extent;
+        for (int k = 0; k < 3; ++k) {
+            newCenter[k] = at(m, k, 0) * center.x + at(m, k, 1) * center.y + at(m, k, 2) * center.z + at(m, k, 3);
+            extent[k] = std::abs(at(m, k, 0)) * half.x + std::abs(at(m, k, 1)) * half.y +
+                        std::abs(at(m, k, 2)) * half.z;
+        }
+        
+        for (int k = 0; k < 3; ++k) {
+            result[i].min[k] = newCenter[k] - extent[k];
+            result[i].max[k] = newCenter[k] + extent[k];
+        }
+    }
+}
+
+#ifdef KITCHENCAD_MATRIX_X86
+
+KITCHENCAD_TARGET("sse2")
+void multiplySSE(const double* a, const double* b, double* result) {
+    __m128d lo[4];
+    __m128d hi[4];
+    for (int k = 0; k < 4; ++k) {
+        lo[k] = _mm_loadu_pd(a + k * 4);
+        hi[k] = _mm_loadu_pd(a + k * 4 + 2);
+    }
+    
+    for (int col = 0; col < 4; ++col) {
+        __m128d b0 = _mm_set1_pd(b[col * 4]);
+        __m128d b1 = _mm_set1_pd(b[col * 4 + 1]);
+        __m128d b2 = _mm_set1_pd(b[col * 4 + 2]);
+        __m128d b3 = _mm_set1_pd(b[col * 4 + 3]);
+        
+        __m128d low = _mm_add_pd(_mm_add_pd(_mm_add_pd(_mm_mul_pd(lo[0], b0), _mm_mul_pd(lo[1], b1)),
+                                            _mm_mul_pd(lo[2], b2)), _mm_mul_pd(lo[3], b3));
+        __m128d high = _mm_add_pd(_mm_add_pd(_mm_add_pd(_mm_mul_pd(hi[0], b0), _mm_mul_pd(hi[1], b1)),
+                                             _mm_mul_pd(hi[2], b2)), _mm_mul_pd(hi[3], b3));
+        _mm_storeu_pd(result + col * 4, low);
+        _mm_storeu_pd(result + col * 4 + 2, high);
+    }
+}
+
+// Two adjugate entries, sign * ((x * kx - y * ky) + z * kz) as in cofactorTerm()
+KITCHENCAD_TARGET("sse2")
+inline __m128d adjugateHalf(__m128d x, __m128d y, __m128d z, double kx, double ky, double kz, __m128d sign) {
+    __m128d value = _mm_add_pd(_mm_sub_pd(_mm_mul_pd(x, _mm_set1_pd(kx)), _mm_mul_pd(y, _mm_set1_pd(ky))),
+                               _mm_mul_pd(z, _mm_set1_pd(kz)));
+    return _mm_xor_pd(value, sign);
+}
+
+KITCHENCAD_TARGET("sse2")
+void inverseSSE(const double* m, const Minors& minors, double* result) {
+    const double* s = minors.s;
+    const double* c = minors.c;
+    
+    // p[j] holds column j with each pair swapped: (a1j, a0j) and (a3j, a2j)
+    __m128d pLo[4];
+    __m128d pHi[4];
+    for (int j = 0; j < 4; ++j) {
+        __m128d lo = _mm_loadu_pd(m + j * 4);
+        __m128d hi = _mm_loadu_pd(m + j * 4 + 2);
+        pLo[j] = _mm_shuffle_pd(lo, lo, 1);
+        pHi[j] = _mm_shuffle_pd(hi, hi, 1);
+    }
+    
+    const __m128d signEven = _mm_set_pd(-0.0, 0.0);     // (+, -)
+    const __m128d signOdd = _mm_set_pd(0.0, -0.0);      // (-, +)
+    const __m128d invDet = _mm_set1_pd(1.0 / minors.determinant);
+    
+    __m128d rowLo[4] = {
+        adjugateHalf(pLo[1], pLo[2], pLo[3], c[5], c[4], c[3], signEven),
+        adjugateHalf(pLo[0], pLo[2], pLo[3], c[5], c[2], c[1], signOdd),
+        adjugateHalf(pLo[0], pLo[1], pLo[3], c[4], c[2], c[0], signEven),
+        adjugateHalf(pLo[0], pLo[1], pLo[2], c[3], c[1], c[0], signOdd)
+    };
+    __m128d rowHi[4] = {
+        adjugateHalf(pHi[1], pHi[2], pHi[3], s[5], s[4], s[3], signEven),
+        adjugateHalf(pHi[0], pHi[2], pHi[3], s[5], s[2], s[1], signOdd),
+        adjugateHalf(pHi[0], pHi[1], pHi[3], s[4], s[2], s[0], signEven),
+        adjugateHalf(pHi[0], pHi[1], pHi[2], s[3], s[1], s[0], signOdd)
+    };
+    
+    // Transpose the adjugate rows into columns
+    _mm_storeu_pd(result + 0, _mm_mul_pd(_mm_unpacklo_pd(rowLo[0], rowLo[1]), invDet));
+    _mm_storeu_pd(result + 2, _mm_mul_pd(_mm_unpacklo_pd(rowLo[2], rowLo[3]), invDet));
+    _mm_storeu_pd(result + 4, _mm_mul_pd(_mm_unpackhi_pd(rowLo[0], rowLo[1]), invDet));
+    _mm_storeu_pd(result + 6, _mm_mul_pd(_mm_unpackhi_pd(rowLo[2], rowLo[3]), invDet));
+    _mm_storeu_pd(result + 8, _mm_mul_pd(_mm_unpacklo_pd(rowHi[0], rowHi[1]), invDet));
+    _mm_storeu_pd(result + 10, _mm_mul_pd(_mm_unpacklo_pd(rowHi[2], rowHi[3]), invDet));
+    _mm_storeu_pd(result + 12, _mm_mul_pd(_mm_unpackhi_pd(rowHi[0], rowHi[1]), invDet));
+    _mm_storeu_pd(result + 14, _mm_mul_pd(_mm_unpackhi_pd(rowHi[2], rowHi[3]), invDet));
+}
+
+KITCHENCAD_TARGET("sse2")
+void transformPointsSSE(const double* m, Point3D* points, size_t count) {
+    const __m128d c0 = _mm_loadu_pd(m), c0z = _mm_load_sd(m + 2);
+    const __m128d c1 = _mm_loadu_pd(m + 4), c1z = _mm_load_sd(m + 6);
+    const __m128d c2 = _mm_loadu_pd(m + 8), c2z = _mm_load_sd(m + 10);
+    const __m128d c3 = _mm_loadu_pd(m + 12), c3z = _mm_load_sd(m + 14);
+    
+    for (size_t i = 0; i < count; ++i) {
+        double* point = &points[i].x;
+        __m128d x = _mm_set1_pd(point[0]);
+        __m128d y = _mm_set1_pd(point[1]);
+        __m128d z = _mm_set1_pd(point[2]);
+        
+        __m128d xy = _mm_add_pd(_mm_add_pd(_mm_add_pd(_mm_mul_pd(c0, x), _mm_mul_pd(c1, y)), _mm_mul_pd(c2, z)), c3);
+        __m128d zz = _mm_add_sd(_mm_add_sd(_mm_add_sd(_mm_mul_sd(c0z, x), _mm_mul_sd(c1z, y)), _mm_mul_sd(c2z, z)), c3z);
+        _mm_storeu_pd(point, xy);
+        _mm_store_sd(point + 2, zz);
+    }
+}
+
+KITCHENCAD_TARGET("sse2")
+void transformBoundsSSE(const double* m, const BoundingBox* boxes, BoundingBox* result, size_t count) {
+    const __m128d absMask = _mm_castsi128_pd(_mm_set1_epi64x(0x7fffffffffffffffLL));
+    const __m128d c0 = _mm_loadu_pd(m), c0z = _mm_load_sd(m + 2);
+    const __m128d c1 = _mm_loadu_pd(m + 4), c1z = _mm_load_sd(m + 6);
+    const __m128d c2 = _mm_loadu_pd(m + 8), c2z = _mm_load_sd(m + 10);
+    const __m128d c3 = _mm_loadu_pd(m + 12), c3z = _mm_load_sd(m + 14);
+    const __m128d a0 = _mm_and_pd(c0, absMask), a0z = _mm_and_pd(c0z, absMask);
+    const __m128d a1 = _mm_and_pd(c1, absMask), a1z = _mm_and_pd(c1z, absMask);
+    const __m128d a2 = _mm_and_pd(c2, absMask), a2z = _mm_and_pd(c2z, absMask);
+    
+    for (size_t i = 0; i < count; ++i) {
+        if (boxes[i].isEmpty()) {
+            result[i] = boxes[i];
+            continue;
+        }
+        
+        const Point3D center = boxes[i].center();
+        const Vector3D half = boxes[i].size() * 0.5;
+        __m128d cx = _mm_set1_pd(center.x), cy = _mm_set1_pd(center.y), cz = _mm_set1_pd(center.z);
+        __m128d hx = _mm_set1_pd(half.x), hy = _mm_set1_pd(half.y), hz = _mm_set1_pd(half.z);
+        
+        __m128d centerXY = _mm_add_pd(_mm_add_pd(_mm_add_pd(_mm_mul_pd(c0, cx), _mm_mul_pd(c1, cy)),
+                                                 _mm_mul_pd(c2, cz)), c3);
+        __m128d centerZ = _mm_add_sd(_mm_add_sd(_mm_add_sd(_mm_mul_sd(c0z, cx), _mm_mul_sd(c1z, cy)),
+                                                _mm_mul_sd(c2z, cz)), c3z);
+        __m128d extentXY = _mm_add_pd(_mm_add_pd(_mm_mul_pd(a0, hx), _mm_mul_pd(a1, hy)), _mm_mul_pd(a2, hz));
+        __m128d extentZ = _mm_add_sd(_mm_add_sd(_mm_mul_sd(a0z, hx), _mm_mul_sd(a1z, hy)), _mm_mul_sd(a2z, hz));
+        
+        _mm_storeu_pd(&result[i].min.x, _mm_sub_pd(centerXY, extentXY));
+        _mm_store_sd(&result[i].min.z, _mm_sub_sd(centerZ, extentZ));
+        _mm_storeu_pd(&result[i].max.x, _mm_add_pd(centerXY, extentXY));
+        _mm_store_sd(&result[i].max.z, _mm_add_sd(centerZ, extentZ));
+    }
+}
+
+KITCHENCAD_TARGET("avx2")
+void multiplyAVX2(const double* a, const double* b, double* result) {
+    const __m256d a0 = _mm256_loadu_pd(a);
+    const __m256d a1 = _mm256_loadu_pd(a + 4);
+    const __m256d a2 = _mm256_loadu_pd(a + 8);
+    const __m256d a3 = _mm256_loadu_pd(a + 12);
+    
+    for (int col = 0; col < 4; ++col) {
+        __m256d b0 = _mm256_broadcast_sd(b + col * 4);
+        __m256d b1 = _mm256_broadcast_sd(b + col * 4 + 1);
+        __m256d b2 = _mm256_broadcast_sd(b + col * 4 + 2);
+        __m256d b3 = _mm256_broadcast_sd(b + col * 4 + 3);
+        
+        // Separate multiply and add, not FMA, to round exactly like the scalar kernel
+        __m256d sum = _mm256_add_pd(_mm256_add_pd(_mm256_add_pd(_mm256_mul_pd(a0, b0), _mm256_mul_pd(a1, b1)),
+                                                  _mm256_mul_pd(a2, b2)), _mm256_mul_pd(a3, b3));
+        _mm256_storeu_pd(result + col * 4, sum);
+    }
+}
+
+// Four adjugate entries, sign * ((x * kx - y * ky) + z * kz) as in cofactorTerm()
+KITCHENCAD_TARGET("avx2")
+inline __m256d adjugateRow(__m256d x, __m256d y, __m256d z, __m256d kx, __m256d ky, __m256d kz, __m256d sign) {
+    __m256d value = _mm256_add_pd(_mm256_sub_pd(_mm256_mul_pd(x, kx), _mm256_mul_pd(y, ky)), _mm256_mul_pd(z, kz));
+    return _mm256_xor_pd(value, sign);
+}
+
+KITCHENCAD_TARGET("avx2")
+void inverseAVX2(const double* m, const Minors& minors, double* result) {
+    const double* s = minors.s;
+    const double* c = minors.c;
+    
+    // p[j] holds column j with each pair swapped: (a1j, a0j, a3j, a2j)
+    __m256d p[4];
+    for (int j = 0; j < 4; ++j) {
+        p[j] = _mm256_permute_pd(_mm256_loadu_pd(m + j * 4), 0x5);
+    }
+    
+    const __m256d signEven = _mm256_setr_pd(0.0, -0.0, 0.0, -0.0);     // (+, -, +, -)
+    const __m256d signOdd = _mm256_setr_pd(-0.0, 0.0, -0.0, 0.0);      // (-, +, -, +)
+    
+    // Columns 0 and 1 of the adjugate use the c minors, columns 2 and 3 the s minors
+    __m256d k[6];
+    for (int i = 0; i < 6; ++i) {
+        k[i] = _mm256_setr_pd(c[i], c[i], s[i], s[i]);
+    }
+    
+    __m256d r0 = adjugateRow(p[1], p[2], p[3], k[5], k[4], k[3], signEven);
+    __m256d r1 = adjugateRow(p[0], p[2], p[3], k[5], k[2], k[1], signOdd);
+    __m256d r2 = adjugateRow(p[0], p[1], p[3], k[4], k[2], k[0], signEven);
+    __m256d r3 = adjugateRow(p[0], p[1], p[2], k[3], k[1], k[0], signOdd);
+    
+    // Transpose the adjugate rows into columns
+    __m256d t0 = _mm256_unpacklo_pd(r0, r1);
+    __m256d t1 = _mm256_unpackhi_pd(r0, r1);
+    __m256d t2 = _mm256_unpacklo_pd(r2, r3);
+    __m256d t3 = _mm256_unpackhi_pd(r2, r3);
+    
+    const __m256d invDet = _mm256_set1_pd(1.0 / minors.determinant);
+    _mm256_storeu_pd(result, _mm256_mul_pd(_mm256_permute2f128_pd(t0, t2, 0x20), invDet));
+    _mm256_storeu_pd(result + 4, _mm256_mul_pd(_mm256_permute2f128_pd(t1, t3, 0x20), invDet));
+    _mm256_storeu_pd(result + 8, _mm256_mul_pd(_mm256_permute2f128_pd(t0, t2, 0x31), invDet));
+    _mm256_storeu_pd(result + 12, _mm256_mul_pd(_mm256_permute2f128_pd(t1, t3, 0x31), invDet));
+}
+
+KITCHENCAD_TARGET("avx2")
+inline void storePoint(double* target, __m256d value) {
+    _mm_storeu_pd(target, _mm256_castpd256_pd128(value));
+    _mm_store_sd(target + 2, _mm256_extractf128_pd(value, 1));
+}
+
+KITCHENCAD_TARGET("avx2")
+void transformPointsAVX2(const double* m, Point3D* points, size_t count) {
+    const __m256d c0 = _mm256_loadu_pd(m);
+    const __m256d c1 = _mm256_loadu_pd(m + 4);
+    const __m256d c2 = _mm256_loadu_pd(m + 8);
+    const __m256d c3 = _mm256_loadu_pd(m + 12);
+    
+    for (size_t i = 0; i < count; ++i) {
+        double* point = &points[i].x;
+        __m256d x = _mm256_broadcast_sd(point);
+        __m256d y = _mm256_broadcast_sd(point + 1);
+        __m256d z = _mm256_broadcast_sd(point + 2);
+        
+        __m256d value = _mm256_add_pd(_mm256_add_pd(_mm256_add_pd(_mm256_mul_pd(c0, x), _mm256_mul_pd(c1, y)),
+                                                    _mm256_mul_pd(c2, z)), c3);
+        storePoint(point, value);
+    }
+}
+
+KITCHENCAD_TARGET("avx2")
+void transformBoundsAVX2(const double* m, const BoundingBox* boxes, BoundingBox* result, size_t count) {
+    const __m256d absMask = _mm256_castsi256_pd(_mm256_set1_epi64x(0x7fffffffffffffffLL));
+    const __m256d c0 = _mm256_loadu_pd(m);
+    const __m256d c1 = _mm256_loadu_pd(m + 4);
+    const __m256d c2 = _mm256_loadu_pd(m + 8);
+    const __m256d c3 = _mm256_loadu_pd(m + 12);
+    const __m256d a0 = _mm256_and_pd(c0, absMask);
+    const __m256d a1 = _mm256_and_pd(c1, absMask);
+    const __m256d a2 = _mm256_and_pd(c2, absMask);
+    
+    for (size_t i = 0; i < count; ++i) {
+        if (boxes[i].isEmpty()) {
+            result[i] = boxes[i];
+            continue;
+        }
+        
+        const Point3D center = boxes[i].center();
+        const Vector3D half = boxes[i].size() * 0.5;
+        
+        __m256d newCenter = _mm256_add_pd(
+            _mm256_add_pd(_mm256_add_pd(_mm256_mul_pd(c0, _mm256_set1_pd(center.x)),
+                                        _mm256_mul_pd(c1, _mm256_set1_pd(center.y))),
+                          _mm256_mul_pd(c2, _mm256_set1_pd(center.z))), c3);
+        __m256d extent = _mm256_add_pd(_mm256_add_pd(_mm256_mul_pd(a0, _mm256_set1_pd(half.x)),
+                                                     _mm256_mul_pd(a1, _mm256_set1_pd(half.y))),
+                                       _mm256_mul_pd(a2, _mm256_set1_pd(half.z)));
+        
+        storePoint(&result[i].min.x, _mm256_sub_pd(newCenter, extent));
+        storePoint(&result[i].max.x, _mm256_add_pd(newCenter, extent));
+    }
+}
+
+#endif
+
+std::atomic<MatrixKernels::Kernel>& activeKernel() {
+    static std::atomic<MatrixKernels::Kernel> kernel{MatrixKernels::detectKernel()};
+    return kernel;
+}
+
+} // namespace
+
+void MatrixKernels::multiply(const double* a, const double* b, double* result) {
+    switch (getKernel()) {
+#ifdef KITCHENCAD_MATRIX_X86
+    case Kernel::AVX2:
+        multiplyAVX2(a, b, result);
+        break;
+    case Kernel::SSE:
+        multiplySSE(a, b, result);
+        break;
+#endif
+    default:
+        multiplyScalar(a, b, result);
+        break;
+    }
+}
+
+bool MatrixKernels::inverse(const double* matrix, double* result, double epsilon) {
+    Minors minors = computeMinors(matrix);
+    if (!(std::abs(minors.determinant) >= epsilon)) {
+        return false;
+    }
+    
+    switch (getKernel()) {
+#ifdef KITCHENCAD_MATRIX_X86
+    case Kernel::AVX2:
+        inverseAVX2(matrix, minors, result);
+        break;
+    case Kernel::SSE:
+        inverseSSE(matrix, minors, result);
+        break;
+#endif
+    default:
+        inverseScalar(matrix, minors, result);
+        break;
+    }
+    return true;
+}
+
+void MatrixKernels::transformPoints(const double* matrix, Point3D* points, size_t count) {
+    switch (getKernel()) {
+#ifdef KITCHENCAD_MATRIX_X86
+    case Kernel::AVX2:
+        transformPointsAVX2(matrix, points, count);
+        break;
+    case Kernel::SSE:
+        transformPointsSSE(matrix, points, count);
+        break;
+#endif
+    default:
+        transformPointsScalar(matrix, points, count);
+        break;
+    }
+}
+
+void MatrixKernels::transformBounds(const double* matrix, const BoundingBox* boxes, BoundingBox* result,
+                                    size_t count) {
+    switch (getKernel()) {
+#ifdef KITCHENCAD_MATRIX_X86
+    case Kernel::AVX2:
+        transformBoundsAVX2(matrix, boxes, result, count);
+        break;
+    case Kernel::SSE:
+        transformBoundsSSE(matrix, boxes, result, count);
+        break;
+#endif
+    default:
+        transformBoundsScalar(matrix, boxes, result, count);
+        break;
+    }
+}
+
+MatrixKernels::Kernel MatrixKernels::getKernel() {
+    return activeKernel().load(std::memory_order_relaxed);
+}
+
+void MatrixKernels::setKernel(Kernel kernel) {
+    activeKernel().store(isKernelSupported(kernel) ? kernel : detectKernel(), std::memory_order_relaxed);
+}
+
+MatrixKernels::Kernel MatrixKernels::detectKernel() {
+    static const Kernel detected = isKernelSupported(Kernel::AVX2) ? Kernel::AVX2
+                                 : isKernelSupported(Kernel::SSE) ? Kernel::SSE
+                                 : Kernel::Scalar;
+    return detected;
+}
+
+bool MatrixKernels::isKernelSupported(Kernel kernel) {
+    switch (kernel) {
+    case Kernel::Scalar:
+        return true;
+#if defined(KITCHENCAD_MATRIX_X86) && (defined(__GNUC__) || defined(__clang__))
+    case Kernel::SSE:
+        return __builtin_cpu_supports("sse2");
+    case Kernel::AVX2:
+        return __builtin_cpu_supports("avx2");
+#elif defined(KITCHENCAD_MATRIX_X86) && defined(_MSC_VER)
+    case Kernel::SSE: {
+        int info[4];
+        __cpuid(info, 1);
+        return (info[3] & (1 << 26)) != 0;
+    }
+    case Kernel::AVX2: {
+        int info[4];
+        __cpuid(info, 1);
+        bool osSavesYmm = (info[2] & (1 << 27)) && (info[2] & (1 << 28)) && ((_xgetbv(0) & 0x6) == 0x6);
+        __cpuidex(info, 7, 0);
+        return osSavesYmm && (info[1] & (1 << 5)) != 0;
+    }
+#endif
+    default:
+        return false;
+    }
+}
+
+} // namespace Geometry
+} // namespace KitchenCAD
\ No newline at end of file
@@ -0,0 +1,73 @@
+#pragma once
+
+#include "Point3D.h"
+#include <cstddef>
+
+namespace KitchenCAD {
+namespace Geometry {
+
+struct BoundingBox;
+
+/**
+ * @brief Vectorised kernels behind Matrix4x4 and batched point and box transforms
+ * 
+ * Matrices are passed as 16 doubles in Matrix4x4's column-major layout. The
+ * SSE kernels hold half a column per register and the AVX2 kernels a whole
+ * column. Every kernel adds the same products in the same order as the
+ * scalar one, so all kernels give bit-identical results.
+ * 
+ * The widest kernel supported by the CPU is selected at runtime, with a
+ * scalar fallback for other architectures. Point and box transforms treat
+ * the matrix as affine and ignore its bottom row.
+ */
+class MatrixKernels {
+public:
+    enum class Kernel {
+        Scalar,
+        SSE,
+        AVX2
+    };
+    
+    /**
+     * @brief result = a * b; result may alias either operand
+     */
+    static void multiply(const double* a, const double* b, double* result);
+    
+    /**
+     * @brief Inverse by 2x2 minors
+     * @return false, leaving result untouched, when |determinant| is below epsilon
+     */
+    static bool inverse(const double* matrix, double* result, double epsilon);
+    
+    /**
+     * @brief Transform points in place
+     */
+    static void transformPoints(const double* matrix, Point3D* points, size_t count);
+    
+    /**
+     * @brief Axis-aligned boxes around transformed boxes, from centre and extents
+     * 
+     * Empty boxes stay empty. result may alias boxes.
+     */
+    static void transformBounds(const double* matrix, const BoundingBox* boxes, BoundingBox* result, size_t count);
+    
+    /**
+     * @brief Kernel used by all operations in this process
+     */
+    static Kernel getKernel();
+    
+    /**
+     * @brief Force a kernel; unsupported kernels fall back to the best supported one
+     */
+    static void setKernel(Kernel kernel);
+    
+    /**
+     * @brief Widest kernel the current CPU supports
+     */
+    static Kernel detectKernel();
+    
+    static bool isKernelSupported(Kernel kernel);
+};
+
+} // namespace Geometry
+} // namespace KitchenCAD
\ No newline at end of file
@@ -7,6 +7,8 @@
 #include <TopAbs_ShapeEnum.hxx>
 #include <TopExp.hxx>
 #include <TopTools_IndexedMapOfShape.hxx>
+#include <TopLoc_Location.hxx>
+#include <TopoDS.hxx>
 #include <BRepClass3d_SolidClassifier.hxx>
 #include <BRepExtrema_DistShapeShape.hxx>
 #include <BRepMesh_IncrementalMesh.hxx>
@@ -26,6 +28,21 @@
 
 namespace KitchenCAD {
 
+namespace {
+
+// Positions closer than this hash alike; matches the engine's default tolerance
+constexpr double kGeometryHashResolution = 1e-7;
+
+void mixHash(uint64_t& hash, uint64_t value) {
+    hash ^= value + 0x9E3779B97F4A7C15ULL + (hash << 6) + (hash >> 2);
+}
+
+void mixHash(uint64_t& hash, double value) {
+    mixHash(hash, static_cast<uint64_t>(std::llround(value / kGeometryHashResolution)));
+}
+
+} // namespace
+
 // OCCTShape3D Implementation
 
 OCCTShape3D::OCCTShape3D(const TopoDS_Shape& shape) : shape_(shape) {
@@ -34,21 +51,17 @@ OCCTShape3D::OCCTShape3D(const TopoDS_Shape& shape) : shape_(shape) {
 
 OCCTShape3D::OCCTShape3D(const OCCTShape3D& other) 
     : shape_(other.shape_)
-    , boundingBoxCached_(other.boundingBoxCached_)
-    , cachedBoundingBox_(other.cachedBoundingBox_)
-    , propertiesCached_(other.propertiesCached_)
-    , cachedVolume_(other.cachedVolume_)
-    , cachedSurfaceArea_(other.cachedSurfaceArea_) {
+    , boundingBox_(other.boundingBox_)
+    , properties_(other.properties_)
+    , geometryHash_(other.geometryHash_) {
 }
 
 OCCTShape3D& OCCTShape3D::operator=(const OCCTShape3D& other) {
     if (this != &other) {
         shape_ = other.shape_;
-        boundingBoxCached_ = other.boundingBoxCached_;
-        cachedBoundingBox_ = other.cachedBoundingBox_;
-        propertiesCached_ = other.propertiesCached_;
-        cachedVolume_ = other.cachedVolume_;
-        cachedSurfaceArea_ = other.cachedSurfaceArea_;
+        boundingBox_ = other.boundingBox_;
+        properties_ = other.properties_;
+        geometryHash_ = other.geometryHash_;
     }
     return *this;
 }
@@ -59,24 +72,15 @@ void OCCTShape3D::setShape(const TopoDS_Shape& shape) {
 }
 
 Geometry::BoundingBox OCCTShape3D::getBoundingBox() const {
-    if (!boundingBoxCached_) {
-        calculateBoundingBox();
-    }
-    return cachedBoundingBox_;
+    return boundingBox_.get([this]() { return calculateBoundingBox(); });
 }
 
 double OCCTShape3D::getVolume() const {
-    if (!propertiesCached_) {
-        calculateProperties();
-    }
-    return cachedVolume_;
+    return properties_.get([this]() { return calculateProperties(); }).volume;
 }
 
 double OCCTShape3D::getSurfaceArea() const {
-    if (!propertiesCached_) {
-        calculateProperties();
-    }
-    return cachedSurfaceArea_;
+    return properties_.get([this]() { return calculateProperties(); }).surfaceArea;
 }
 
 bool OCCTShape3D::isValid() const {
@@ -258,6 +262,23 @@ bool OCCTShape3D::deserialize(const std::string& filePath) {
     }
 }
 
+uint64_t OCCTShape3D::getGeometryHash() const {
+    return geometryHash_.get([this]() { return calculateGeometryHash(); });
+}
+
+Geometry::Matrix4x4 OCCTShape3D::getLocationMatrix() const {
+    Geometry::Matrix4x4 matrix;
+    if (shape_.IsNull()) return matrix;
+    
+    gp_Trsf trsf = shape_.Location().Transformation();
+    for (int row = 0; row < 3; ++row) {
+        for (int col = 0; col < 4; ++col) {
+            matrix(row, col) = trsf.Value(row + 1, col + 1);
+        }
+    }
+    return matrix;
+}
+
 std::vector<TopoDS_Face> OCCTShape3D::getFaces() const {
     std::vector<TopoDS_Face> faces;
     
@@ -394,13 +415,9 @@ Geometry::Point3D OCCTShape3D::fromOCCPoint(const gp_Pnt& point) const {
     return Geometry::Point3D(point.X(), point.Y(), point.Z());
 }
 
-void OCCTShape3D::calculateProperties() const {
-    if (shape_.IsNull()) {
-        cachedVolume_ = 0.0;
-        cachedSurfaceArea_ = 0.0;
-        propertiesCached_ = true;
-        return;
-    }
+OCCTShape3D::Properties OCCTShape3D::calculateProperties() const {
+    Properties properties;
+    if (shape_.IsNull()) return properties;
     
     try {
         GProp_GProps volumeProps, surfaceProps;
@@ -408,29 +425,23 @@ void OCCTShape3D::calculateProperties() const {
         // Calculate volume (for solids)
         if (isSolid()) {
             BRepGProp::VolumeProperties(shape_, volumeProps);
-            cachedVolume_ = volumeProps.Mass();
-        } else {
-            cachedVolume_ = 0.0;
+            properties.volume = volumeProps.Mass();
         }
         
         // Calculate surface area
         BRepGProp::SurfaceProperties(shape_, surfaceProps);
-        cachedSurfaceArea_ = surfaceProps.Mass();
-        
-        propertiesCached_ = true;
+        properties.surfaceArea = surfaceProps.Mass();
     } catch (const Standard_Failure& e) {
         LOG_WARNING("Error calculating shape properties: " + std::string(e.GetMessageString()));
-        cachedVolume_ = 0.0;
-        cachedSurfaceArea_ = 0.0;
-        propertiesCached_ = true;
+        properties = Properties();
     }
+    
+    return properties;
 }
 
-void OCCTShape3D::calculateBoundingBox() const {
+Geometry::BoundingBox OCCTShape3D::calculateBoundingBox() const {
     if (shape_.IsNull()) {
-        cachedBoundingBox_ = Geometry::BoundingBox();
-        boundingBoxCached_ = true;
-        return;
+        return Geometry::BoundingBox();
     }
     
     try {
@@ -441,27 +452,71 @@ void OCCTShape3D::calculateBoundingBox() const {
             Standard_Real xMin, yMin, zMin, xMax, yMax, zMax;
             box.Get(xMin, yMin, zMin, xMax, yMax, zMax);
             
-            cachedBoundingBox_ = Geometry::BoundingBox(
+            return Geometry::BoundingBox(
                 Geometry::Point3D(xMin, yMin, zMin),
                 Geometry::Point3D(xMax, yMax, zMax)
             );
-        } else {
-            cachedBoundingBox_ = Geometry::BoundingBox();
         }
-        
-        boundingBoxCached_ = true;
     } catch (const Standard_Failure& e) {
         LOG_WARNING("Error calculating bounding box: " + std::string(e.GetMessageString()));
-        cachedBoundingBox_ = Geometry::BoundingBox();
-        boundingBoxCached_ = true;
     }
+    
+    return Geometry::BoundingBox();
+}
+
+uint64_t OCCTShape3D::calculateGeometryHash() const {
+    uint64_t hash = 0xCBF29CE484222325ULL;
+    
+    if (shape_.IsNull()) {
+        return hash;
+    }
+    
+    try {
+        TopoDS_Shape local = shape_.Located(TopLoc_Location());
+        mixHash(hash, static_cast<uint64_t>(local.ShapeType()));
+        
+        TopTools_IndexedMapOfShape vertices;
+        TopExp::MapShapes(local, TopAbs_VERTEX, vertices);
+        mixHash(hash, static_cast<uint64_t>(vertices.Extent()));
+        for (int i = 1; i <= vertices.Extent(); ++i) {
+            gp_Pnt point = BRep_Tool::Pnt(TopoDS::Vertex(vertices(i)));
+            mixHash(hash, point.X());
+            mixHash(hash, point.Y());
+            mixHash(hash, point.Z());
+        }
+        
+        TopTools_IndexedMapOfShape edges;
+        TopExp::MapShapes(local, TopAbs_EDGE, edges);
+        mixHash(hash, static_cast<uint64_t>(edges.Extent()));
+        
+        // Surface types and parameter ranges tell apart faces sharing vertices
+        TopTools_IndexedMapOfShape faces;
+        TopExp::MapShapes(local, TopAbs_FACE, faces);
+        mixHash(hash, static_cast<uint64_t>(faces.Extent()));
+        for (int i = 1; i <= faces.Extent(); ++i) {
+            const TopoDS_Face& face = TopoDS::Face(faces(i));
+            BRepAdaptor_Surface surface(face);
+            mixHash(hash, static_cast<uint64_t>(surface.GetType()));
+            mixHash(hash, static_cast<uint64_t>(face.Orientation()));
+            mixHash(hash, surface.FirstUParameter());
+            mixHash(hash, surface.LastUParameter());
+            mixHash(hash, surface.FirstVParameter());
+            mixHash(hash, surface.LastVParameter());
+        }
+    } catch (const Standard_Failure& e) {
+        LOG_WARNING("Error hashing shape geometry: " + std::string(e.GetMessageString()));
+        
+        // Fall back to the identity of the shared topology
+        mixHash(hash, static_cast<uint64_t>(reinterpret_cast<uintptr_t>(shape_.TShape().get())));
+    }
+    
+    return hash;
 }
 
 void OCCTShape3D::clearCache() {
-    boundingBoxCached_ = false;
-    propertiesCached_ = false;
-    cachedVolume_ = 0.0;
-    cachedSurfaceArea_ = 0.0;
+    boundingBox_.reset();
+    properties_.reset();
+    geometryHash_.reset();
 }
 
 // OCCTFace Implementation
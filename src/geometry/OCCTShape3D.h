@@ -7,6 +7,8 @@
 #include "../geometry/Vector3D.h"
 #include "../geometry/Transform3D.h"
 #include "../geometry/BoundingBox.h"
+#include "../geometry/Matrix4x4.h"
+#include "../utils/LazyValue.h"
 
 // OpenCascade includes
 #include <TopoDS_Shape.hxx>
@@ -25,6 +27,7 @@
 #include <BRepTools.hxx>
 #include <BRep_Builder.hxx>
 
+#include <cstdint>
 #include <memory>
 #include <string>
 
@@ -36,15 +39,22 @@ namespace KitchenCAD {
  * This class wraps OpenCascade's TopoDS_Shape to provide the Shape3D interface.
  * It handles geometric operations, transformations, and property calculations
  * using OpenCascade's robust geometric kernel.
+ * 
+ * Const queries may run concurrently on a shared shape: bounding box, mass
+ * properties and geometry hash are computed once, by the first thread to ask.
+ * Modifying the shape still needs exclusive access.
  */
 class OCCTShape3D : public Shape3D {
 private:
+    struct Properties {
+        double volume = 0.0;
+        double surfaceArea = 0.0;
+    };
+    
     TopoDS_Shape shape_;
-    mutable bool boundingBoxCached_ = false;
-    mutable Geometry::BoundingBox cachedBoundingBox_;
-    mutable bool propertiesCached_ = false;
-    mutable double cachedVolume_ = 0.0;
-    mutable double cachedSurfaceArea_ = 0.0;
+    Utils::LazyValue<Geometry::BoundingBox> boundingBox_;
+    Utils::LazyValue<Properties> properties_;
+    Utils::LazyValue<uint64_t> geometryHash_;
 
 public:
     /**
@@ -104,6 +114,22 @@ public:
      */
     void setShape(const TopoDS_Shape& shape);
     
+    /**
+     * @brief Hash of the shape's geometry, ignoring its location
+     * 
+     * Built from the topology, the vertex positions and the face surfaces, so
+     * shapes constructed the same way hash alike, and a shape moved rigidly
+     * keeps its hash. Used to share tessellations between identical shapes.
+     */
+    uint64_t getGeometryHash() const;
+    
+    /**
+     * @brief Location of the shape as a matrix
+     * 
+     * Maps the frame getGeometryHash describes into world coordinates.
+     */
+    Geometry::Matrix4x4 getLocationMatrix() const;
+    
     /**
      * @brief Get all faces of the shape
      */
@@ -166,14 +192,19 @@ private:
     Geometry::Point3D fromOCCPoint(const gp_Pnt& point) const;
     
     /**
-     * @brief Calculate and cache geometric properties
+     * @brief Calculate volume and surface area
      */
-    void calculateProperties() const;
+    Properties calculateProperties() const;
+    
+    /**
+     * @brief Calculate bounding box
+     */
+    Geometry::BoundingBox calculateBoundingBox() const;
     
     /**
-     * @brief Calculate and cache bounding box
+     * @brief Calculate the geometry hash
      */
-    void calculateBoundingBox() const;
+    uint64_t calculateGeometryHash() const;
     
     /**
      * @brief Clear cached values
@@ -11,6 +11,12 @@
 #include <BRepTools.hxx>
 #include <TopExp_Explorer.hxx>
 #include <TopoDS.hxx>
+#include <TopLoc_Location.hxx>
+#include <BRep_Tool.hxx>
+#include <Poly_Triangulation.hxx>
+#include <TColgp_Array1OfPnt.hxx>
+#include <Poly_Array1OfTriangle.hxx>
+#include <TopTools_ListOfShape.hxx>
 #include <gp_Vec.hxx>
 #include <gp_Ax1.hxx>
 #include <Standard_Failure.hxx>
@@ -21,7 +27,10 @@
 namespace KitchenCAD {
 
 OpenCascadeGeometryEngine::OpenCascadeGeometryEngine(double tolerance) 
-    : tolerance_(tolerance) {
+    : tolerance_(tolerance)
+    , tessellationCache_(&Geometry::TessellationCache::instance())
+    , parallelMode_(true)
+    , booleanFuzzyValue_(1e-6) {
     LOG_INFO("OpenCascade Geometry Engine initialized with tolerance: " + std::to_string(tolerance));
 }
 
@@ -231,37 +240,11 @@ bool OpenCascadeGeometryEngine::performBoolean(Shape3D& target, const Shape3D& t
     }
     
     try {
-        TopoDS_Shape result;
-        bool success = false;
+        TopTools_ListOfShape tools;
+        tools.Append(toolOCCT->getShape());
+        TopoDS_Shape result = runBoolean(op, targetOCCT->getShape(), tools);
         
-        switch (op) {
-            case BooleanOperation::Union: {
-                BRepAlgoAPI_Fuse fuseOp(targetOCCT->getShape(), toolOCCT->getShape());
-                if (fuseOp.IsDone()) {
-                    result = fuseOp.Shape();
-                    success = true;
-                }
-                break;
-            }
-            case BooleanOperation::Difference: {
-                BRepAlgoAPI_Cut cutOp(targetOCCT->getShape(), toolOCCT->getShape());
-                if (cutOp.IsDone()) {
-                    result = cutOp.Shape();
-                    success = true;
-                }
-                break;
-            }
-            case BooleanOperation::Intersection: {
-                BRepAlgoAPI_Common commonOp(targetOCCT->getShape(), toolOCCT->getShape());
-                if (commonOp.IsDone()) {
-                    result = commonOp.Shape();
-                    success = true;
-                }
-                break;
-            }
-        }
-        
-        if (success && !result.IsNull()) {
+        if (!result.IsNull()) {
             targetOCCT->setShape(result);
             return true;
         } else {
@@ -274,6 +257,53 @@ bool OpenCascadeGeometryEngine::performBoolean(Shape3D& target, const Shape3D& t
     }
 }
 
+bool OpenCascadeGeometryEngine::performBooleanBatch(Shape3D& target, std::span<const Shape3D* const> tools, 
+                                                    BooleanOperation op) {
+    if (tools.empty()) {
+        return true;
+    }
+    
+    if (op == BooleanOperation::Intersection || tools.size() == 1) {
+        return IGeometryEngine::performBooleanBatch(target, tools, op);
+    }
+    
+    OCCTShape3D* targetOCCT = getOCCTShape(target);
+    if (!targetOCCT) {
+        LOG_ERROR("Boolean operation requires OCCTShape3D objects");
+        return false;
+    }
+    
+    TopTools_ListOfShape toolShapes;
+    for (const Shape3D* tool : tools) {
+        if (!validateBooleanInputs(target, *tool)) {
+            return false;
+        }
+        
+        const OCCTShape3D* toolOCCT = getOCCTShape(*tool);
+        if (!toolOCCT) {
+            LOG_ERROR("Boolean operation requires OCCTShape3D objects");
+            return false;
+        }
+        toolShapes.Append(toolOCCT->getShape());
+    }
+    
+    try {
+        TopoDS_Shape result = runBoolean(op, targetOCCT->getShape(), toolShapes);
+        
+        if (!result.IsNull()) {
+            targetOCCT->setShape(result);
+            return true;
+        } else {
+            LOG_ERROR("Batch boolean operation with " + std::to_string(tools.size()) + 
+                      " tools failed or produced null result");
+            return false;
+        }
+    } catch (const Standard_Failure& e) {
+        LOG_ERROR("Error performing batch boolean operation: " + std::string(e.GetMessageString()));
+        return false;
+    }
+}
+
 std::vector<Face> OpenCascadeGeometryEngine::getFaces(const Shape3D& shape) {
     std::vector<Face> faces;
     
@@ -330,6 +360,28 @@ bool OpenCascadeGeometryEngine::isClosed(const Shape3D& shape) {
     return shape.isClosed();
 }
 
+std::vector<bool> OpenCascadeGeometryEngine::intersectsPairs(std::span<const ShapePair> pairs, Utils::ThreadPool& pool) {
+    // Shapes repeat across pairs and cache their boxes lazily, so fill the
+    // caches before threads share them
+    for (const auto& [first, second] : pairs) {
+        first->getBoundingBox();
+        second->getBoundingBox();
+    }
+    
+    std::vector<char> hits(pairs.size(), 0);
+    pool.parallelFor(pairs.size(), [&](size_t begin, size_t end) {
+        for (size_t i = begin; i < end; ++i) {
+            const auto& [first, second] = pairs[i];
+            
+            // Boxes further apart than the contact tolerance rule out the exact test
+            if (!first->getBoundingBox().expanded(1e-6).intersects(second->getBoundingBox())) continue;
+            
+            hits[i] = intersects(*first, *second) ? 1 : 0;
+        }
+    });
+    return std::vector<bool>(hits.begin(), hits.end());
+}
+
 std::unique_ptr<Shape3D> OpenCascadeGeometryEngine::createFromOCCShape(const TopoDS_Shape& shape) {
     return std::make_unique<OCCTShape3D>(shape);
 }
@@ -460,24 +512,113 @@ double OpenCascadeGeometryEngine::getMomentOfInertia(const Shape3D& shape, const
     }
 }
 
-bool OpenCascadeGeometryEngine::meshShape(Shape3D& shape, double linearDeflection, double angularDeflection) {
-    OCCTShape3D* occShape = getOCCTShape(shape);
+std::shared_ptr<const Geometry::TriangleMesh> OpenCascadeGeometryEngine::meshShape(const Shape3D& shape, 
+                                                                                  double linearDeflection, 
+                                                                                  double angularDeflection) {
+    const OCCTShape3D* occShape = getOCCTShape(shape);
     if (!occShape) {
         LOG_ERROR("meshShape requires OCCTShape3D object");
-        return false;
+        return nullptr;
     }
     
-    try {
-        BRepMesh_IncrementalMesh mesh(occShape->getShape(), linearDeflection, Standard_False, angularDeflection);
-        return mesh.IsDone();
-    } catch (const Standard_Failure& e) {
-        LOG_ERROR("Error meshing shape: " + std::string(e.GetMessageString()));
-        return false;
+    if (occShape->isEmpty()) {
+        LOG_ERROR("Cannot mesh an empty shape");
+        return nullptr;
     }
+    
+    Geometry::TessellationCache::Key key{occShape->getGeometryHash(), linearDeflection, angularDeflection};
+    
+    return tessellationCache_->getOrCreate(key, [&]() -> std::shared_ptr<Geometry::TriangleMesh> {
+        try {
+            // Mesh in the local frame so every placement of the shape shares the result
+            TopoDS_Shape local = occShape->getShape().Located(TopLoc_Location());
+            BRepMesh_IncrementalMesh mesh(local, linearDeflection, Standard_False, angularDeflection, parallelMode_);
+            if (!mesh.IsDone()) {
+                LOG_ERROR("Meshing did not complete");
+                return nullptr;
+            }
+            
+            return extractTriangles(local);
+        } catch (const Standard_Failure& e) {
+            LOG_ERROR("Error meshing shape: " + std::string(e.GetMessageString()));
+            return nullptr;
+        }
+    });
+}
+
+void OpenCascadeGeometryEngine::setTessellationCache(Geometry::TessellationCache& cache) {
+    tessellationCache_ = &cache;
 }
 
 // Private helper methods
 
+std::shared_ptr<Geometry::TriangleMesh> OpenCascadeGeometryEngine::extractTriangles(const TopoDS_Shape& shape) const {
+    auto result = std::make_shared<Geometry::TriangleMesh>();
+    
+    for (TopExp_Explorer explorer(shape, TopAbs_FACE); explorer.More(); explorer.Next()) {
+        const TopoDS_Face& face = TopoDS::Face(explorer.Current());
+        
+        TopLoc_Location location;
+        Handle(Poly_Triangulation) triangulation = BRep_Tool::Triangulation(face, location);
+        if (triangulation.IsNull()) continue;
+        
+        const gp_Trsf& trsf = location.Transformation();
+        const TColgp_Array1OfPnt& nodes = triangulation->Nodes();
+        const Poly_Array1OfTriangle& triangles = triangulation->Triangles();
+        
+        // Node numbers are 1-based and local to the face
+        uint32_t base = static_cast<uint32_t>(result->vertices.size()) - static_cast<uint32_t>(nodes.Lower());
+        for (int i = nodes.Lower(); i <= nodes.Upper(); ++i) {
+            result->vertices.push_back(fromOCCPoint(nodes(i).Transformed(trsf)));
+        }
+        
+        bool reversed = face.Orientation() == TopAbs_REVERSED;
+        for (int i = triangles.Lower(); i <= triangles.Upper(); ++i) {
+            Standard_Integer n1, n2, n3;
+            triangles(i).Get(n1, n2, n3);
+            if (reversed) std::swap(n2, n3);
+            
+            result->indices.push_back(base + static_cast<uint32_t>(n1));
+            result->indices.push_back(base + static_cast<uint32_t>(n2));
+            result->indices.push_back(base + static_cast<uint32_t>(n3));
+        }
+    }
+    
+    result->vertices.shrink_to_fit();
+    result->indices.shrink_to_fit();
+    return result;
+}
+
+template<typename BooleanAlgorithm>
+TopoDS_Shape OpenCascadeGeometryEngine::runBoolean(const TopoDS_Shape& target, const TopTools_ListOfShape& tools) const {
+    TopTools_ListOfShape arguments;
+    arguments.Append(target);
+    
+    BooleanAlgorithm algorithm;
+    algorithm.SetArguments(arguments);
+    algorithm.SetTools(tools);
+    algorithm.SetRunParallel(parallelMode_ ? Standard_True : Standard_False);
+    algorithm.SetFuzzyValue(booleanFuzzyValue_);
+    // Inputs may be shared with other shapes, e.g. prototypes, so never modify them
+    algorithm.SetNonDestructive(Standard_True);
+    algorithm.Build();
+    
+    return algorithm.IsDone() ? algorithm.Shape() : TopoDS_Shape();
+}
+
+TopoDS_Shape OpenCascadeGeometryEngine::runBoolean(BooleanOperation op, const TopoDS_Shape& target, 
+                                                   const TopTools_ListOfShape& tools) const {
+    switch (op) {
+        case BooleanOperation::Union:
+            return runBoolean<BRepAlgoAPI_Fuse>(target, tools);
+        case BooleanOperation::Difference:
+            return runBoolean<BRepAlgoAPI_Cut>(target, tools);
+        case BooleanOperation::Intersection:
+            return runBoolean<BRepAlgoAPI_Common>(target, tools);
+    }
+    return TopoDS_Shape();
+}
+
 gp_Pnt OpenCascadeGeometryEngine::toOCCPoint(const Geometry::Point3D& point) const {
     return gp_Pnt(point.x, point.y, point.z);
 }
@@ -4,6 +4,7 @@
 
 #include "../interfaces/IGeometryEngine.h"
 #include "OCCTShape3D.h"
+#include "TessellationCache.h"
 
 // OpenCascade includes
 #include <TopoDS_Shape.hxx>
@@ -14,11 +15,13 @@
 #include <BRepAlgoAPI_Fuse.hxx>
 #include <BRepAlgoAPI_Cut.hxx>
 #include <BRepAlgoAPI_Common.hxx>
+#include <TopTools_ListOfShape.hxx>
 #include <gp_Pnt.hxx>
 #include <gp_Ax2.hxx>
 #include <gp_Dir.hxx>
 
 #include <memory>
+#include <span>
 #include <vector>
 
 namespace KitchenCAD {
@@ -33,6 +36,9 @@ namespace KitchenCAD {
 class OpenCascadeGeometryEngine : public IGeometryEngine {
 private:
     double tolerance_;  // Geometric tolerance for operations
+    Geometry::TessellationCache* tessellationCache_;  // Process-wide cache unless replaced
+    bool parallelMode_;  // Let OCCT booleans and meshing use their own threads
+    double booleanFuzzyValue_;  // Extra tolerance for near-coincident faces in booleans
     
 public:
     /**
@@ -63,6 +69,18 @@ public:
     // Boolean operations
     bool performBoolean(Shape3D& target, const Shape3D& tool, BooleanOperation op) override;
     
+    /**
+     * @brief Union or difference with all tools in one OCCT boolean
+     * 
+     * The tools are passed together as the tool group of a single
+     * BRepAlgoAPI_Fuse or BRepAlgoAPI_Cut, so intersections between the target
+     * and each tool are computed once and in parallel when parallel mode is
+     * on. Target is only modified if the whole operation succeeds.
+     * Intersection falls back to one tool at a time, because OCCT intersects
+     * the target with the union of a tool group rather than with each tool.
+     */
+    bool performBooleanBatch(Shape3D& target, std::span<const Shape3D* const> tools, BooleanOperation op) override;
+    
     // Geometric analysis
     std::vector<Face> getFaces(const Shape3D& shape) override;
     Geometry::BoundingBox getBoundingBox(const Shape3D& shape) override;
@@ -81,6 +99,11 @@ public:
     bool isValidShape(const Shape3D& shape) override;
     bool isClosed(const Shape3D& shape) override;
     
+    // Batch queries
+    using IGeometryEngine::intersectsPairs;
+    
+    std::vector<bool> intersectsPairs(std::span<const ShapePair> pairs, Utils::ThreadPool& pool) override;
+    
     // OpenCascade-specific methods
     
     /**
@@ -93,6 +116,21 @@ public:
      */
     void setTolerance(double tolerance) { tolerance_ = tolerance; }
     
+    /**
+     * @brief Enable OCCT's internal parallelism in booleans and meshing
+     */
+    void setParallelMode(bool enabled) { parallelMode_ = enabled; }
+    bool isParallelMode() const { return parallelMode_; }
+    
+    /**
+     * @brief Set the fuzzy value of booleans; 0 uses exact tolerances
+     * 
+     * Faces closer than this are treated as coincident, which keeps cuts
+     * with tools flush to a face from leaving slivers.
+     */
+    void setBooleanFuzzyValue(double fuzzyValue) { booleanFuzzyValue_ = fuzzyValue; }
+    double getBooleanFuzzyValue() const { return booleanFuzzyValue_; }
+    
     /**
      * @brief Create a box from two corner points
      */
@@ -145,8 +183,23 @@ public:
     
     /**
      * @brief Mesh a shape for visualization
+     * 
+     * Meshes are cached by the shape's geometry hash and the deflections, so
+     * identical shapes are meshed once. The mesh is in the shape's local
+     * frame; place it with OCCTShape3D::getLocationMatrix.
+     * 
+     * @return Shared immutable mesh, or nullptr if meshing failed
+     */
+    std::shared_ptr<const Geometry::TriangleMesh> meshShape(const Shape3D& shape, 
+                                                           double linearDeflection = 0.1, 
+                                                           double angularDeflection = 0.1);
+    
+    /**
+     * @brief Use a different tessellation cache, e.g. to isolate tests
      */
-    bool meshShape(Shape3D& shape, double linearDeflection = 0.1, double angularDeflection = 0.1);
+    void setTessellationCache(Geometry::TessellationCache& cache);
+    
+    Geometry::TessellationCache& getTessellationCache() const { return *tessellationCache_; }
 
 private:
     /**
@@ -170,11 +223,27 @@ private:
     gp_Ax2 createCoordinateSystem(const Geometry::Point3D& origin, 
                                   const Geometry::Vector3D& direction) const;
     
+    /**
+     * @brief Run one OCCT boolean with the engine's parallel mode and fuzzy value
+     */
+    template<typename BooleanAlgorithm>
+    TopoDS_Shape runBoolean(const TopoDS_Shape& target, const TopTools_ListOfShape& tools) const;
+    
+    /**
+     * @brief Dispatch op to runBoolean
+     */
+    TopoDS_Shape runBoolean(BooleanOperation op, const TopoDS_Shape& target, const TopTools_ListOfShape& tools) const;
+    
     /**
      * @brief Validate boolean operation inputs
      */
     bool validateBooleanInputs(const Shape3D& target, const Shape3D& tool) const;
     
+    /**
+     * @brief Collect the triangulations of all faces into one mesh
+     */
+    std::shared_ptr<Geometry::TriangleMesh> extractTriangles(const TopoDS_Shape& shape) const;
+    
     /**
      * @brief Get OCCTShape3D from Shape3D (with type checking)
      */
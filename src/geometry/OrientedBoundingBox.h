@@ -0,0 +1,262 @@
+#pragma once
+
+#include "Point3D.h"
+#include "Vector3D.h"
+#include "Transform3D.h"
+#include "BoundingBox.h"
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <limits>
+#include <optional>
+#include <span>
+#include <utility>
+#include <vector>
+
+namespace KitchenCAD {
+namespace Geometry {
+
+/**
+ * @brief Box with its own orthonormal axes, for collision tests on rotated objects
+ * 
+ * An axis-aligned box around a rotated cabinet covers empty corners, so two
+ * cabinets turned 45 degrees into a corner can overlap as AABBs while their
+ * real boxes are well apart. Tests between oriented boxes use the separating
+ * axis theorem over the 15 candidate axes.
+ */
+struct OrientedBoundingBox {
+    Point3D center;
+    std::array<Vector3D, 3> axes;   // Unit local axes in world space
+    Vector3D halfExtents;           // Half size along each local axis; negative when empty
+    
+    OrientedBoundingBox()
+        : axes{Vector3D(1.0, 0.0, 0.0), Vector3D(0.0, 1.0, 0.0), Vector3D(0.0, 0.0, 1.0)}
+        , halfExtents(-1.0, -1.0, -1.0) {}
+    
+    OrientedBoundingBox(const Point3D& center, const std::array<Vector3D, 3>& axes, const Vector3D& halfExtents)
+        : center(center), axes(axes), halfExtents(halfExtents) {}
+    
+    /**
+     * @brief Oriented box equal to an axis-aligned one
+     */
+    static OrientedBoundingBox fromBoundingBox(const BoundingBox& box) {
+        if (box.isEmpty()) return OrientedBoundingBox();
+        
+        Vector3D size = box.size();
+        return OrientedBoundingBox(box.center(),
+                                   {Vector3D(1.0, 0.0, 0.0), Vector3D(0.0, 1.0, 0.0), Vector3D(0.0, 0.0, 1.0)},
+                                   size * 0.5);
+    }
+    
+    /**
+     * @brief Local-space box placed by a transform
+     * 
+     * The rotation gives the axes and the scale stretches the local box along
+     * them, so the result is exact for any rotation and non-negative scale.
+     */
+    static OrientedBoundingBox fromTransform(const BoundingBox& localBox, const Transform3D& transform) {
+        return fromMatrix(localBox, transform.toMatrix());
+    }
+    
+    /**
+     * @brief Local-space box placed by an affine world matrix, such as a cached one
+     */
+    static OrientedBoundingBox fromMatrix(const BoundingBox& localBox, const Matrix4x4& matrix) {
+        if (localBox.isEmpty()) return OrientedBoundingBox();
+        
+        Vector3D localHalf = localBox.size() * 0.5;
+        
+        OrientedBoundingBox box;
+        box.center = matrix.transformPoint(localBox.center());
+        for (int i = 0; i < 3; ++i) {
+            Vector3D column(matrix(0, i), matrix(1, i), matrix(2, i));
+            double length = column.length();
+            
+            // A zero scale flattens the box; keep a valid axis so the tests stay defined
+            if (length > 0.0) {
+                box.axes[i] = column * (1.0 / length);
+            }
+            box.halfExtents[i] = localHalf[i] * length;
+        }
+        
+        return box;
+    }
+    
+    bool isEmpty() const {
+        return halfExtents.x < 0.0 || halfExtents.y < 0.0 || halfExtents.z < 0.0;
+    }
+    
+    /**
+     * @brief Whether the local axes are exactly the world axes
+     */
+    bool isAxisAligned() const {
+        return axes[0].x == 1.0 && axes[1].y == 1.0 && axes[2].z == 1.0;
+    }
+    
+    /**
+     * @brief Tightest axis-aligned box around this one
+     */
+    BoundingBox bounds() const {
+        if (isEmpty()) return BoundingBox();
+        
+        Vector3D extent;
+        for (int k = 0; k < 3; ++k) {
+            extent[k] = std::abs(axes[0][k]) * halfExtents.x + std::abs(axes[1][k]) * halfExtents.y +
+                        std::abs(axes[2][k]) * halfExtents.z;
+        }
+        
+        return BoundingBox(center - extent, center + extent);
+    }
+    
+    /**
+     * @brief Whether the boxes overlap or lie within tolerance of each other
+     */
+    bool intersects(const OrientedBoundingBox& other, double tolerance = 0.0) const {
+        // Unrotated furniture is the common case, and for it the face axes alone decide
+        if (isAxisAligned() && other.isAxisAligned() && !isEmpty() && !other.isEmpty()) {
+            for (int k = 0; k < 3; ++k) {
+                if (std::abs(other.center[k] - center[k]) > halfExtents[k] + other.halfExtents[k] + tolerance) {
+                    return false;
+                }
+            }
+            return true;
+        }
+        
+        Vector3D axis;
+        double depth;
+        return penetration(other, axis, depth, tolerance);
+    }
+    
+    /**
+     * @brief Smallest translation that separates this box from another
+     * 
+     * Returns false when some axis separates the boxes by more than the
+     * tolerance. Otherwise axis is the unit axis of least overlap, pointing
+     * from the other box towards this one, and depth is the overlap along it
+     * (zero for boxes that only touch).
+     */
+    bool penetration(const OrientedBoundingBox& other, Vector3D& axis, double& depth,
+                     double tolerance = 0.0) const {
+        if (isEmpty() || other.isEmpty()) return false;
+        
+        // Work in this box's frame: r rotates the other box's axes into it
+        const Vector3D offset(other.center.x - center.x, other.center.y - center.y, other.center.z - center.z);
+        const double a[3] = {halfExtents.x, halfExtents.y, halfExtents.z};
+        const double b[3] = {other.halfExtents.x, other.halfExtents.y, other.halfExtents.z};
+        
+        double r[3][3];
+        double absR[3][3];
+        double t[3];
+        for (int i = 0; i < 3; ++i) {
+            t[i] = offset.dot(axes[i]);
+            for (int j = 0; j < 3; ++j) {
+                r[i][j] = axes[i].dot(other.axes[j]);
+                // The epsilon keeps near-parallel edge axes from reporting false separations
+                absR[i][j] = std::abs(r[i][j]) + kParallelEpsilon;
+            }
+        }
+        
+        // Projected radii and centre distance on each candidate axis, in fixed-size
+        // arrays so the arithmetic is straight-line and free of early exits
+        std::array<double, kAxisCount> radius;
+        std::array<double, kAxisCount> distance;
+        std::array<double, kAxisCount> length;
+        
+        for (int i = 0; i < 3; ++i) {
+            // Face normals of this box
+            radius[i] = a[i] + b[0] * absR[i][0] + b[1] * absR[i][1] + b[2] * absR[i][2];
+            distance[i] = std::abs(t[i]);
+            length[i] = 1.0;
+            
+            // Face normals of the other box
+            radius[3 + i] = b[i] + a[0] * absR[0][i] + a[1] * absR[1][i] + a[2] * absR[2][i];
+            distance[3 + i] = std::abs(t[0] * r[0][i] + t[1] * r[1][i] + t[2] * r[2][i]);
+            length[3 + i] = 1.0;
+        }
+        
+        for (int i = 0; i < 3; ++i) {
+            const int i1 = (i + 1) % 3;
+            const int i2 = (i + 2) % 3;
+            for (int j = 0; j < 3; ++j) {
+                const int j1 = (j + 1) % 3;
+                const int j2 = (j + 2) % 3;
+                const int k = 6 + i * 3 + j;
+                
+                // Cross product of edge i of this box with edge j of the other
+                radius[k] = a[i1] * absR[i2][j] + a[i2] * absR[i1][j] + b[j1] * absR[i][j2] + b[j2] * absR[i][j1];
+                distance[k] = std::abs(t[i2] * r[i1][j] - t[i1] * r[i2][j]);
+                length[k] = std::sqrt(std::max(0.0, 1.0 - r[i][j] * r[i][j]));
+            }
+        }
+        
+        int bestAxis = -1;
+        double bestOverlap = std::numeric_limits<double>::infinity();
+        for (int k = 0; k < kAxisCount; ++k) {
+            // Parallel edges have no cross product; the face axes already cover them
+            if (length[k] < kMinAxisLength) continue;
+            
+            double overlap = (radius[k] - distance[k]) / length[k];
+            if (overlap < -tolerance) return false;
+            if (overlap < bestOverlap) {
+                bestOverlap = overlap;
+                bestAxis = k;
+            }
+        }
+        
+        if (bestAxis < 3) {
+            axis = axes[bestAxis];
+        } else if (bestAxis < 6) {
+            axis = other.axes[bestAxis - 3];
+        } else {
+            axis = axes[(bestAxis - 6) / 3].cross(other.axes[(bestAxis - 6) % 3]) * (1.0 / length[bestAxis]);
+        }
+        
+        if (axis.dot(offset) > 0.0) {
+            axis = -axis;
+        }
+        depth = std::max(bestOverlap, 0.0);
+        
+        return true;
+    }
+
+private:
+    static constexpr int kAxisCount = 15;
+    static constexpr double kParallelEpsilon = 1e-12;
+    static constexpr double kMinAxisLength = 1e-6;
+};
+
+/**
+ * @brief First pair of boxes in the set that overlap and that the filter accepts
+ * 
+ * Sweeps the boxes along X, so only pairs whose X extents meet are tested
+ * exactly. Empty boxes overlap nothing.
+ * @param accept Called as accept(i, j) for each overlapping pair of indices
+ */
+template<typename PairFilter>
+std::optional<std::pair<size_t, size_t>> findOverlappingPair(std::span<const OrientedBoundingBox> boxes,
+                                                             double tolerance, PairFilter&& accept) {
+    std::vector<BoundingBox> bounds;
+    std::vector<size_t> order;
+    bounds.reserve(boxes.size());
+    order.reserve(boxes.size());
+    for (size_t i = 0; i < boxes.size(); ++i) {
+        bounds.push_back(boxes[i].bounds());
+        if (!boxes[i].isEmpty()) {
+            order.push_back(i);
+        }
+    }
+    std::sort(order.begin(), order.end(), [&](size_t a, size_t b) { return bounds[a].min.x < bounds[b].min.x; });
+    
+    for (size_t a = 0; a < order.size(); ++a) {
+        double reach = bounds[order[a]].max.x + tolerance;
+        for (size_t b = a + 1; b < order.size() && bounds[order[b]].min.x <= reach; ++b) {
+            if (boxes[order[a]].intersects(boxes[order[b]], tolerance) && accept(order[a], order[b])) {
+                return std::make_pair(order[a], order[b]);
+            }
+        }
+    }
+    return std::nullopt;
+}
+
+} // namespace Geometry
+} // namespace KitchenCAD
\ No newline at end of file
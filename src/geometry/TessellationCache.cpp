@@ -0,0 +1,135 @@
+#include "TessellationCache.h"
+#include <bit>
+
+namespace KitchenCAD {
+namespace Geometry {
+
+namespace {
+
+uint64_t bitsOf(double value) {
+    // Fold -0.0 into 0.0 so equal keys hash alike
+    return value == 0.0 ? 0 : std::bit_cast<uint64_t>(value);
+}
+
+uint64_t mix(uint64_t hash, uint64_t value) {
+    hash ^= value + 0x9E3779B97F4A7C15ULL + (hash << 6) + (hash >> 2);
+    return hash;
+}
+
+} // namespace
+
+TessellationCache::TessellationCache(size_t capacityBytes)
+    : capacity_(capacityBytes) {
+}
+
+TessellationCache& TessellationCache::instance() {
+    static TessellationCache cache;
+    return cache;
+}
+
+size_t TessellationCache::KeyHash::operator()(const Key& key) const {
+    uint64_t hash = mix(key.shapeHash, bitsOf(key.linearDeflection));
+    hash = mix(hash, bitsOf(key.angularDeflection));
+    return static_cast<size_t>(hash);
+}
+
+TessellationCache::MeshPtr TessellationCache::find(const Key& key) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    
+    auto it = lookup_.find(key);
+    if (it == lookup_.end()) {
+        ++stats_.misses;
+        return nullptr;
+    }
+    
+    ++stats_.hits;
+    entries_.splice(entries_.begin(), entries_, it->second);
+    return it->second->mesh;
+}
+
+TessellationCache::MeshPtr TessellationCache::insert(const Key& key, std::shared_ptr<TriangleMesh> mesh) {
+    if (!mesh) return nullptr;
+    
+    size_t bytes = mesh->getMemoryUsage();
+    MeshPtr shared = std::move(mesh);
+    
+    std::lock_guard<std::mutex> lock(mutex_);
+    
+    auto it = lookup_.find(key);
+    if (it != lookup_.end()) {
+        entries_.splice(entries_.begin(), entries_, it->second);
+        return it->second->mesh;
+    }
+    
+    if (bytes > capacity_) {
+        return shared;
+    }
+    
+    entries_.push_front(Entry{key, shared, bytes});
+    lookup_.emplace(key, entries_.begin());
+    memoryUsage_ += bytes;
+    ++stats_.insertions;
+    evictToCapacity();
+    
+    return shared;
+}
+
+TessellationCache::MeshPtr TessellationCache::getOrCreate(const Key& key,
+                                                          const std::function<std::shared_ptr<TriangleMesh>()>& factory) {
+    if (MeshPtr cached = find(key)) {
+        return cached;
+    }
+    
+    return insert(key, factory());
+}
+
+bool TessellationCache::contains(const Key& key) const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return lookup_.find(key) != lookup_.end();
+}
+
+void TessellationCache::setCapacity(size_t capacityBytes) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    capacity_ = capacityBytes;
+    evictToCapacity();
+}
+
+size_t TessellationCache::getCapacity() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return capacity_;
+}
+
+void TessellationCache::clear() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    entries_.clear();
+    lookup_.clear();
+    memoryUsage_ = 0;
+}
+
+TessellationCache::Statistics TessellationCache::getStatistics() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    
+    Statistics stats = stats_;
+    stats.entryCount = entries_.size();
+    stats.memoryUsage = memoryUsage_;
+    stats.capacity = capacity_;
+    return stats;
+}
+
+void TessellationCache::resetStatistics() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    stats_ = Statistics();
+}
+
+void TessellationCache::evictToCapacity() {
+    while (memoryUsage_ > capacity_ && !entries_.empty()) {
+        const Entry& oldest = entries_.back();
+        memoryUsage_ -= oldest.bytes;
+        lookup_.erase(oldest.key);
+        entries_.pop_back();
+        ++stats_.evictions;
+    }
+}
+
+} // namespace Geometry
+} // namespace KitchenCAD
\ No newline at end of file
@@ -0,0 +1,151 @@
+#pragma once
+
+#include "Point3D.h"
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+namespace KitchenCAD {
+namespace Geometry {
+
+/**
+ * @brief Indexed triangle mesh produced by tessellating a shape
+ * 
+ * Vertices are in the shape's local frame. Every three indices form one
+ * counter-clockwise triangle seen from outside the solid.
+ */
+struct TriangleMesh {
+    std::vector<Point3D> vertices;
+    std::vector<uint32_t> indices;
+    
+    size_t getTriangleCount() const { return indices.size() / 3; }
+    
+    bool isEmpty() const { return indices.empty(); }
+    
+    /**
+     * @brief Heap bytes held by the buffers, used to bound the cache
+     */
+    size_t getMemoryUsage() const {
+        return sizeof(TriangleMesh) + vertices.capacity() * sizeof(Point3D) + indices.capacity() * sizeof(uint32_t);
+    }
+};
+
+/**
+ * @brief Process-wide LRU cache of shape tessellations
+ * 
+ * Entries are keyed by a stable geometry hash of the shape together with the
+ * deflections it was meshed with, so identical cabinets share one mesh no
+ * matter how often they are placed or exported. Meshes are handed out as
+ * shared immutable buffers: evicting an entry never invalidates a mesh a
+ * caller still holds.
+ * 
+ * The cache is bounded by the memory its meshes use and drops the least
+ * recently used entries first. All methods are thread-safe.
+ */
+class TessellationCache {
+public:
+    static constexpr size_t kDefaultCapacityBytes = 64 * 1024 * 1024;
+    
+    struct Key {
+        uint64_t shapeHash = 0;
+        double linearDeflection = 0.0;
+        double angularDeflection = 0.0;
+        
+        bool operator==(const Key& other) const {
+            return shapeHash == other.shapeHash && linearDeflection == other.linearDeflection &&
+                   angularDeflection == other.angularDeflection;
+        }
+    };
+    
+    /**
+     * @brief Cache counters
+     */
+    struct Statistics {
+        size_t hits = 0;
+        size_t misses = 0;
+        size_t insertions = 0;
+        size_t evictions = 0;
+        size_t entryCount = 0;
+        size_t memoryUsage = 0;         // Bytes held by cached meshes
+        size_t capacity = 0;            // Bytes allowed before eviction
+        
+        double getHitRate() const {
+            size_t lookups = hits + misses;
+            return lookups > 0 ? static_cast<double>(hits) / lookups : 0.0;
+        }
+    };
+    
+    using MeshPtr = std::shared_ptr<const TriangleMesh>;
+    
+    explicit TessellationCache(size_t capacityBytes = kDefaultCapacityBytes);
+    
+    TessellationCache(const TessellationCache&) = delete;
+    TessellationCache& operator=(const TessellationCache&) = delete;
+    
+    /**
+     * @brief Cache shared by all geometry engines in the process
+     */
+    static TessellationCache& instance();
+    
+    /**
+     * @brief Cached mesh for the key, or nullptr; counts a hit or a miss
+     */
+    MeshPtr find(const Key& key);
+    
+    /**
+     * @brief Store a mesh and return the cached one
+     * 
+     * If another thread stored the same key first, its mesh is kept and
+     * returned. Meshes larger than the whole capacity are returned uncached.
+     */
+    MeshPtr insert(const Key& key, std::shared_ptr<TriangleMesh> mesh);
+    
+    /**
+     * @brief Cached mesh for the key, or the factory's mesh stored under it
+     * 
+     * The factory runs without the cache locked, so slow meshing does not
+     * block other lookups. It may return nullptr on failure, which is not
+     * cached.
+     */
+    MeshPtr getOrCreate(const Key& key, const std::function<std::shared_ptr<TriangleMesh>()>& factory);
+    
+    bool contains(const Key& key) const;
+    
+    void setCapacity(size_t capacityBytes);
+    size_t getCapacity() const;
+    
+    void clear();
+    
+    Statistics getStatistics() const;
+    void resetStatistics();
+
+private:
+    struct KeyHash {
+        size_t operator()(const Key& key) const;
+    };
+    
+    struct Entry {
+        Key key;
+        MeshPtr mesh;
+        size_t bytes;
+    };
+    
+    using EntryList = std::list<Entry>;
+    
+    void evictToCapacity();
+    
+    mutable std::mutex mutex_;
+    EntryList entries_;                 // Most recently used first
+    std::unordered_map<Key, EntryList::iterator, KeyHash> lookup_;
+    size_t capacity_;
+    size_t memoryUsage_ = 0;
+    Statistics stats_;
+};
+
+} // namespace Geometry
+} // namespace KitchenCAD
\ No newline at end of file
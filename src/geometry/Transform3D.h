@@ -4,6 +4,7 @@
 #include "Vector3D.h"
 #include "Matrix4x4.h"
 #include <cmath>
+#include <span>
 
 namespace KitchenCAD {
 namespace Geometry {
@@ -35,14 +36,26 @@ struct Transform3D {
     
     // Transform operations
     Matrix4x4 toMatrix() const {
-        // Create transformation matrix: T * R * S
-        Matrix4x4 scaleMatrix = Matrix4x4::scale(scale);
-        Matrix4x4 rotationMatrix = Matrix4x4::rotationX(rotation.x) *
-                                   Matrix4x4::rotationY(rotation.y) *
-                                   Matrix4x4::rotationZ(rotation.z);
-        Matrix4x4 translationMatrix = Matrix4x4::translation(Vector3D(translation.x, translation.y, translation.z));
+        // T * Rx * Ry * Rz * S written out, rather than four full matrix products
+        const double cx = std::cos(rotation.x), sx = std::sin(rotation.x);
+        const double cy = std::cos(rotation.y), sy = std::sin(rotation.y);
+        const double cz = std::cos(rotation.z), sz = std::sin(rotation.z);
         
-        return translationMatrix * rotationMatrix * scaleMatrix;
+        Matrix4x4 result;
+        result(0, 0) = cy * cz * scale.x;
+        result(0, 1) = -cy * sz * scale.y;
+        result(0, 2) = sy * scale.z;
+        result(1, 0) = (sx * sy * cz + cx * sz) * scale.x;
+        result(1, 1) = (cx * cz - sx * sy * sz) * scale.y;
+        result(1, 2) = -sx * cy * scale.z;
+        result(2, 0) = (sx * sz - cx * sy * cz) * scale.x;
+        result(2, 1) = (cx * sy * sz + sx * cz) * scale.y;
+        result(2, 2) = cx * cy * scale.z;
+        result(0, 3) = translation.x;
+        result(1, 3) = translation.y;
+        result(2, 3) = translation.z;
+        
+        return result;
     }
     
     Transform3D inverse() const {
@@ -95,6 +108,13 @@ struct Transform3D {
         return toMatrix().transformVector(vector);
     }
     
+    /**
+     * @brief Transform points in place, building the matrix once for the batch
+     */
+    void transformPoints(std::span<Point3D> points) const {
+        toMatrix().transformPoints(points);
+    }
+    
     // Utility methods
     void setTranslation(const Point3D& newTranslation) {
         translation = newTranslation;
@@ -3,15 +3,15 @@
 #include "../geometry/Point3D.h"
 #include "../geometry/Vector3D.h"
 #include "../geometry/BoundingBox.h"
+#include "../core/Shape3D.h"
+#include "../utils/ThreadPool.h"
 #include <memory>
+#include <span>
+#include <utility>
 #include <vector>
 
 namespace KitchenCAD {
 
-// Forward declarations
-class Shape3D;
-class Face;
-
 /**
  * @brief Enumeration of boolean operations for geometry
  */
@@ -21,6 +21,20 @@ enum class BooleanOperation {
     Intersection
 };
 
+/**
+ * @brief Properties of one shape computed by a batch query
+ */
+struct ShapeProperties {
+    double volume = 0.0;
+    double surfaceArea = 0.0;
+    Geometry::BoundingBox boundingBox;
+};
+
+/**
+ * @brief Two shapes tested against each other by a batch query
+ */
+using ShapePair = std::pair<const Shape3D*, const Shape3D*>;
+
 /**
  * @brief Interface for geometric engine operations
  * 
@@ -48,6 +62,22 @@ public:
     // Boolean operations
     virtual bool performBoolean(Shape3D& target, const Shape3D& tool, BooleanOperation op) = 0;
     
+    /**
+     * @brief Apply op between target and every tool, e.g. cut all openings from a wall
+     * 
+     * Implementations may fuse the tools into one multi-argument boolean. The
+     * default applies them one at a time and stops at the first failure, which
+     * may leave target partly modified.
+     * 
+     * @return true if every tool was applied; true for an empty tool list
+     */
+    virtual bool performBooleanBatch(Shape3D& target, std::span<const Shape3D* const> tools, BooleanOperation op) {
+        for (const Shape3D* tool : tools) {
+            if (!performBoolean(target, *tool, op)) return false;
+        }
+        return true;
+    }
+    
     // Geometric analysis
     virtual std::vector<Face> getFaces(const Shape3D& shape) = 0;
     virtual Geometry::BoundingBox getBoundingBox(const Shape3D& shape) = 0;
@@ -65,6 +95,61 @@ public:
     // Validation
     virtual bool isValidShape(const Shape3D& shape) = 0;
     virtual bool isClosed(const Shape3D& shape) = 0;
+    
+    // Batch queries
+    //
+    // Results are in input order. The defaults spread the per-shape calls over
+    // the pool, so implementations must allow those calls to run concurrently
+    // on different shapes. A shape may appear in several pairs but should
+    // appear only once in a computeProperties batch. Overriding one overload
+    // needs a using-declaration to keep the other visible.
+    
+    virtual std::vector<ShapeProperties> computeProperties(std::span<const Shape3D* const> shapes,
+                                                           Utils::ThreadPool& pool) {
+        std::vector<ShapeProperties> results(shapes.size());
+        pool.parallelFor(shapes.size(), [&](size_t begin, size_t end) {
+            for (size_t i = begin; i < end; ++i) {
+                results[i].volume = getVolume(*shapes[i]);
+                results[i].surfaceArea = getSurfaceArea(*shapes[i]);
+                results[i].boundingBox = getBoundingBox(*shapes[i]);
+            }
+        });
+        return results;
+    }
+    
+    virtual std::vector<bool> intersectsPairs(std::span<const ShapePair> pairs, Utils::ThreadPool& pool) {
+        // std::vector<bool> packs bits, so threads write bytes and convert at the end
+        std::vector<char> hits(pairs.size(), 0);
+        pool.parallelFor(pairs.size(), [&](size_t begin, size_t end) {
+            for (size_t i = begin; i < end; ++i) {
+                hits[i] = intersects(*pairs[i].first, *pairs[i].second) ? 1 : 0;
+            }
+        });
+        return std::vector<bool>(hits.begin(), hits.end());
+    }
+    
+    virtual std::vector<double> distancesBetween(std::span<const ShapePair> pairs, Utils::ThreadPool& pool) {
+        std::vector<double> distances(pairs.size(), 0.0);
+        pool.parallelFor(pairs.size(), [&](size_t begin, size_t end) {
+            for (size_t i = begin; i < end; ++i) {
+                distances[i] = distanceBetween(*pairs[i].first, *pairs[i].second);
+            }
+        });
+        return distances;
+    }
+    
+    // Batch queries on the process-wide pool
+    std::vector<ShapeProperties> computeProperties(std::span<const Shape3D* const> shapes) {
+        return computeProperties(shapes, Utils::ThreadPool::shared());
+    }
+    
+    std::vector<bool> intersectsPairs(std::span<const ShapePair> pairs) {
+        return intersectsPairs(pairs, Utils::ThreadPool::shared());
+    }
+    
+    std::vector<double> distancesBetween(std::span<const ShapePair> pairs) {
+        return distancesBetween(pairs, Utils::ThreadPool::shared());
+    }
 };
 
 } // namespace KitchenCAD
\ No newline at end of file
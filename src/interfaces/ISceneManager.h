@@ -4,9 +4,12 @@
 #include "../geometry/Vector3D.h"
 #include "../geometry/BoundingBox.h"
 #include "../geometry/Transform3D.h"
+#include <limits>
 #include <memory>
 #include <vector>
+#include <span>
 #include <string>
+#include <utility>
 #include <functional>
 
 namespace KitchenCAD {
@@ -22,6 +25,37 @@ using SceneObject = Models::SceneObject;
  */
 using ObjectId = std::string;
 
+/**
+ * @brief Target transform for one object in a batched move
+ */
+using ObjectTransform = std::pair<ObjectId, Geometry::Transform3D>;
+
+/**
+ * @brief Outcome of sweeping an object from one transform towards another
+ */
+struct SweepResult {
+    bool collided = false;              // Stopped before reaching the target
+    double timeOfImpact = 1.0;          // Collision-free fraction of the move, in [0, 1]
+    Geometry::Transform3D transform;    // Furthest collision-free transform
+    ObjectId blockingObject;            // First object hit, empty if none
+};
+
+/**
+ * @brief Net effect of the object changes made during a batch
+ * 
+ * Each object appears in at most one list. An object added and then modified
+ * is only reported as added, one added and removed again is not reported, and
+ * one removed and added again under the same id is reported as modified.
+ * Ids keep the order in which they were first changed.
+ */
+struct SceneChangeSet {
+    std::vector<ObjectId> added;
+    std::vector<ObjectId> removed;
+    std::vector<ObjectId> modified;
+    
+    bool empty() const { return added.empty() && removed.empty() && modified.empty(); }
+};
+
 /**
  * @brief Interface for managing objects in the 3D scene
  * 
@@ -35,9 +69,29 @@ public:
     // Object management
     virtual ObjectId addObject(std::unique_ptr<SceneObject> object) = 0;
     virtual bool removeObject(const ObjectId& id) = 0;
+    
+    /**
+     * @brief Mutable access to an object
+     * 
+     * Edits made through the pointer are not seen by the scene: they reach
+     * neither indexes, change notifications nor snapshots. Use modifyObject()
+     * or the transform methods to change an object.
+     */
     virtual SceneObject* getObject(const ObjectId& id) = 0;
     virtual const SceneObject* getObject(const ObjectId& id) const = 0;
     
+    /**
+     * @brief Edit an object and record the change
+     * 
+     * The edit runs with the scene locked and must not call back into it or
+     * change the object's id. Afterwards bounds, attribute indexes, versions
+     * and snapshots are updated and a modification is reported. Unlike
+     * moveObject() the edit is not rejected if it creates a collision.
+     * 
+     * @return false if the object does not exist
+     */
+    virtual bool modifyObject(const ObjectId& id, const std::function<void(SceneObject&)>& edit) = 0;
+    
     // Object queries
     virtual std::vector<ObjectId> getAllObjects() const = 0;
     virtual std::vector<ObjectId> getObjectsInRegion(const Geometry::BoundingBox& region) const = 0;
@@ -47,14 +101,45 @@ public:
     // Spatial queries
     virtual std::vector<ObjectId> findIntersectingObjects(const ObjectId& objectId) const = 0;
     virtual std::vector<ObjectId> findNearbyObjects(const ObjectId& objectId, double radius) const = 0;
+    
+    /**
+     * @brief Find up to k objects nearest to a point, nearest first
+     * 
+     * Distance is measured to each object's bounding box, so objects
+     * containing the point are at distance zero. Objects further away than
+     * maxDistance are not returned.
+     */
+    virtual std::vector<ObjectId> findNearestObjects(const Geometry::Point3D& point, size_t k,
+                                                     double maxDistance = std::numeric_limits<double>::infinity()) const = 0;
     virtual bool checkCollision(const ObjectId& objectId, const Geometry::Transform3D& newTransform) const = 0;
     
+    /**
+     * @brief Sweep an object's bounds along a move and stop at the first object in the way
+     * 
+     * Unlike checkCollision() this tests the whole path, so a fast drag cannot
+     * tunnel through a wall. Objects already within the collision tolerance
+     * of the object at the start are ignored so it can be dragged free. A
+     * blocked move stops just beyond the tolerance, so checkCollision() and
+     * moveObject() accept the returned transform.
+     */
+    virtual SweepResult checkSweptCollision(const ObjectId& objectId, const Geometry::Transform3D& fromTransform,
+                                            const Geometry::Transform3D& toTransform) const = 0;
+    
     // Object transformation
     virtual bool moveObject(const ObjectId& id, const Geometry::Transform3D& transform) = 0;
     virtual bool translateObject(const ObjectId& id, const Geometry::Vector3D& translation) = 0;
     virtual bool rotateObject(const ObjectId& id, const Geometry::Vector3D& rotation) = 0;
     virtual bool scaleObject(const ObjectId& id, const Geometry::Vector3D& scale) = 0;
     
+    /**
+     * @brief Move several objects as one operation
+     * 
+     * All transforms are applied under a single lock and reported through one
+     * objects-modified event. The batch is all-or-nothing: it is rejected if an
+     * object does not exist or would collide with an object outside the batch.
+     */
+    virtual bool applyTransforms(std::span<const ObjectTransform> transforms) = 0;
+    
     // Selection management
     virtual void setSelection(const std::vector<ObjectId>& selection) = 0;
     virtual void addToSelection(const ObjectId& id) = 0;
@@ -73,17 +158,92 @@ public:
     virtual std::unique_ptr<SceneObject> duplicateObject(const ObjectId& id) = 0;
     
     // Iteration support
+    
+    /**
+     * @brief Visit the live objects with the scene locked
+     * 
+     * Callbacks see the objects themselves, not copies, and must not call
+     * back into the scene. Callers that need to query the scene while
+     * visiting can iterate a SceneManager snapshot instead.
+     */
     virtual void forEachObject(std::function<void(const ObjectId&, SceneObject*)> callback) = 0;
     virtual void forEachObject(std::function<void(const ObjectId&, const SceneObject*)> callback) const = 0;
     
     // Event callbacks (for notifications)
     using ObjectCallback = std::function<void(const ObjectId&)>;
     using SelectionCallback = std::function<void(const std::vector<ObjectId>&)>;
+    using ObjectsCallback = std::function<void(const std::vector<ObjectId>&)>;
     
     virtual void setObjectAddedCallback(ObjectCallback callback) = 0;
     virtual void setObjectRemovedCallback(ObjectCallback callback) = 0;
     virtual void setObjectModifiedCallback(ObjectCallback callback) = 0;
+    
+    /**
+     * @brief Set callback for batched modifications
+     * 
+     * When unset, batched modifications are reported per object through the
+     * object-modified callback instead.
+     */
+    virtual void setObjectsModifiedCallback(ObjectsCallback callback) = 0;
     virtual void setSelectionChangedCallback(SelectionCallback callback) = 0;
+    
+    // Change batching
+    using ChangeSetCallback = std::function<void(const SceneChangeSet&)>;
+    
+    /**
+     * @brief Set callback receiving object changes as one change set
+     * 
+     * When set it replaces the added, removed and modified callbacks: changes
+     * made outside a batch arrive as single-entry sets, and each batch arrives
+     * as one coalesced set. Object events are delivered with the scene
+     * unlocked, so subscribers may query it.
+     */
+    virtual void setChangeSetCallback(ChangeSetCallback callback) = 0;
+    
+    /**
+     * @brief Start collecting object change notifications
+     * 
+     * Batches nest; nothing is delivered until the outermost endBatch().
+     */
+    virtual void beginBatch() = 0;
+    
+    /**
+     * @brief Close a batch, delivering the coalesced changes when it is the outermost
+     * 
+     * Without a change set callback the net changes are replayed through the
+     * per-object callbacks, removals first.
+     */
+    virtual void endBatch() = 0;
+    
+    /**
+     * @brief Batch changes until the host's next event loop iteration
+     * 
+     * The scheduler is called once when the first change arrives outside a
+     * batch, after the change has released the scene; it should post
+     * flushChanges() to the event loop and return. Pass nullptr to deliver
+     * changes immediately again.
+     */
+    virtual void setChangeFlushScheduler(std::function<void()> scheduler) = 0;
+    
+    /**
+     * @brief Deliver changes collected since the flush was scheduled
+     */
+    virtual void flushChanges() = 0;
+};
+
+/**
+ * @brief Keeps a scene batch open for the lifetime of the scope
+ */
+class SceneChangeBatch {
+public:
+    explicit SceneChangeBatch(ISceneManager& scene) : scene_(scene) { scene_.beginBatch(); }
+    ~SceneChangeBatch() { scene_.endBatch(); }
+    
+    SceneChangeBatch(const SceneChangeBatch&) = delete;
+    SceneChangeBatch& operator=(const SceneChangeBatch&) = delete;
+    
+private:
+    ISceneManager& scene_;
 };
 
 } // namespace KitchenCAD
\ No newline at end of file
@@ -12,6 +12,7 @@ namespace KitchenCAD {
 // Forward declarations
 namespace Models { class SceneObject; }
 namespace Scene { class SceneManager; }
+class ISceneManager;
 using SceneObject = Models::SceneObject;
 using SceneManager = Scene::SceneManager;
 namespace Models { class Project; }
@@ -51,14 +52,14 @@ struct ValidationError {
  * @brief Validation context for providing additional information during validation
  */
 struct ValidationContext {
-    const SceneManager* sceneManager = nullptr;
+    const ISceneManager* sceneManager = nullptr;
     const Models::Project* project = nullptr;
     bool enableStrictMode = false;
     double toleranceDistance = 0.001; // 1mm tolerance
     double minClearance = 0.05; // 5cm minimum clearance
     
     ValidationContext() = default;
-    ValidationContext(const SceneManager* scene, const Models::Project* proj = nullptr)
+    ValidationContext(const ISceneManager* scene, const Models::Project* proj = nullptr)
         : sceneManager(scene), project(proj) {}
 };
 
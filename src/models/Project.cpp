@@ -25,20 +25,21 @@ json SceneObject::toJson() const {
     j["catalogItemId"] = catalogItemId_;
     
     // Transform
+    const Transform3D& transform = transform_.get();
     j["transform"]["translation"] = {
-        {"x", transform_.translation.x},
-        {"y", transform_.translation.y},
-        {"z", transform_.translation.z}
+        {"x", transform.translation.x},
+        {"y", transform.translation.y},
+        {"z", transform.translation.z}
     };
     j["transform"]["rotation"] = {
-        {"x", transform_.rotation.x},
-        {"y", transform_.rotation.y},
-        {"z", transform_.rotation.z}
+        {"x", transform.rotation.x},
+        {"y", transform.rotation.y},
+        {"z", transform.rotation.z}
     };
     j["transform"]["scale"] = {
-        {"x", transform_.scale.x},
-        {"y", transform_.scale.y},
-        {"z", transform_.scale.z}
+        {"x", transform.scale.x},
+        {"y", transform.scale.y},
+        {"z", transform.scale.z}
     };
     
     // Material
@@ -71,18 +72,20 @@ void SceneObject::fromJson(const json& j) {
     // Transform
     if (j.contains("transform")) {
         const auto& t = j["transform"];
+        Transform3D transform = transform_.get();
         if (t.contains("translation")) {
             const auto& trans = t["translation"];
-            transform_.translation = Point3D(trans["x"], trans["y"], trans["z"]);
+            transform.translation = Point3D(trans["x"], trans["y"], trans["z"]);
         }
         if (t.contains("rotation")) {
             const auto& rot = t["rotation"];
-            transform_.rotation = Vector3D(rot["x"], rot["y"], rot["z"]);
+            transform.rotation = Vector3D(rot["x"], rot["y"], rot["z"]);
         }
         if (t.contains("scale")) {
             const auto& scl = t["scale"];
-            transform_.scale = Vector3D(scl["x"], scl["y"], scl["z"]);
+            transform.scale = Vector3D(scl["x"], scl["y"], scl["z"]);
         }
+        setTransform(transform);
     }
     
     // Material
@@ -399,7 +402,7 @@ void Project::fromJson(const json& j) {
     objects_.clear();
     if (j.contains("objects")) {
         for (const auto& objJson : j["objects"]) {
-            auto object = std::make_unique<SceneObject>();
+            auto object = createObject();
             object->fromJson(objJson);
             objects_.push_back(std::move(object));
         }
@@ -487,7 +490,7 @@ void Project::loadSceneFromJson(const json& sceneJson) {
     // Load objects
     if (sceneJson.contains("objects")) {
         for (const auto& objJson : sceneJson["objects"]) {
-            auto object = std::make_unique<SceneObject>();
+            auto object = createObject();
             object->fromJson(objJson);
             objects_.push_back(std::move(object));
         }
@@ -8,7 +8,9 @@
 #include "../geometry/Vector3D.h"
 #include "../geometry/BoundingBox.h"
 #include "../geometry/Transform3D.h"
+#include "../geometry/CachedTransform3D.h"
 #include "../interfaces/IProjectRepository.h"
+#include "SceneObjectPool.h"
 
 #include <nlohmann/json.hpp>
 
@@ -17,6 +19,8 @@ namespace Models {
 
 using namespace Geometry;
 
+class ShapePrototype;
+
 /**
  * @brief Room dimensions structure
  */
@@ -130,7 +134,8 @@ class SceneObject {
 protected:
     std::string id_;
     std::string catalogItemId_;
-    Transform3D transform_;
+    Geometry::CachedTransform3D transform_;
+    std::shared_ptr<const ShapePrototype> shapePrototype_;  // Shared solid geometry, if any
     MaterialProperties material_;
     std::string customProperties_; // JSON string for additional properties
     
@@ -139,6 +144,10 @@ public:
     SceneObject(const std::string& catalogItemId);
     virtual ~SceneObject() = default;
     
+    // Storage comes from the thread's current SceneObjectPool when one is installed
+    static void* operator new(std::size_t size) { return SceneObjectPool::allocate(SceneObjectPool::current(), size); }
+    static void operator delete(void* ptr) noexcept { SceneObjectPool::deallocate(ptr); }
+    
     // Basic properties
     const std::string& getId() const { return id_; }
     void setId(const std::string& id) { id_ = id; }
@@ -146,8 +155,27 @@ public:
     const std::string& getCatalogItemId() const { return catalogItemId_; }
     void setCatalogItemId(const std::string& id) { catalogItemId_ = id; }
     
-    const Transform3D& getTransform() const { return transform_; }
-    void setTransform(const Transform3D& transform) { transform_ = transform; }
+    const Transform3D& getTransform() const { return transform_.get(); }
+    
+    // Scenes read objects concurrently under a shared lock, so the world
+    // matrix is brought up to date here rather than on first read
+    void setTransform(const Transform3D& transform) { transform_.set(transform); transform_.matrix(); }
+    void setTransform(const Geometry::CachedTransform3D& transform) { transform_ = transform; transform_.matrix(); }
+    
+    /**
+     * @brief World matrix of the current transform, built once per change
+     */
+    const Geometry::Matrix4x4& getWorldMatrix() const { return transform_.matrix(); }
+    
+    /**
+     * @brief Shared shape of this object's catalog item, placed by the transform
+     * 
+     * Set it before adding the object to a scene; scene bounds use the
+     * prototype's extents instead of a unit box. Not serialized: the
+     * prototype is looked up again from the catalog after loading.
+     */
+    const std::shared_ptr<const ShapePrototype>& getShapePrototype() const { return shapePrototype_; }
+    void setShapePrototype(std::shared_ptr<const ShapePrototype> prototype) { shapePrototype_ = std::move(prototype); }
     
     const MaterialProperties& getMaterial() const { return material_; }
     void setMaterial(const MaterialProperties& material) { material_ = material; }
@@ -177,6 +205,9 @@ private:
     std::vector<Opening> openings_;
     std::string thumbnailPath_;
     
+    // Backing store for objects_; shared with the scene manager while the project is open
+    std::shared_ptr<SceneObjectPool> objectPool_ = SceneObjectPool::create();
+    
     // Timestamps
     std::chrono::system_clock::time_point createdAt_;
     std::chrono::system_clock::time_point updatedAt_;
@@ -221,6 +252,19 @@ public:
     const SceneObject* getObject(const std::string& objectId) const;
     size_t getObjectCount() const { return objects_.size(); }
     
+    /**
+     * @brief Construct a SceneObject in this project's object pool
+     * 
+     * The object is not added to the project.
+     */
+    template<typename... Args>
+    std::unique_ptr<SceneObject> createObject(Args&&... args) const {
+        SceneObjectPool::Scope scope(objectPool_);
+        return std::make_unique<SceneObject>(std::forward<Args>(args)...);
+    }
+    
+    const std::shared_ptr<SceneObjectPool>& getObjectPool() const { return objectPool_; }
+    
     // Wall management
     const std::vector<Wall>& getWalls() const { return walls_; }
     void addWall(const Wall& wall);
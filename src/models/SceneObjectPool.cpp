@@ -0,0 +1,138 @@
+#include "SceneObjectPool.h"
+#include "Project.h"
+#include <new>
+
+namespace KitchenCAD {
+namespace Models {
+
+namespace {
+
+thread_local SceneObjectPool* currentPool = nullptr;
+
+constexpr size_t roundUp(size_t value, size_t alignment) {
+    return (value + alignment - 1) / alignment * alignment;
+}
+
+} // namespace
+
+SceneObjectPool::Scope::Scope(const std::shared_ptr<SceneObjectPool>& pool)
+    : previous_(currentPool) {
+    currentPool = pool.get();
+}
+
+SceneObjectPool::Scope::~Scope() {
+    currentPool = previous_;
+}
+
+std::shared_ptr<SceneObjectPool> SceneObjectPool::create() {
+    // The deleter only drops the owner's claim; live objects keep the pool alive
+    return std::shared_ptr<SceneObjectPool>(new SceneObjectPool(sizeof(SceneObject)),
+                                            [](SceneObjectPool* pool) { pool->release(); });
+}
+
+SceneObjectPool::SceneObjectPool(size_t objectSize)
+    : blockSize_(sizeof(BlockHeader) + roundUp(objectSize, alignof(std::max_align_t)))
+    , freeList_(nullptr)
+    , released_(false) {
+}
+
+SceneObjectPool::~SceneObjectPool() = default;
+
+SceneObjectPool* SceneObjectPool::current() {
+    return currentPool;
+}
+
+void* SceneObjectPool::allocate(SceneObjectPool* pool, size_t size) {
+    if (pool && sizeof(BlockHeader) + size <= pool->blockSize_) {
+        return pool->allocateBlock();
+    }
+    
+    auto* header = static_cast<BlockHeader*>(::operator new(sizeof(BlockHeader) + size));
+    header->pool = nullptr;
+    return header + 1;
+}
+
+void SceneObjectPool::deallocate(void* ptr) noexcept {
+    if (!ptr) return;
+    
+    BlockHeader* header = static_cast<BlockHeader*>(ptr) - 1;
+    if (header->pool) {
+        header->pool->deallocateBlock(header);
+    } else {
+        ::operator delete(header);
+    }
+}
+
+SceneObjectPool::Statistics SceneObjectPool::getStatistics() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return stats_;
+}
+
+void* SceneObjectPool::allocateBlock() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    
+    if (!freeList_) {
+        addSlab();
+    }
+    
+    FreeBlock* block = freeList_;
+    freeList_ = block->next;
+    ++stats_.allocations;
+    ++stats_.liveObjects;
+    
+    auto* header = reinterpret_cast<BlockHeader*>(block);
+    header->pool = this;
+    return header + 1;
+}
+
+void SceneObjectPool::deallocateBlock(BlockHeader* header) noexcept {
+    bool destroy = false;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        
+        auto* block = reinterpret_cast<FreeBlock*>(header);
+        block->next = freeList_;
+        freeList_ = block;
+        ++stats_.deallocations;
+        --stats_.liveObjects;
+        destroy = released_ && stats_.liveObjects == 0;
+    }
+    
+    if (destroy) {
+        delete this;
+    }
+}
+
+void SceneObjectPool::addSlab() {
+    const size_t slabBytes = blockSize_ * kBlocksPerSlab;
+    
+    // Default operator new[] aligns to max_align_t, which blockSize_ is a multiple of
+    slabs_.push_back(std::make_unique_for_overwrite<std::byte[]>(slabBytes));
+    std::byte* slab = slabs_.back().get();
+    
+    // Thread the new blocks onto the free list in address order
+    for (size_t i = kBlocksPerSlab; i-- > 0;) {
+        auto* block = reinterpret_cast<FreeBlock*>(slab + i * blockSize_);
+        block->next = freeList_;
+        freeList_ = block;
+    }
+    
+    ++stats_.slabCount;
+    stats_.reservedBytes += slabBytes;
+}
+
+void SceneObjectPool::release() noexcept {
+    bool destroy = false;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        released_ = true;
+        destroy = stats_.liveObjects == 0;
+    }
+    
+    if (destroy) {
+        delete this;
+    }
+}
+
+} // namespace Models
+} // namespace KitchenCAD
\ No newline at end of file
@@ -0,0 +1,120 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace KitchenCAD {
+namespace Models {
+
+/**
+ * @brief Slab allocator for SceneObject instances
+ * 
+ * Objects are carved from slabs of fixed-size blocks and recycled through an
+ * intrusive free list, so loading or clearing a large project touches the
+ * global heap once per slab instead of once per object. Addresses are stable:
+ * slabs never move and are only returned to the heap when the pool is
+ * destroyed.
+ * 
+ * Allocation is routed by SceneObject::operator new to the pool installed with
+ * a Scope on the current thread; without one objects come from the global
+ * heap as before. Every block records its pool, so an object may be destroyed
+ * anywhere, and the pool stays alive until both its owner has released it and
+ * its last object is gone.
+ */
+class SceneObjectPool {
+public:
+    static constexpr size_t kBlocksPerSlab = 256;
+    
+    /**
+     * @brief Allocation counters
+     */
+    struct Statistics {
+        size_t allocations = 0;         // Blocks handed out since creation
+        size_t deallocations = 0;       // Blocks returned since creation
+        size_t liveObjects = 0;         // Blocks currently in use
+        size_t slabCount = 0;           // Slabs obtained from the global heap
+        size_t reservedBytes = 0;       // Bytes held in slabs
+    };
+    
+    /**
+     * @brief Makes a pool the allocation target for SceneObjects on this thread
+     */
+    class Scope {
+    public:
+        explicit Scope(const std::shared_ptr<SceneObjectPool>& pool);
+        ~Scope();
+        
+        Scope(const Scope&) = delete;
+        Scope& operator=(const Scope&) = delete;
+        
+    private:
+        SceneObjectPool* previous_;
+    };
+    
+    /**
+     * @brief Create a pool sized for SceneObject
+     */
+    static std::shared_ptr<SceneObjectPool> create();
+    
+    SceneObjectPool(const SceneObjectPool&) = delete;
+    SceneObjectPool& operator=(const SceneObjectPool&) = delete;
+    
+    /**
+     * @brief Pool installed on this thread, or nullptr
+     */
+    static SceneObjectPool* current();
+    
+    /**
+     * @brief Allocate storage for an object of the given size
+     * 
+     * Sizes larger than a block (subclasses with extra members) and calls with
+     * no pool go to the global heap. The returned pointer is suitably aligned
+     * for any object.
+     */
+    static void* allocate(SceneObjectPool* pool, size_t size);
+    
+    /**
+     * @brief Release storage obtained from allocate
+     */
+    static void deallocate(void* ptr) noexcept;
+    
+    Statistics getStatistics() const;
+    
+    size_t getBlockSize() const { return blockSize_; }
+
+private:
+    // Written in front of every object so deallocation can find its pool
+    struct alignas(std::max_align_t) BlockHeader {
+        SceneObjectPool* pool;
+    };
+    
+    struct FreeBlock {
+        FreeBlock* next;
+    };
+    
+    explicit SceneObjectPool(size_t objectSize);
+    ~SceneObjectPool();
+    
+    void* allocateBlock();
+    void deallocateBlock(BlockHeader* header) noexcept;
+    void addSlab();
+    
+    /**
+     * @brief Called when the owning shared_ptr lets go
+     */
+    void release() noexcept;
+    
+    size_t blockSize_;                  // Header plus object storage
+    
+    mutable std::mutex mutex_;
+    std::vector<std::unique_ptr<std::byte[]>> slabs_;
+    FreeBlock* freeList_;
+    Statistics stats_;
+    bool released_;
+};
+
+} // namespace Models
+} // namespace KitchenCAD
\ No newline at end of file
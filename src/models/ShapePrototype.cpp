@@ -0,0 +1,167 @@
+#include "ShapePrototype.h"
+#include "../interfaces/IGeometryEngine.h"
+#include "../utils/Logger.h"
+#include <cmath>
+#include <cstdint>
+#include <sstream>
+
+namespace KitchenCAD {
+namespace Models {
+
+namespace {
+
+constexpr double kDimensionResolution = 1e-6;
+
+int64_t quantize(double value) {
+    return std::llround(value / kDimensionResolution);
+}
+
+void mixHash(size_t& hash, size_t value) {
+    hash ^= value + 0x9E3779B97F4A7C15ULL + (hash << 6) + (hash >> 2);
+}
+
+} // namespace
+
+// ShapePrototypeKey implementation
+bool ShapePrototypeKey::operator==(const ShapePrototypeKey& other) const {
+    return catalogItemId == other.catalogItemId &&
+           quantize(dimensions.width) == quantize(other.dimensions.width) &&
+           quantize(dimensions.height) == quantize(other.dimensions.height) &&
+           quantize(dimensions.depth) == quantize(other.dimensions.depth);
+}
+
+std::string ShapePrototypeKey::toString() const {
+    std::ostringstream stream;
+    stream << catalogItemId << " " << dimensions.width << "x" << dimensions.height << "x" << dimensions.depth;
+    return stream.str();
+}
+
+size_t ShapePrototypeKeyHash::operator()(const ShapePrototypeKey& key) const {
+    size_t hash = std::hash<std::string>()(key.catalogItemId);
+    mixHash(hash, static_cast<size_t>(quantize(key.dimensions.width)));
+    mixHash(hash, static_cast<size_t>(quantize(key.dimensions.height)));
+    mixHash(hash, static_cast<size_t>(quantize(key.dimensions.depth)));
+    return hash;
+}
+
+// ShapePrototype implementation
+ShapePrototype::ShapePrototype(const ShapePrototypeKey& key, std::unique_ptr<Shape3D> shape)
+    : key_(key)
+    , shape_(std::move(shape))
+    , volume_(shape_->getVolume())
+    , surfaceArea_(shape_->getSurfaceArea())
+    , localBounds_(shape_->getBoundingBox()) {
+}
+
+double ShapePrototype::getVolume(const Geometry::Transform3D& transform) const {
+    const Geometry::Vector3D& scale = transform.scale;
+    return volume_ * std::abs(scale.x * scale.y * scale.z);
+}
+
+double ShapePrototype::getSurfaceArea(const Geometry::Transform3D& transform) const {
+    double sx = std::abs(transform.scale.x);
+    double sy = std::abs(transform.scale.y);
+    double sz = std::abs(transform.scale.z);
+    
+    if (std::abs(sx - sy) < 1e-9 && std::abs(sy - sz) < 1e-9) {
+        return surfaceArea_ * sx * sx;
+    }
+    
+    auto placed = instantiate(transform);
+    return placed ? placed->getSurfaceArea() : 0.0;
+}
+
+Geometry::BoundingBox ShapePrototype::getBoundingBox(const Geometry::Matrix4x4& worldMatrix) const {
+    return localBounds_.transformed(worldMatrix);
+}
+
+std::unique_ptr<Shape3D> ShapePrototype::instantiate(const Geometry::Transform3D& transform) const {
+    return shape_->transformed(transform);
+}
+
+// ShapePrototypeRegistry implementation
+ShapePrototypeRegistry::ShapePrototypeRegistry(Builder builder)
+    : builder_(std::move(builder)) {
+}
+
+ShapePrototypeRegistry::Builder ShapePrototypeRegistry::boxBuilder(IGeometryEngine& engine) {
+    return [&engine](const ShapePrototypeKey& key) {
+        return engine.createBox(Geometry::Point3D(0.0, 0.0, 0.0), key.dimensions.width,
+                                key.dimensions.height, key.dimensions.depth);
+    };
+}
+
+std::shared_ptr<const ShapePrototype> ShapePrototypeRegistry::acquire(const ShapePrototypeKey& key) {
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        auto it = prototypes_.find(key);
+        if (it != prototypes_.end()) {
+            ++stats_.hits;
+            return it->second;
+        }
+    }
+    
+    if (!key.dimensions.isValid()) {
+        LOG_WARNING("Cannot build shape prototype with invalid dimensions: " + key.toString());
+        return nullptr;
+    }
+    
+    std::unique_ptr<Shape3D> shape = builder_ ? builder_(key) : nullptr;
+    
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (!shape) {
+        ++stats_.failedBuilds;
+        LOG_ERROR("Failed to build shape prototype: " + key.toString());
+        return nullptr;
+    }
+    ++stats_.builds;
+    
+    // Another thread may have registered the key while this one was building
+    auto [it, inserted] = prototypes_.try_emplace(key, nullptr);
+    if (inserted) {
+        it->second = std::make_shared<const ShapePrototype>(key, std::move(shape));
+        LOG_DEBUG("Registered shape prototype: " + key.toString());
+    }
+    return it->second;
+}
+
+std::shared_ptr<const ShapePrototype> ShapePrototypeRegistry::find(const ShapePrototypeKey& key) const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto it = prototypes_.find(key);
+    return it != prototypes_.end() ? it->second : nullptr;
+}
+
+size_t ShapePrototypeRegistry::purgeUnused() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    
+    size_t removed = 0;
+    for (auto it = prototypes_.begin(); it != prototypes_.end();) {
+        if (it->second.use_count() == 1) {
+            it = prototypes_.erase(it);
+            ++removed;
+        } else {
+            ++it;
+        }
+    }
+    return removed;
+}
+
+void ShapePrototypeRegistry::clear() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    prototypes_.clear();
+}
+
+size_t ShapePrototypeRegistry::size() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return prototypes_.size();
+}
+
+ShapePrototypeRegistry::Statistics ShapePrototypeRegistry::getStatistics() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    Statistics stats = stats_;
+    stats.prototypeCount = prototypes_.size();
+    return stats;
+}
+
+} // namespace Models
+} // namespace KitchenCAD
\ No newline at end of file
@@ -0,0 +1,172 @@
+#pragma once
+
+#include "CatalogItem.h"
+#include "../core/Shape3D.h"
+#include "../geometry/BoundingBox.h"
+#include "../geometry/Matrix4x4.h"
+#include "../geometry/Transform3D.h"
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+
+namespace KitchenCAD {
+
+class IGeometryEngine;
+
+namespace Models {
+
+/**
+ * @brief Identifies one shape: a catalog item built at given dimensions
+ * 
+ * Dimensions are compared at micrometre resolution so values that went
+ * through unit conversions still find the same prototype.
+ */
+struct ShapePrototypeKey {
+    std::string catalogItemId;
+    Dimensions3D dimensions;
+    
+    ShapePrototypeKey() = default;
+    ShapePrototypeKey(const std::string& catalogItemId, const Dimensions3D& dimensions)
+        : catalogItemId(catalogItemId), dimensions(dimensions) {}
+    
+    bool operator==(const ShapePrototypeKey& other) const;
+    bool operator!=(const ShapePrototypeKey& other) const { return !(*this == other); }
+    
+    std::string toString() const;
+};
+
+struct ShapePrototypeKeyHash {
+    size_t operator()(const ShapePrototypeKey& key) const;
+};
+
+/**
+ * @brief Shape shared by every placement of a catalog item at one size
+ * 
+ * Holds the B-rep once, in the item's local frame, together with its volume,
+ * surface area and bounds. Placements keep a pointer to the prototype plus
+ * their own transform instead of a transformed copy of the shape. Prototypes
+ * are immutable, so any thread may read them.
+ */
+class ShapePrototype {
+public:
+    ShapePrototype(const ShapePrototypeKey& key, std::unique_ptr<Shape3D> shape);
+    
+    ShapePrototype(const ShapePrototype&) = delete;
+    ShapePrototype& operator=(const ShapePrototype&) = delete;
+    
+    const ShapePrototypeKey& getKey() const { return key_; }
+    
+    /**
+     * @brief Shape in the local frame; never modify it through a cast
+     */
+    const Shape3D& getShape() const { return *shape_; }
+    
+    double getVolume() const { return volume_; }
+    double getSurfaceArea() const { return surfaceArea_; }
+    const Geometry::BoundingBox& getLocalBounds() const { return localBounds_; }
+    
+    /**
+     * @brief Volume of a placement; scale multiplies it by |sx * sy * sz|
+     */
+    double getVolume(const Geometry::Transform3D& transform) const;
+    
+    /**
+     * @brief Surface area of a placement
+     * 
+     * Exact for rigid and uniformly scaled placements. Non-uniform scale
+     * changes faces unevenly, so the placed shape is measured instead.
+     */
+    double getSurfaceArea(const Geometry::Transform3D& transform) const;
+    
+    /**
+     * @brief World bounds of a placement with the given world matrix
+     */
+    Geometry::BoundingBox getBoundingBox(const Geometry::Matrix4x4& worldMatrix) const;
+    
+    /**
+     * @brief Standalone copy of the shape at a placement, e.g. for boolean export
+     */
+    std::unique_ptr<Shape3D> instantiate(const Geometry::Transform3D& transform) const;
+
+private:
+    ShapePrototypeKey key_;
+    std::unique_ptr<Shape3D> shape_;
+    double volume_;
+    double surfaceArea_;
+    Geometry::BoundingBox localBounds_;
+};
+
+/**
+ * @brief Hands out one ShapePrototype per catalog item and dimensions
+ * 
+ * The first request for a key builds the shape with the registry's builder;
+ * later requests share it. Building runs without the registry locked, so a
+ * slow B-rep build does not stall other lookups; if two threads build the
+ * same key at once, the first to finish is kept. Prototypes stay registered
+ * until purgeUnused finds no placement using them. All methods are
+ * thread-safe.
+ */
+class ShapePrototypeRegistry {
+public:
+    using Builder = std::function<std::unique_ptr<Shape3D>(const ShapePrototypeKey& key)>;
+    
+    /**
+     * @brief Registry counters
+     */
+    struct Statistics {
+        size_t prototypeCount = 0;      // Prototypes currently registered
+        size_t hits = 0;                // Requests served by an existing prototype
+        size_t builds = 0;              // Shapes built
+        size_t failedBuilds = 0;        // Builder returned no shape
+    };
+    
+    explicit ShapePrototypeRegistry(Builder builder);
+    
+    ShapePrototypeRegistry(const ShapePrototypeRegistry&) = delete;
+    ShapePrototypeRegistry& operator=(const ShapePrototypeRegistry&) = delete;
+    
+    /**
+     * @brief Builder making an axis-aligned box from the origin to the dimensions
+     */
+    static Builder boxBuilder(IGeometryEngine& engine);
+    
+    /**
+     * @brief Prototype for the key, built on first request
+     * @return nullptr if the dimensions are invalid or the build failed
+     */
+    std::shared_ptr<const ShapePrototype> acquire(const ShapePrototypeKey& key);
+    
+    std::shared_ptr<const ShapePrototype> acquire(const CatalogItem& item) {
+        return acquire(ShapePrototypeKey(item.getId(), item.getDimensions()));
+    }
+    
+    /**
+     * @brief Registered prototype for the key, or nullptr; never builds
+     */
+    std::shared_ptr<const ShapePrototype> find(const ShapePrototypeKey& key) const;
+    
+    /**
+     * @brief Drop prototypes no placement holds any more
+     * @return Number of prototypes removed
+     */
+    size_t purgeUnused();
+    
+    void clear();
+    
+    size_t size() const;
+    
+    Statistics getStatistics() const;
+
+private:
+    Builder builder_;
+    
+    mutable std::mutex mutex_;
+    std::unordered_map<ShapePrototypeKey, std::shared_ptr<const ShapePrototype>, ShapePrototypeKeyHash> prototypes_;
+    Statistics stats_;
+};
+
+} // namespace Models
+} // namespace KitchenCAD
\ No newline at end of file
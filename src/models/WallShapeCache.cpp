@@ -0,0 +1,234 @@
+#include "WallShapeCache.h"
+#include "../interfaces/IGeometryEngine.h"
+#include "../utils/Logger.h"
+#include <algorithm>
+#include <cmath>
+#include <functional>
+#include <unordered_set>
+
+namespace KitchenCAD {
+namespace Models {
+
+namespace {
+
+void mixHash(uint64_t& hash, uint64_t value) {
+    hash ^= value + 0x9E3779B97F4A7C15ULL + (hash << 6) + (hash >> 2);
+}
+
+void mixHash(uint64_t& hash, double value) {
+    mixHash(hash, static_cast<uint64_t>(std::hash<double>()(value)));
+}
+
+void mixHash(uint64_t& hash, const Point3D& point) {
+    mixHash(hash, point.x);
+    mixHash(hash, point.y);
+    mixHash(hash, point.z);
+}
+
+// Openings of the wall, ordered by id so results do not depend on project order
+std::vector<const Opening*> openingsOf(const Wall& wall, const std::vector<Opening>& openings) {
+    std::vector<const Opening*> result;
+    for (const auto& opening : openings) {
+        if (opening.wallId == wall.id) {
+            result.push_back(&opening);
+        }
+    }
+    std::sort(result.begin(), result.end(), [](const Opening* a, const Opening* b) { return a->id < b->id; });
+    return result;
+}
+
+} // namespace
+
+WallShapeCache::WallShapeCache(IGeometryEngine& engine)
+    : engine_(engine) {
+}
+
+std::shared_ptr<const Shape3D> WallShapeCache::getWallShape(const Wall& wall, const std::vector<Opening>& openings) {
+    uint64_t wallFingerprint = fingerprint(wall, openings);
+    
+    std::shared_ptr<const Shape3D> shape;
+    if (findCurrent(wall.id, wallFingerprint, shape)) {
+        return shape;
+    }
+    
+    shape = buildWallShape(wall, openings);
+    store(wall.id, wallFingerprint, shape);
+    return shape;
+}
+
+std::vector<std::shared_ptr<const Shape3D>> WallShapeCache::getWallShapes(const Project& project,
+                                                                          Utils::ThreadPool& pool) {
+    const auto& walls = project.getWalls();
+    const auto& openings = project.getOpenings();
+    
+    std::vector<std::shared_ptr<const Shape3D>> shapes(walls.size());
+    std::vector<uint64_t> fingerprints(walls.size());
+    std::vector<size_t> stale;
+    
+    for (size_t i = 0; i < walls.size(); ++i) {
+        fingerprints[i] = fingerprint(walls[i], openings);
+        if (!findCurrent(walls[i].id, fingerprints[i], shapes[i])) {
+            stale.push_back(i);
+        }
+    }
+    
+    // One wall per chunk: a wall's booleans dominate and vary with its openings
+    pool.parallelFor(stale.size(), [&](size_t begin, size_t end) {
+        for (size_t i = begin; i < end; ++i) {
+            size_t wall = stale[i];
+            shapes[wall] = buildWallShape(walls[wall], openings);
+            store(walls[wall].id, fingerprints[wall], shapes[wall]);
+        }
+    }, 1);
+    
+    return shapes;
+}
+
+void WallShapeCache::invalidate(const std::string& wallId) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    entries_.erase(wallId);
+}
+
+size_t WallShapeCache::purgeRemoved(const Project& project) {
+    std::unordered_set<std::string> wallIds;
+    for (const auto& wall : project.getWalls()) {
+        wallIds.insert(wall.id);
+    }
+    
+    std::lock_guard<std::mutex> lock(mutex_);
+    
+    size_t removed = 0;
+    for (auto it = entries_.begin(); it != entries_.end();) {
+        if (wallIds.count(it->first) == 0) {
+            it = entries_.erase(it);
+            ++removed;
+        } else {
+            ++it;
+        }
+    }
+    return removed;
+}
+
+void WallShapeCache::clear() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    entries_.clear();
+}
+
+size_t WallShapeCache::size() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return entries_.size();
+}
+
+WallShapeCache::Statistics WallShapeCache::getStatistics() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    Statistics stats = stats_;
+    stats.entryCount = entries_.size();
+    return stats;
+}
+
+uint64_t WallShapeCache::fingerprint(const Wall& wall, const std::vector<Opening>& openings) {
+    uint64_t hash = 0xCBF29CE484222325ULL;
+    mixHash(hash, wall.start);
+    mixHash(hash, wall.end);
+    mixHash(hash, wall.height);
+    mixHash(hash, wall.thickness);
+    
+    for (const Opening* opening : openingsOf(wall, openings)) {
+        mixHash(hash, static_cast<uint64_t>(std::hash<std::string>()(opening->id)));
+        mixHash(hash, opening->position);
+        mixHash(hash, opening->width);
+        mixHash(hash, opening->height);
+        mixHash(hash, opening->sillHeight);
+    }
+    return hash;
+}
+
+std::vector<std::unique_ptr<Shape3D>> WallShapeCache::createOpeningTools(const Wall& wall,
+                                                                         const std::vector<Opening>& openings) const {
+    std::vector<std::unique_ptr<Shape3D>> tools;
+    
+    double length = wall.length();
+    double toolDepth = wall.thickness + 2.0 * kToolOvershoot;
+    
+    for (const Opening* opening : openingsOf(wall, openings)) {
+        if (!opening->isValid()) {
+            LOG_WARNING("Skipping invalid opening: " + opening->id);
+            continue;
+        }
+        
+        Point3D corner(opening->position * length - opening->width / 2.0,
+                       -toolDepth / 2.0,
+                       opening->sillHeight);
+        auto tool = engine_.createBox(corner, opening->width, toolDepth, opening->height);
+        if (!tool) {
+            LOG_WARNING("Failed to create cut tool for opening: " + opening->id);
+            continue;
+        }
+        tools.push_back(std::move(tool));
+    }
+    return tools;
+}
+
+std::shared_ptr<const Shape3D> WallShapeCache::buildWallShape(const Wall& wall,
+                                                              const std::vector<Opening>& openings) const {
+    if (!wall.isValid()) {
+        LOG_WARNING("Cannot build shape for invalid wall: " + wall.id);
+        return nullptr;
+    }
+    
+    auto shape = engine_.createBox(Point3D(0.0, -wall.thickness / 2.0, 0.0),
+                                   wall.length(), wall.thickness, wall.height);
+    if (!shape) {
+        LOG_ERROR("Failed to create wall solid: " + wall.id);
+        return nullptr;
+    }
+    
+    auto tools = createOpeningTools(wall, openings);
+    if (!tools.empty()) {
+        std::vector<const Shape3D*> toolPointers;
+        toolPointers.reserve(tools.size());
+        for (const auto& tool : tools) {
+            toolPointers.push_back(tool.get());
+        }
+        
+        if (!engine_.performBooleanBatch(*shape, toolPointers, BooleanOperation::Difference)) {
+            LOG_ERROR("Failed to cut openings from wall: " + wall.id);
+            return nullptr;
+        }
+    }
+    
+    // Walls stand on the floor, so placing one only needs a turn about Z
+    Vector3D direction = wall.direction();
+    Transform3D placement(wall.start, Vector3D(0.0, 0.0, std::atan2(direction.y, direction.x)));
+    return std::shared_ptr<const Shape3D>(engine_.transform(*shape, placement));
+}
+
+bool WallShapeCache::findCurrent(const std::string& wallId, uint64_t fingerprint,
+                                 std::shared_ptr<const Shape3D>& shape) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto it = entries_.find(wallId);
+    if (it == entries_.end() || it->second.fingerprint != fingerprint) {
+        return false;
+    }
+    
+    ++stats_.hits;
+    shape = it->second.shape;
+    return true;
+}
+
+void WallShapeCache::store(const std::string& wallId, uint64_t fingerprint,
+                           const std::shared_ptr<const Shape3D>& shape) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (!shape) {
+        // Failures are not cached, so a later request tries again
+        ++stats_.failedBuilds;
+        entries_.erase(wallId);
+        return;
+    }
+    
+    ++stats_.builds;
+    entries_[wallId] = Entry{fingerprint, shape};
+}
+
+} // namespace Models
+} // namespace KitchenCAD
\ No newline at end of file
@@ -0,0 +1,131 @@
+#pragma once
+
+#include "Project.h"
+#include "../core/Shape3D.h"
+#include "../utils/ThreadPool.h"
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace KitchenCAD {
+
+class IGeometryEngine;
+
+namespace Models {
+
+/**
+ * @brief Wall solids with their openings cut out, rebuilt only when they change
+ * 
+ * A wall is a box running from start to end, thickness centred on the wall
+ * line and height along +Z. Its openings are cut in one batch boolean. The
+ * result is kept with a fingerprint of the wall and its openings; later
+ * requests compare fingerprints and reuse the shape while they match, so
+ * callers need not report edits.
+ * 
+ * Shapes are built without the cache locked, so slow booleans do not stall
+ * other lookups. All methods are thread-safe; the engine must allow
+ * concurrent booleans on different shapes when walls are built in parallel.
+ */
+class WallShapeCache {
+public:
+    /**
+     * @brief Cache counters
+     */
+    struct Statistics {
+        size_t entryCount = 0;          // Walls currently cached
+        size_t hits = 0;                // Requests served by a cached shape
+        size_t builds = 0;              // Wall shapes built
+        size_t failedBuilds = 0;        // Wall or cut could not be built
+    };
+    
+    /**
+     * @brief Depth tools extend past each wall face
+     * 
+     * Tools flush with the faces would leave coplanar faces for the boolean
+     * to resolve; overshooting makes every cut a clean through-cut.
+     */
+    static constexpr double kToolOvershoot = 0.01;
+    
+    explicit WallShapeCache(IGeometryEngine& engine);
+    
+    WallShapeCache(const WallShapeCache&) = delete;
+    WallShapeCache& operator=(const WallShapeCache&) = delete;
+    
+    /**
+     * @brief Wall shape in world coordinates with its openings cut out
+     * @param openings Openings of any walls; those of other walls are ignored
+     * @return nullptr if the wall is invalid or its shape could not be built
+     */
+    std::shared_ptr<const Shape3D> getWallShape(const Wall& wall, const std::vector<Opening>& openings);
+    
+    /**
+     * @brief Shapes for all walls of a project, building changed walls in parallel
+     * @return One shape per wall, in project order; nullptr where building failed
+     */
+    std::vector<std::shared_ptr<const Shape3D>> getWallShapes(const Project& project, Utils::ThreadPool& pool);
+    
+    std::vector<std::shared_ptr<const Shape3D>> getWallShapes(const Project& project) {
+        return getWallShapes(project, Utils::ThreadPool::shared());
+    }
+    
+    /**
+     * @brief Drop the cached shape of a wall
+     */
+    void invalidate(const std::string& wallId);
+    
+    /**
+     * @brief Drop cached walls whose ids are not in the project any more
+     * @return Number of walls removed
+     */
+    size_t purgeRemoved(const Project& project);
+    
+    void clear();
+    
+    size_t size() const;
+    
+    Statistics getStatistics() const;
+    
+    /**
+     * @brief Fingerprint of a wall and those of the openings that belong to it
+     * 
+     * Independent of the order of openings.
+     */
+    static uint64_t fingerprint(const Wall& wall, const std::vector<Opening>& openings);
+    
+    /**
+     * @brief Cut tools for a wall's openings in its local frame, ordered by opening id
+     * 
+     * Local X runs along the wall from its start, Y across it and Z up. An
+     * opening's position places its centre along the wall.
+     */
+    std::vector<std::unique_ptr<Shape3D>> createOpeningTools(const Wall& wall,
+                                                             const std::vector<Opening>& openings) const;
+
+private:
+    struct Entry {
+        uint64_t fingerprint = 0;
+        std::shared_ptr<const Shape3D> shape;
+    };
+    
+    std::shared_ptr<const Shape3D> buildWallShape(const Wall& wall, const std::vector<Opening>& openings) const;
+    
+    /**
+     * @brief Cached shape if its fingerprint matches; counts a hit
+     */
+    bool findCurrent(const std::string& wallId, uint64_t fingerprint, std::shared_ptr<const Shape3D>& shape);
+    
+    void store(const std::string& wallId, uint64_t fingerprint, const std::shared_ptr<const Shape3D>& shape);
+    
+    IGeometryEngine& engine_;
+    
+    mutable std::mutex mutex_;
+    std::unordered_map<std::string, Entry> entries_;
+    Statistics stats_;
+};
+
+} // namespace Models
+} // namespace KitchenCAD
\ No newline at end of file
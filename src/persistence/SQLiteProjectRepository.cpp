@@ -710,7 +710,7 @@ bool SQLiteProjectRepository::loadSceneObjects(Models::Project& project) {
     stmt->bindText(1, project.getId());
     
     while (stmt->step()) {
-        auto object = std::make_unique<Models::SceneObject>(stmt->getColumnText(1));
+        auto object = project.createObject(stmt->getColumnText(1));
         object->setId(stmt->getColumnText(0));
         
         // Set transform
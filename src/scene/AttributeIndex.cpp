@@ -0,0 +1,50 @@
+#include "AttributeIndex.h"
+
+namespace KitchenCAD {
+namespace Scene {
+
+uint32_t AttributeIndex::add(const std::string& key, ObjectHandle handle) {
+    auto [it, inserted] = keyIds_.try_emplace(key, static_cast<uint32_t>(entries_.size()));
+    if (inserted) {
+        entries_.push_back(Entry{key, {}});
+    }
+    
+    entries_[it->second].handles.insert(handle);
+    return it->second;
+}
+
+void AttributeIndex::remove(uint32_t keyId, ObjectHandle handle) {
+    if (keyId < entries_.size()) {
+        entries_[keyId].handles.erase(handle);
+    }
+}
+
+const AttributeIndex::HandleSet* AttributeIndex::find(const std::string& key) const {
+    auto it = keyIds_.find(key);
+    return it != keyIds_.end() ? &entries_[it->second].handles : nullptr;
+}
+
+size_t AttributeIndex::count(const std::string& key) const {
+    const HandleSet* handles = find(key);
+    return handles ? handles->size() : 0;
+}
+
+std::unordered_map<std::string, size_t> AttributeIndex::getCounts() const {
+    std::unordered_map<std::string, size_t> counts;
+    
+    for (const auto& entry : entries_) {
+        if (!entry.handles.empty()) {
+            counts.emplace(entry.key, entry.handles.size());
+        }
+    }
+    
+    return counts;
+}
+
+void AttributeIndex::clear() {
+    entries_.clear();
+    keyIds_.clear();
+}
+
+} // namespace Scene
+} // namespace KitchenCAD
\ No newline at end of file
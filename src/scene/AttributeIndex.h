@@ -0,0 +1,68 @@
+#pragma once
+
+#include "ObjectHandle.h"
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+namespace KitchenCAD {
+namespace Scene {
+
+/**
+ * @brief Inverted index from a string attribute to the objects that have it
+ * 
+ * Keys are interned on first use and never forgotten, so the returned key id
+ * stays valid for the lifetime of the index and can be stored per object to
+ * remove it later without keeping a copy of the string. Lookups return the
+ * matching handles in O(matches) and counts in O(1). Not thread-safe;
+ * callers synchronise.
+ */
+class AttributeIndex {
+public:
+    using HandleSet = std::unordered_set<ObjectHandle, ObjectHandleHash>;
+    
+    static constexpr uint32_t kNoKey = ~uint32_t(0);
+    
+    /**
+     * @brief File an object under a key, returning the key id
+     */
+    uint32_t add(const std::string& key, ObjectHandle handle);
+    
+    /**
+     * @brief Remove an object from the key it was filed under
+     */
+    void remove(uint32_t keyId, ObjectHandle handle);
+    
+    /**
+     * @brief Objects filed under a key, or null if none ever were
+     */
+    const HandleSet* find(const std::string& key) const;
+    
+    size_t count(const std::string& key) const;
+    
+    /**
+     * @brief Key string for a key id returned by add()
+     */
+    const std::string& getKey(uint32_t keyId) const { return entries_[keyId].key; }
+    
+    /**
+     * @brief Number of objects per key, for keys that currently have any
+     */
+    std::unordered_map<std::string, size_t> getCounts() const;
+    
+    void clear();
+
+private:
+    struct Entry {
+        std::string key;
+        HandleSet handles;
+    };
+    
+    std::vector<Entry> entries_;
+    std::unordered_map<std::string, uint32_t> keyIds_;
+};
+
+} // namespace Scene
+} // namespace KitchenCAD
\ No newline at end of file
@@ -0,0 +1,240 @@
+#include "BoundsSoA.h"
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+#if defined(__x86_64__) || defined(_M_X64) || defined(__i386__) || defined(_M_IX86)
+#define KITCHENCAD_BOUNDS_X86 1
+#include <immintrin.h>
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+#endif
+
+#if defined(KITCHENCAD_BOUNDS_X86) && (defined(__GNUC__) || defined(__clang__))
+#define KITCHENCAD_TARGET(isa) __attribute__((target(isa)))
+#else
+#define KITCHENCAD_TARGET(isa)
+#endif
+
+namespace KitchenCAD {
+namespace Scene {
+
+namespace {
+
+// Columns are padded to the widest kernel so every kernel runs whole blocks
+constexpr size_t kLaneWidth = 8;
+
+constexpr float kInfinity = std::numeric_limits<float>::infinity();
+
+float roundDown(double value) {
+    float result = static_cast<float>(value);
+    if (static_cast<double>(result) > value) {
+        result = std::nextafter(result, -kInfinity);
+    }
+    return result;
+}
+
+float roundUp(double value) {
+    float result = static_cast<float>(value);
+    if (static_cast<double>(result) < value) {
+        result = std::nextafter(result, kInfinity);
+    }
+    return result;
+}
+
+struct Query {
+    float min[3];
+    float max[3];
+};
+
+// Passed by value so the pointers stay in registers while results are appended
+struct ColumnPointers {
+    const float* min[3];
+    const float* max[3];
+    size_t count;
+};
+
+void appendMask(unsigned mask, size_t base, std::vector<uint32_t>& slots) {
+    for (uint32_t lane = 0; mask != 0; ++lane, mask >>= 1) {
+        if (mask & 1u) {
+            slots.push_back(static_cast<uint32_t>(base + lane));
+        }
+    }
+}
+
+void overlapScalar(ColumnPointers columns, const Query& query, std::vector<uint32_t>& slots) {
+    for (size_t i = 0; i < columns.count; ++i) {
+        if (columns.min[0][i] <= query.max[0] && columns.max[0][i] >= query.min[0] &&
+            columns.min[1][i] <= query.max[1] && columns.max[1][i] >= query.min[1] &&
+            columns.min[2][i] <= query.max[2] && columns.max[2][i] >= query.min[2]) {
+            slots.push_back(static_cast<uint32_t>(i));
+        }
+    }
+}
+
+#ifdef KITCHENCAD_BOUNDS_X86
+
+KITCHENCAD_TARGET("sse2")
+void overlapSSE(ColumnPointers columns, const Query& query, std::vector<uint32_t>& slots) {
+    const __m128 queryMinX = _mm_set1_ps(query.min[0]);
+    const __m128 queryMinY = _mm_set1_ps(query.min[1]);
+    const __m128 queryMinZ = _mm_set1_ps(query.min[2]);
+    const __m128 queryMaxX = _mm_set1_ps(query.max[0]);
+    const __m128 queryMaxY = _mm_set1_ps(query.max[1]);
+    const __m128 queryMaxZ = _mm_set1_ps(query.max[2]);
+    
+    for (size_t i = 0; i < columns.count; i += 4) {
+        __m128 x = _mm_and_ps(_mm_cmple_ps(_mm_loadu_ps(columns.min[0] + i), queryMaxX),
+                              _mm_cmpge_ps(_mm_loadu_ps(columns.max[0] + i), queryMinX));
+        __m128 y = _mm_and_ps(_mm_cmple_ps(_mm_loadu_ps(columns.min[1] + i), queryMaxY),
+                              _mm_cmpge_ps(_mm_loadu_ps(columns.max[1] + i), queryMinY));
+        __m128 z = _mm_and_ps(_mm_cmple_ps(_mm_loadu_ps(columns.min[2] + i), queryMaxZ),
+                              _mm_cmpge_ps(_mm_loadu_ps(columns.max[2] + i), queryMinZ));
+        
+        unsigned mask = static_cast<unsigned>(_mm_movemask_ps(_mm_and_ps(x, _mm_and_ps(y, z))));
+        if (mask != 0) {
+            appendMask(mask, i, slots);
+        }
+    }
+}
+
+KITCHENCAD_TARGET("avx2")
+void overlapAVX2(ColumnPointers columns, const Query& query, std::vector<uint32_t>& slots) {
+    const __m256 queryMinX = _mm256_set1_ps(query.min[0]);
+    const __m256 queryMinY = _mm256_set1_ps(query.min[1]);
+    const __m256 queryMinZ = _mm256_set1_ps(query.min[2]);
+    const __m256 queryMaxX = _mm256_set1_ps(query.max[0]);
+    const __m256 queryMaxY = _mm256_set1_ps(query.max[1]);
+    const __m256 queryMaxZ = _mm256_set1_ps(query.max[2]);
+    
+    for (size_t i = 0; i < columns.count; i += 8) {
+        __m256 x = _mm256_and_ps(_mm256_cmp_ps(_mm256_loadu_ps(columns.min[0] + i), queryMaxX, _CMP_LE_OQ),
+                                 _mm256_cmp_ps(_mm256_loadu_ps(columns.max[0] + i), queryMinX, _CMP_GE_OQ));
+        __m256 y = _mm256_and_ps(_mm256_cmp_ps(_mm256_loadu_ps(columns.min[1] + i), queryMaxY, _CMP_LE_OQ),
+                                 _mm256_cmp_ps(_mm256_loadu_ps(columns.max[1] + i), queryMinY, _CMP_GE_OQ));
+        __m256 z = _mm256_and_ps(_mm256_cmp_ps(_mm256_loadu_ps(columns.min[2] + i), queryMaxZ, _CMP_LE_OQ),
+                                 _mm256_cmp_ps(_mm256_loadu_ps(columns.max[2] + i), queryMinZ, _CMP_GE_OQ));
+        
+        unsigned mask = static_cast<unsigned>(_mm256_movemask_ps(_mm256_and_ps(x, _mm256_and_ps(y, z))));
+        if (mask != 0) {
+            appendMask(mask, i, slots);
+        }
+    }
+}
+
+#endif
+
+} // namespace
+
+BoundsSoA::BoundsSoA()
+    : slotCount_(0)
+    , kernel_(detectKernel()) {
+}
+
+void BoundsSoA::set(uint32_t slot, const Geometry::BoundingBox& bounds) {
+    if (slot >= columns_[0].size()) {
+        size_t padded = (static_cast<size_t>(slot) / kLaneWidth + 1) * kLaneWidth;
+        padded = std::max(padded, columns_[0].size() * 2);
+        for (int column = 0; column < 6; ++column) {
+            columns_[column].resize(padded, column < 3 ? kInfinity : -kInfinity);
+        }
+    }
+    slotCount_ = std::max(slotCount_, static_cast<size_t>(slot) + 1);
+    
+    if (bounds.isEmpty()) {
+        reset(slot);
+        return;
+    }
+    
+    for (int axis = 0; axis < 3; ++axis) {
+        columns_[axis][slot] = roundDown(bounds.min[axis]);
+        columns_[axis + 3][slot] = roundUp(bounds.max[axis]);
+    }
+}
+
+void BoundsSoA::reset(uint32_t slot) {
+    if (slot >= columns_[0].size()) return;
+    
+    for (int axis = 0; axis < 3; ++axis) {
+        columns_[axis][slot] = kInfinity;
+        columns_[axis + 3][slot] = -kInfinity;
+    }
+}
+
+void BoundsSoA::clear() {
+    for (auto& column : columns_) {
+        column.clear();
+    }
+    slotCount_ = 0;
+}
+
+void BoundsSoA::findOverlapping(const Geometry::BoundingBox& query, std::vector<uint32_t>& slots) const {
+    if (query.isEmpty() || columns_[0].empty()) return;
+    
+    Query rounded;
+    ColumnPointers columns;
+    for (int axis = 0; axis < 3; ++axis) {
+        rounded.min[axis] = roundDown(query.min[axis]);
+        rounded.max[axis] = roundUp(query.max[axis]);
+        columns.min[axis] = columns_[axis].data();
+        columns.max[axis] = columns_[axis + 3].data();
+    }
+    columns.count = columns_[0].size();
+    
+    switch (kernel_) {
+#ifdef KITCHENCAD_BOUNDS_X86
+    case Kernel::AVX2:
+        overlapAVX2(columns, rounded, slots);
+        break;
+    case Kernel::SSE:
+        overlapSSE(columns, rounded, slots);
+        break;
+#endif
+    default:
+        overlapScalar(columns, rounded, slots);
+        break;
+    }
+}
+
+void BoundsSoA::setKernel(Kernel kernel) {
+    kernel_ = isKernelSupported(kernel) ? kernel : detectKernel();
+}
+
+BoundsSoA::Kernel BoundsSoA::detectKernel() {
+    static const Kernel detected = isKernelSupported(Kernel::AVX2) ? Kernel::AVX2
+                                 : isKernelSupported(Kernel::SSE) ? Kernel::SSE
+                                 : Kernel::Scalar;
+    return detected;
+}
+
+bool BoundsSoA::isKernelSupported(Kernel kernel) {
+    switch (kernel) {
+    case Kernel::Scalar:
+        return true;
+#if defined(KITCHENCAD_BOUNDS_X86) && (defined(__GNUC__) || defined(__clang__))
+    case Kernel::SSE:
+        return __builtin_cpu_supports("sse2");
+    case Kernel::AVX2:
+        return __builtin_cpu_supports("avx2");
+#elif defined(KITCHENCAD_BOUNDS_X86) && defined(_MSC_VER)
+    case Kernel::SSE: {
+        int info[4];
+        __cpuid(info, 1);
+        return (info[3] & (1 << 26)) != 0;
+    }
+    case Kernel::AVX2: {
+        int info[4];
+        __cpuid(info, 1);
+        bool osSavesYmm = (info[2] & (1 << 27)) && (info[2] & (1 << 28)) && ((_xgetbv(0) & 0x6) == 0x6);
+        __cpuidex(info, 7, 0);
+        return osSavesYmm && (info[1] & (1 << 5)) != 0;
+    }
+#endif
+    default:
+        return false;
+    }
+}
+
+} // namespace Scene
+} // namespace KitchenCAD
\ No newline at end of file
@@ -0,0 +1,87 @@
+#pragma once
+
+#include "../geometry/BoundingBox.h"
+#include <array>
+#include <cstdint>
+#include <vector>
+
+namespace KitchenCAD {
+namespace Scene {
+
+/**
+ * @brief Structure-of-arrays copy of object bounds for vectorised overlap tests
+ * 
+ * Bounds are stored per slot as six contiguous float columns. Minimums are
+ * rounded down and maximums up when narrowing from double, so the float test
+ * never misses an overlap the exact test would report; callers confirm the
+ * returned candidates against the exact double bounds. Unused slots hold an
+ * empty box that never overlaps anything.
+ * 
+ * The overlap scan tests one query box against 4 (SSE) or 8 (AVX2) boxes per
+ * instruction. The widest kernel supported by the CPU is selected at runtime,
+ * with a scalar fallback for other architectures.
+ */
+class BoundsSoA {
+public:
+    enum class Kernel {
+        Scalar,
+        SSE,
+        AVX2
+    };
+    
+    /**
+     * @brief Constructor, selecting the best kernel for this CPU
+     */
+    BoundsSoA();
+    
+    /**
+     * @brief Store the bounds of a slot, growing the arrays as needed
+     */
+    void set(uint32_t slot, const Geometry::BoundingBox& bounds);
+    
+    /**
+     * @brief Reset a slot to the empty box
+     */
+    void reset(uint32_t slot);
+    
+    void clear();
+    
+    /**
+     * @brief Number of slots covered by the arrays
+     */
+    size_t getSlotCount() const { return slotCount_; }
+    
+    /**
+     * @brief Append the slots whose bounds may overlap the query box
+     * 
+     * The result is a superset of the slots whose exact bounds intersect the
+     * query, in ascending slot order.
+     */
+    void findOverlapping(const Geometry::BoundingBox& query, std::vector<uint32_t>& slots) const;
+    
+    /**
+     * @brief Kernel used by findOverlapping()
+     */
+    Kernel getKernel() const { return kernel_; }
+    
+    /**
+     * @brief Force a kernel; unsupported kernels fall back to the best supported one
+     */
+    void setKernel(Kernel kernel);
+    
+    /**
+     * @brief Widest kernel the current CPU supports
+     */
+    static Kernel detectKernel();
+    
+    static bool isKernelSupported(Kernel kernel);
+
+private:
+    // Column order: min x, y, z, then max x, y, z
+    std::array<std::vector<float>, 6> columns_;
+    size_t slotCount_;
+    Kernel kernel_;
+};
+
+} // namespace Scene
+} // namespace KitchenCAD
\ No newline at end of file
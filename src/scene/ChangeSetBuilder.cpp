@@ -0,0 +1,76 @@
+#include "ChangeSetBuilder.h"
+
+namespace KitchenCAD {
+namespace Scene {
+
+void ChangeSetBuilder::objectAdded(const ObjectId& id) {
+    Change& entry = entryFor(id);
+    
+    // Removed and added back under the same id: the object was replaced
+    set(entry, entry == Change::Removed ? Change::Modified : Change::Added);
+}
+
+void ChangeSetBuilder::objectRemoved(const ObjectId& id) {
+    Change& entry = entryFor(id);
+    
+    // Nobody has seen an object that was added within the batch
+    set(entry, entry == Change::Added ? Change::None : Change::Removed);
+}
+
+void ChangeSetBuilder::objectModified(const ObjectId& id) {
+    Change& entry = entryFor(id);
+    
+    // Modifying a new object is still just an addition
+    if (entry == Change::None) {
+        set(entry, Change::Modified);
+    }
+}
+
+SceneChangeSet ChangeSetBuilder::take() {
+    SceneChangeSet changes;
+    
+    for (auto& [id, change] : entries_) {
+        switch (change) {
+            case Change::Added:
+                changes.added.push_back(std::move(id));
+                break;
+            case Change::Removed:
+                changes.removed.push_back(std::move(id));
+                break;
+            case Change::Modified:
+                changes.modified.push_back(std::move(id));
+                break;
+            case Change::None:
+                break;
+        }
+    }
+    
+    clear();
+    return changes;
+}
+
+void ChangeSetBuilder::clear() {
+    entries_.clear();
+    entryById_.clear();
+    netChanges_ = 0;
+}
+
+ChangeSetBuilder::Change& ChangeSetBuilder::entryFor(const ObjectId& id) {
+    auto [it, inserted] = entryById_.try_emplace(id, entries_.size());
+    if (inserted) {
+        entries_.emplace_back(id, Change::None);
+    }
+    return entries_[it->second].second;
+}
+
+void ChangeSetBuilder::set(Change& entry, Change change) {
+    if (entry == Change::None && change != Change::None) {
+        ++netChanges_;
+    } else if (entry != Change::None && change == Change::None) {
+        --netChanges_;
+    }
+    entry = change;
+}
+
+} // namespace Scene
+} // namespace KitchenCAD
\ No newline at end of file
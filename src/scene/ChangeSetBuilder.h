@@ -0,0 +1,47 @@
+#pragma once
+
+#include "../interfaces/ISceneManager.h"
+#include <cstdint>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace KitchenCAD {
+namespace Scene {
+
+/**
+ * @brief Folds a stream of object events into their net SceneChangeSet
+ * 
+ * Each id keeps one entry holding the net change so far, so recording is
+ * O(1) however many times an object changes within a batch. Not
+ * thread-safe; callers synchronise.
+ */
+class ChangeSetBuilder {
+public:
+    void objectAdded(const ObjectId& id);
+    void objectRemoved(const ObjectId& id);
+    void objectModified(const ObjectId& id);
+    
+    bool empty() const { return netChanges_ == 0; }
+    
+    /**
+     * @brief Net changes recorded so far, leaving the builder empty
+     */
+    SceneChangeSet take();
+    
+    void clear();
+
+private:
+    enum class Change : uint8_t { None, Added, Removed, Modified };
+    
+    // Entries in first-seen order; cancelled ones stay as None until take()
+    std::vector<std::pair<ObjectId, Change>> entries_;
+    std::unordered_map<ObjectId, size_t> entryById_;
+    size_t netChanges_ = 0;
+    
+    Change& entryFor(const ObjectId& id);
+    void set(Change& entry, Change change);
+};
+
+} // namespace Scene
+} // namespace KitchenCAD
\ No newline at end of file
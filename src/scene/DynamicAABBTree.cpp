@@ -0,0 +1,440 @@
+#include "DynamicAABBTree.h"
+#include "../utils/Logger.h"
+#include <algorithm>
+#include <cmath>
+#include <functional>
+#include <queue>
+
+namespace KitchenCAD {
+namespace Scene {
+
+namespace {
+
+// Moving objects get their fat box stretched along the displacement
+constexpr double kDisplacementMultiplier = 2.0;
+
+// Leaves are refitted when the fat box exceeds the tight box by this much
+constexpr double kShrinkMarginMultiplier = 4.0;
+
+double perimeter(const Geometry::BoundingBox& box) {
+    Geometry::Vector3D s = box.size();
+    return 2.0 * (s.x * s.y + s.y * s.z + s.z * s.x);
+}
+
+} // namespace
+
+DynamicAABBTree::DynamicAABBTree(double fatMargin)
+    : root_(kNullNode)
+    , freeList_(kNullNode)
+    , fatMargin_(fatMargin)
+    , objectCount_(0) {
+    if (fatMargin < 0.0) {
+        fatMargin_ = 0.0;
+        LOG_WARNING("Negative AABB tree margin provided, using 0.0");
+    }
+}
+
+void DynamicAABBTree::addObject(ObjectHandle handle, const Geometry::BoundingBox& bounds) {
+    if (bounds.isEmpty() || !handle.isValid()) return;
+    
+    removeObject(handle, bounds);
+    
+    int leaf = allocateNode();
+    nodes_[leaf].box = fatten(bounds, Geometry::Vector3D());
+    nodes_[leaf].handle = handle;
+    nodes_[leaf].height = 0;
+    
+    insertLeaf(leaf);
+    
+    if (leafBySlot_.size() <= handle.slot) {
+        leafBySlot_.resize(handle.slot + 1, kNullNode);
+    }
+    leafBySlot_[handle.slot] = leaf;
+    ++objectCount_;
+}
+
+void DynamicAABBTree::removeObject(ObjectHandle handle, const Geometry::BoundingBox& bounds) {
+    (void)bounds;
+    
+    int leaf = findLeaf(handle);
+    if (leaf == kNullNode) return;
+    
+    removeLeaf(leaf);
+    freeNode(leaf);
+    leafBySlot_[handle.slot] = kNullNode;
+    --objectCount_;
+}
+
+void DynamicAABBTree::updateObject(ObjectHandle handle, const Geometry::BoundingBox& oldBounds,
+                                   const Geometry::BoundingBox& newBounds) {
+    int leaf = findLeaf(handle);
+    if (leaf == kNullNode || newBounds.isEmpty()) {
+        removeObject(handle, oldBounds);
+        addObject(handle, newBounds);
+        return;
+    }
+    
+    const Geometry::BoundingBox& fatBox = nodes_[leaf].box;
+    
+    Geometry::Vector3D displacement;
+    if (!oldBounds.isEmpty()) {
+        displacement = Geometry::Vector3D(oldBounds.center(), newBounds.center());
+    }
+    
+    // Still inside the fat box and the fat box is not grossly oversized: nothing to do
+    if (fatBox.contains(newBounds)) {
+        Geometry::BoundingBox hugeBox = fatten(newBounds, displacement * kShrinkMarginMultiplier)
+                                            .expanded(kShrinkMarginMultiplier * fatMargin_);
+        if (hugeBox.contains(fatBox)) {
+            return;
+        }
+    }
+    
+    removeLeaf(leaf);
+    nodes_[leaf].box = fatten(newBounds, displacement);
+    insertLeaf(leaf);
+}
+
+std::vector<ObjectHandle> DynamicAABBTree::queryRegion(const Geometry::BoundingBox& region) const {
+    if (region.isEmpty()) return {};
+    
+    return query([&](const Geometry::BoundingBox& box) { return box.intersects(region); });
+}
+
+std::vector<ObjectHandle> DynamicAABBTree::queryRadius(const Geometry::Point3D& center, double radius) const {
+    double radiusSquared = radius * radius;
+    
+    return query([&](const Geometry::BoundingBox& box) {
+        return box.distanceSquaredTo(center) <= radiusSquared;
+    });
+}
+
+std::vector<ObjectHandle> DynamicAABBTree::queryRay(const Geometry::Ray& ray, double maxDistance) const {
+    return query([&](const Geometry::BoundingBox& box) {
+        double tEnter, tExit;
+        return ray.intersects(box, tEnter, tExit) && tEnter <= maxDistance;
+    });
+}
+
+std::vector<ObjectHandle> DynamicAABBTree::queryFrustum(const Geometry::Frustum& frustum) const {
+    return query([&](const Geometry::BoundingBox& box) { return frustum.intersects(box); });
+}
+
+std::vector<std::pair<double, ObjectHandle>> DynamicAABBTree::queryNearest(const Geometry::Point3D& point, size_t k,
+                                                                           double maxDistance,
+                                                                           const DistanceFunction& distance) const {
+    std::vector<std::pair<double, ObjectHandle>> result;
+    if (root_ == kNullNode || k == 0 || !(maxDistance >= 0.0)) return result;
+    
+    // Nodes are queued by box distance and objects by exact distance. Every
+    // object in a node is at least as far as its box, so an object reaching
+    // the front of the queue is nearer than anything still unvisited.
+    struct Entry {
+        double distance;
+        int node;               // kNullNode for measured objects
+        ObjectHandle handle;
+        
+        bool operator>(const Entry& other) const { return distance > other.distance; }
+    };
+    
+    std::priority_queue<Entry, std::vector<Entry>, std::greater<Entry>> queue;
+    queue.push({nodes_[root_].box.distanceTo(point), root_, ObjectHandle()});
+    
+    while (!queue.empty() && result.size() < k) {
+        Entry entry = queue.top();
+        queue.pop();
+        if (entry.distance > maxDistance) break;
+        
+        if (entry.node == kNullNode) {
+            result.emplace_back(entry.distance, entry.handle);
+            continue;
+        }
+        
+        const Node& node = nodes_[entry.node];
+        if (node.isLeaf()) {
+            queue.push({distance(node.handle), kNullNode, node.handle});
+        } else {
+            queue.push({nodes_[node.child1].box.distanceTo(point), node.child1, ObjectHandle()});
+            queue.push({nodes_[node.child2].box.distanceTo(point), node.child2, ObjectHandle()});
+        }
+    }
+    
+    return result;
+}
+
+void DynamicAABBTree::clear() {
+    nodes_.clear();
+    leafBySlot_.clear();
+    objectCount_ = 0;
+    root_ = kNullNode;
+    freeList_ = kNullNode;
+}
+
+int DynamicAABBTree::getHeight() const {
+    return root_ == kNullNode ? -1 : nodes_[root_].height;
+}
+
+int DynamicAABBTree::getMaxBalance() const {
+    int maxBalance = 0;
+    
+    for (const auto& node : nodes_) {
+        if (node.height <= 1) continue;
+        
+        int balance = std::abs(nodes_[node.child2].height - nodes_[node.child1].height);
+        maxBalance = std::max(maxBalance, balance);
+    }
+    
+    return maxBalance;
+}
+
+Geometry::BoundingBox DynamicAABBTree::getFatBounds(ObjectHandle handle) const {
+    int leaf = findLeaf(handle);
+    return leaf != kNullNode ? nodes_[leaf].box : Geometry::BoundingBox();
+}
+
+int DynamicAABBTree::findLeaf(ObjectHandle handle) const {
+    if (!handle.isValid() || handle.slot >= leafBySlot_.size()) {
+        return kNullNode;
+    }
+    
+    int leaf = leafBySlot_[handle.slot];
+    return (leaf != kNullNode && nodes_[leaf].handle == handle) ? leaf : kNullNode;
+}
+
+int DynamicAABBTree::allocateNode() {
+    if (freeList_ == kNullNode) {
+        nodes_.emplace_back();
+        return static_cast<int>(nodes_.size()) - 1;
+    }
+    
+    int nodeId = freeList_;
+    freeList_ = nodes_[nodeId].parent;
+    nodes_[nodeId] = Node();
+    return nodeId;
+}
+
+void DynamicAABBTree::freeNode(int nodeId) {
+    nodes_[nodeId] = Node();
+    nodes_[nodeId].parent = freeList_;
+    freeList_ = nodeId;
+}
+
+void DynamicAABBTree::insertLeaf(int leaf) {
+    if (root_ == kNullNode) {
+        root_ = leaf;
+        nodes_[root_].parent = kNullNode;
+        return;
+    }
+    
+    // Descend to the sibling that minimises the surface area heuristic cost
+    const Geometry::BoundingBox leafBox = nodes_[leaf].box;
+    int index = root_;
+    
+    while (!nodes_[index].isLeaf()) {
+        int child1 = nodes_[index].child1;
+        int child2 = nodes_[index].child2;
+        
+        double area = perimeter(nodes_[index].box);
+        double combinedArea = perimeter(nodes_[index].box.unionWith(leafBox));
+        
+        // Cost of creating a new parent for this node and the new leaf
+        double cost = 2.0 * combinedArea;
+        
+        // Minimum cost of pushing the leaf further down the tree
+        double inheritanceCost = 2.0 * (combinedArea - area);
+        
+        auto descendCost = [&](int child) {
+            Geometry::BoundingBox merged = leafBox.unionWith(nodes_[child].box);
+            if (nodes_[child].isLeaf()) {
+                return perimeter(merged) + inheritanceCost;
+            }
+            return perimeter(merged) - perimeter(nodes_[child].box) + inheritanceCost;
+        };
+        
+        double cost1 = descendCost(child1);
+        double cost2 = descendCost(child2);
+        
+        if (cost < cost1 && cost < cost2) {
+            break;
+        }
+        
+        index = (cost1 < cost2) ? child1 : child2;
+    }
+    
+    int sibling = index;
+    int oldParent = nodes_[sibling].parent;
+    int newParent = allocateNode();
+    nodes_[newParent].parent = oldParent;
+    nodes_[newParent].box = leafBox.unionWith(nodes_[sibling].box);
+    nodes_[newParent].height = nodes_[sibling].height + 1;
+    nodes_[newParent].child1 = sibling;
+    nodes_[newParent].child2 = leaf;
+    nodes_[sibling].parent = newParent;
+    nodes_[leaf].parent = newParent;
+    
+    if (oldParent != kNullNode) {
+        if (nodes_[oldParent].child1 == sibling) {
+            nodes_[oldParent].child1 = newParent;
+        } else {
+            nodes_[oldParent].child2 = newParent;
+        }
+    } else {
+        root_ = newParent;
+    }
+    
+    refitAncestors(nodes_[leaf].parent);
+}
+
+void DynamicAABBTree::removeLeaf(int leaf) {
+    if (leaf == root_) {
+        root_ = kNullNode;
+        return;
+    }
+    
+    int parent = nodes_[leaf].parent;
+    int grandParent = nodes_[parent].parent;
+    int sibling = (nodes_[parent].child1 == leaf) ? nodes_[parent].child2 : nodes_[parent].child1;
+    
+    if (grandParent != kNullNode) {
+        // Replace the parent with the sibling and refit upwards
+        if (nodes_[grandParent].child1 == parent) {
+            nodes_[grandParent].child1 = sibling;
+        } else {
+            nodes_[grandParent].child2 = sibling;
+        }
+        nodes_[sibling].parent = grandParent;
+        freeNode(parent);
+        
+        refitAncestors(grandParent);
+    } else {
+        root_ = sibling;
+        nodes_[sibling].parent = kNullNode;
+        freeNode(parent);
+    }
+    
+    nodes_[leaf].parent = kNullNode;
+}
+
+void DynamicAABBTree::refitAncestors(int nodeId) {
+    int index = nodeId;
+    
+    while (index != kNullNode) {
+        index = balance(index);
+        
+        Node& node = nodes_[index];
+        node.height = 1 + std::max(nodes_[node.child1].height, nodes_[node.child2].height);
+        node.box = nodes_[node.child1].box.unionWith(nodes_[node.child2].box);
+        
+        index = node.parent;
+    }
+}
+
+int DynamicAABBTree::balance(int iA) {
+    Node& A = nodes_[iA];
+    if (A.isLeaf() || A.height < 2) {
+        return iA;
+    }
+    
+    int iB = A.child1;
+    int iC = A.child2;
+    int currentBalance = nodes_[iC].height - nodes_[iB].height;
+    
+    // Rotate the taller child up: C or B becomes the new subtree root
+    auto rotate = [&](int iUp, int iOther, bool upIsChild2) {
+        Node& up = nodes_[iUp];
+        int iF = up.child1;
+        int iG = up.child2;
+        
+        up.child1 = iA;
+        up.parent = nodes_[iA].parent;
+        nodes_[iA].parent = iUp;
+        
+        if (up.parent != kNullNode) {
+            if (nodes_[up.parent].child1 == iA) {
+                nodes_[up.parent].child1 = iUp;
+            } else {
+                nodes_[up.parent].child2 = iUp;
+            }
+        } else {
+            root_ = iUp;
+        }
+        
+        // Keep the taller grandchild under the promoted node
+        int iKeep = iF;
+        int iMove = iG;
+        if (nodes_[iF].height < nodes_[iG].height) {
+            iKeep = iG;
+            iMove = iF;
+        }
+        
+        up.child2 = iKeep;
+        if (upIsChild2) {
+            nodes_[iA].child2 = iMove;
+        } else {
+            nodes_[iA].child1 = iMove;
+        }
+        nodes_[iMove].parent = iA;
+        
+        Node& a = nodes_[iA];
+        a.box = nodes_[iOther].box.unionWith(nodes_[iMove].box);
+        a.height = 1 + std::max(nodes_[iOther].height, nodes_[iMove].height);
+        
+        up.box = a.box.unionWith(nodes_[iKeep].box);
+        up.height = 1 + std::max(a.height, nodes_[iKeep].height);
+        
+        return iUp;
+    };
+    
+    if (currentBalance > 1) {
+        return rotate(iC, iB, true);
+    }
+    
+    if (currentBalance < -1) {
+        return rotate(iB, iC, false);
+    }
+    
+    return iA;
+}
+
+Geometry::BoundingBox DynamicAABBTree::fatten(const Geometry::BoundingBox& bounds,
+                                              const Geometry::Vector3D& displacement) const {
+    Geometry::BoundingBox fat = bounds.expanded(fatMargin_);
+    Geometry::Vector3D d = displacement * kDisplacementMultiplier;
+    
+    // Extend the box in the direction of travel to anticipate the next move
+    if (d.x < 0.0) fat.min.x += d.x; else fat.max.x += d.x;
+    if (d.y < 0.0) fat.min.y += d.y; else fat.max.y += d.y;
+    if (d.z < 0.0) fat.min.z += d.z; else fat.max.z += d.z;
+    
+    return fat;
+}
+
+template<typename Overlaps>
+std::vector<ObjectHandle> DynamicAABBTree::query(Overlaps&& overlaps) const {
+    std::vector<ObjectHandle> result;
+    if (root_ == kNullNode) return result;
+    
+    std::vector<int> stack;
+    stack.reserve(64);
+    stack.push_back(root_);
+    
+    while (!stack.empty()) {
+        int index = stack.back();
+        stack.pop_back();
+        
+        const Node& node = nodes_[index];
+        if (!overlaps(node.box)) continue;
+        
+        if (node.isLeaf()) {
+            result.push_back(node.handle);
+        } else {
+            stack.push_back(node.child1);
+            stack.push_back(node.child2);
+        }
+    }
+    
+    return result;
+}
+
+} // namespace Scene
+} // namespace KitchenCAD
\ No newline at end of file
@@ -0,0 +1,109 @@
+#pragma once
+
+#include "SpatialIndex.h"
+#include <vector>
+
+namespace KitchenCAD {
+namespace Scene {
+
+/**
+ * @brief Dynamic bounding volume hierarchy for broadphase queries
+ * 
+ * Each object is stored in a leaf with a fattened AABB, so small moves
+ * only need a containment check instead of a tree update. Leaves are
+ * inserted using the surface area heuristic and the tree is kept balanced
+ * with AVL-style rotations, which makes it insensitive to the mix of tiny
+ * handles and multi-metre walls that hurts a uniform grid.
+ */
+class DynamicAABBTree : public ISpatialIndex {
+public:
+    /**
+     * @brief Constructor
+     * @param fatMargin Distance each leaf box is enlarged by on insertion
+     */
+    explicit DynamicAABBTree(double fatMargin = 0.05);
+    
+    void addObject(ObjectHandle handle, const Geometry::BoundingBox& bounds) override;
+    void removeObject(ObjectHandle handle, const Geometry::BoundingBox& bounds) override;
+    void updateObject(ObjectHandle handle, const Geometry::BoundingBox& oldBounds,
+                      const Geometry::BoundingBox& newBounds) override;
+    
+    std::vector<ObjectHandle> queryRegion(const Geometry::BoundingBox& region) const override;
+    std::vector<ObjectHandle> queryRadius(const Geometry::Point3D& center, double radius) const override;
+    std::vector<ObjectHandle> queryRay(const Geometry::Ray& ray, double maxDistance) const override;
+    std::vector<ObjectHandle> queryFrustum(const Geometry::Frustum& frustum) const override;
+    
+    /**
+     * @brief Best-first traversal ordered by distance to node boxes
+     */
+    std::vector<std::pair<double, ObjectHandle>> queryNearest(const Geometry::Point3D& point, size_t k,
+                                                              double maxDistance,
+                                                              const DistanceFunction& distance) const override;
+    
+    void clear() override;
+    
+    SpatialIndexType getType() const override { return SpatialIndexType::AABBTree; }
+    
+    /**
+     * @brief Height of the tree (0 for a single leaf, -1 when empty)
+     */
+    int getHeight() const;
+    
+    /**
+     * @brief Largest height difference between sibling subtrees
+     */
+    int getMaxBalance() const;
+    
+    /**
+     * @brief Fattened bounds stored for an object (empty if not indexed)
+     */
+    Geometry::BoundingBox getFatBounds(ObjectHandle handle) const;
+    
+    /**
+     * @brief Number of objects stored in the tree
+     */
+    size_t getObjectCount() const { return objectCount_; }
+    
+    double getFatMargin() const { return fatMargin_; }
+
+private:
+    static constexpr int kNullNode = -1;
+    
+    struct Node {
+        Geometry::BoundingBox box;
+        ObjectHandle handle;        // Valid for leaves only
+        int parent = kNullNode;     // Doubles as the free-list link
+        int child1 = kNullNode;
+        int child2 = kNullNode;
+        int height = -1;            // 0 for leaves, -1 for free nodes
+        
+        bool isLeaf() const { return child1 == kNullNode; }
+    };
+    
+    std::vector<Node> nodes_;
+    int root_;
+    int freeList_;
+    double fatMargin_;
+    
+    // Leaf node per handle slot, kNullNode when the slot is not indexed
+    std::vector<int> leafBySlot_;
+    size_t objectCount_;
+    
+    int findLeaf(ObjectHandle handle) const;
+    int allocateNode();
+    void freeNode(int nodeId);
+    
+    void insertLeaf(int leaf);
+    void removeLeaf(int leaf);
+    int balance(int nodeId);
+    void refitAncestors(int nodeId);
+    
+    Geometry::BoundingBox fatten(const Geometry::BoundingBox& bounds,
+                                 const Geometry::Vector3D& displacement) const;
+    
+    template<typename Overlaps>
+    std::vector<ObjectHandle> query(Overlaps&& overlaps) const;
+};
+
+} // namespace Scene
+} // namespace KitchenCAD
\ No newline at end of file
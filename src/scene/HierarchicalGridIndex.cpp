@@ -0,0 +1,163 @@
+#include "HierarchicalGridIndex.h"
+#include "../utils/Logger.h"
+#include <algorithm>
+#include <iterator>
+
+namespace KitchenCAD {
+namespace Scene {
+
+namespace {
+
+// Objects up to twice the cell size share a level; halving the coarse cells
+// roughly halves the walls and countertops every small query has to reject
+constexpr double kMaxObjectToCellRatio = 2.0;
+
+} // namespace
+
+HierarchicalGridIndex::HierarchicalGridIndex(double cellSize) {
+    if (cellSize <= 0.0) {
+        cellSize = 1.0;
+        LOG_WARNING("Invalid cell size provided, using default value of 1.0");
+    }
+    finestCellSize_ = cellSize / static_cast<double>(1 << kFinerLevels);
+}
+
+void HierarchicalGridIndex::addObject(ObjectHandle handle, const Geometry::BoundingBox& bounds) {
+    if (bounds.isEmpty() || !handle.isValid()) return;
+    
+    getOrCreateLevel(selectLevel(bounds)).addObject(handle, bounds);
+}
+
+void HierarchicalGridIndex::removeObject(ObjectHandle handle, const Geometry::BoundingBox& bounds) {
+    if (bounds.isEmpty()) return;
+    
+    // The level is a pure function of the bounds, so the old bounds locate the object
+    auto& level = levels_[selectLevel(bounds)];
+    if (level) {
+        level->removeObject(handle, bounds);
+    }
+}
+
+void HierarchicalGridIndex::updateObject(ObjectHandle handle, const Geometry::BoundingBox& oldBounds,
+                                         const Geometry::BoundingBox& newBounds) {
+    if (oldBounds.isEmpty() || newBounds.isEmpty()) {
+        removeObject(handle, oldBounds);
+        addObject(handle, newBounds);
+        return;
+    }
+    
+    int oldLevel = selectLevel(oldBounds);
+    int newLevel = selectLevel(newBounds);
+    if (oldLevel == newLevel) {
+        getOrCreateLevel(newLevel).updateObject(handle, oldBounds, newBounds);
+        return;
+    }
+    
+    // Resizing moved the object to another level
+    removeObject(handle, oldBounds);
+    addObject(handle, newBounds);
+}
+
+std::vector<ObjectHandle> HierarchicalGridIndex::queryRegion(const Geometry::BoundingBox& region) const {
+    return collectLevels([&](const HashedGridIndex& level) { return level.queryRegion(region); });
+}
+
+std::vector<ObjectHandle> HierarchicalGridIndex::queryRadius(const Geometry::Point3D& center, double radius) const {
+    return collectLevels([&](const HashedGridIndex& level) { return level.queryRadius(center, radius); });
+}
+
+std::vector<ObjectHandle> HierarchicalGridIndex::queryRay(const Geometry::Ray& ray, double maxDistance) const {
+    return collectLevels([&](const HashedGridIndex& level) { return level.queryRay(ray, maxDistance); });
+}
+
+std::vector<ObjectHandle> HierarchicalGridIndex::queryFrustum(const Geometry::Frustum& frustum) const {
+    return collectLevels([&](const HashedGridIndex& level) { return level.queryFrustum(frustum); });
+}
+
+std::vector<std::pair<double, ObjectHandle>> HierarchicalGridIndex::queryNearest(const Geometry::Point3D& point,
+                                                                                 size_t k, double maxDistance,
+                                                                                 const DistanceFunction& distance) const {
+    std::vector<std::pair<double, ObjectHandle>> nearest;
+    if (k == 0) return nearest;
+    
+    for (const auto& level : levels_) {
+        if (!level || level->getCellCount() == 0) continue;
+        
+        // Once k objects are known, later levels only need to beat the current k-th
+        double bound = nearest.size() == k ? nearest.back().first : maxDistance;
+        auto levelNearest = level->queryNearest(point, k, bound, distance);
+        if (levelNearest.empty()) continue;
+        
+        std::vector<std::pair<double, ObjectHandle>> merged;
+        merged.reserve(std::min(k, nearest.size() + levelNearest.size()));
+        std::merge(nearest.begin(), nearest.end(), levelNearest.begin(), levelNearest.end(),
+                   std::back_inserter(merged));
+        if (merged.size() > k) {
+            merged.resize(k);
+        }
+        nearest.swap(merged);
+    }
+    
+    return nearest;
+}
+
+void HierarchicalGridIndex::clear() {
+    for (auto& level : levels_) {
+        level.reset();
+    }
+}
+
+int HierarchicalGridIndex::selectLevel(const Geometry::BoundingBox& bounds) const {
+    Geometry::Vector3D size = bounds.size();
+    double extent = std::max({size.x, size.y, size.z});
+    
+    int level = 0;
+    double cellSize = finestCellSize_;
+    while (cellSize * kMaxObjectToCellRatio < extent && level < kLevelCount - 1) {
+        cellSize *= 2.0;
+        ++level;
+    }
+    
+    return level;
+}
+
+double HierarchicalGridIndex::getLevelCellSize(int level) const {
+    return finestCellSize_ * static_cast<double>(1 << level);
+}
+
+size_t HierarchicalGridIndex::getCellCount() const {
+    size_t count = 0;
+    for (const auto& level : levels_) {
+        if (level) count += level->getCellCount();
+    }
+    return count;
+}
+
+HashedGridIndex& HierarchicalGridIndex::getOrCreateLevel(int level) {
+    if (!levels_[level]) {
+        levels_[level] = std::make_unique<HashedGridIndex>(getLevelCellSize(level));
+    }
+    return *levels_[level];
+}
+
+template<typename LevelQuery>
+std::vector<ObjectHandle> HierarchicalGridIndex::collectLevels(LevelQuery&& query) const {
+    std::vector<ObjectHandle> result;
+    
+    // Every object lives in exactly one level, so the per-level results are disjoint
+    for (const auto& level : levels_) {
+        if (!level || level->getCellCount() == 0) continue;
+        
+        auto levelResult = query(*level);
+        if (result.empty()) {
+            result = std::move(levelResult);
+        } else {
+            result.insert(result.end(), levelResult.begin(), levelResult.end());
+        }
+    }
+    
+    return result;
+}
+
+} // namespace Scene
+} // namespace KitchenCAD
\ No newline at end of file
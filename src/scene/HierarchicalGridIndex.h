@@ -0,0 +1,87 @@
+#pragma once
+
+#include "SpatialIndex.h"
+#include <array>
+#include <memory>
+#include <vector>
+
+namespace KitchenCAD {
+namespace Scene {
+
+/**
+ * @brief Stack of hashed grids with doubling cell sizes
+ * 
+ * Each object is stored in exactly one level: the finest whose cells are at
+ * least half the object's longest side, so an object never covers more than
+ * 3 x 3 x 3 cells whether it is a drawer handle or a wall. Queries
+ * visit every non-empty level; at each level the cells touched depend only on
+ * the query size relative to that level, which keeps the candidate count
+ * bounded for mixed scenes where any single cell size is wrong for someone.
+ * 
+ * Levels are created on first use. Objects larger than the coarsest level
+ * are stored there and simply cover more cells.
+ */
+class HierarchicalGridIndex : public ISpatialIndex {
+public:
+    static constexpr int kLevelCount = 8;
+    
+    // Levels below the reference cell size passed to the constructor
+    static constexpr int kFinerLevels = 1;
+    
+    /**
+     * @brief Constructor
+     * @param cellSize Reference cell size; levels range from cellSize / 2 to cellSize * 64
+     */
+    explicit HierarchicalGridIndex(double cellSize = 1.0);
+    
+    void addObject(ObjectHandle handle, const Geometry::BoundingBox& bounds) override;
+    void removeObject(ObjectHandle handle, const Geometry::BoundingBox& bounds) override;
+    void updateObject(ObjectHandle handle, const Geometry::BoundingBox& oldBounds,
+                      const Geometry::BoundingBox& newBounds) override;
+    
+    std::vector<ObjectHandle> queryRegion(const Geometry::BoundingBox& region) const override;
+    std::vector<ObjectHandle> queryRadius(const Geometry::Point3D& center, double radius) const override;
+    std::vector<ObjectHandle> queryRay(const Geometry::Ray& ray, double maxDistance) const override;
+    std::vector<ObjectHandle> queryFrustum(const Geometry::Frustum& frustum) const override;
+    
+    /**
+     * @brief Search each level in turn, tightening the cut-off with the best k found so far
+     */
+    std::vector<std::pair<double, ObjectHandle>> queryNearest(const Geometry::Point3D& point, size_t k,
+                                                              double maxDistance,
+                                                              const DistanceFunction& distance) const override;
+    
+    void clear() override;
+    
+    SpatialIndexType getType() const override { return SpatialIndexType::HierarchicalGrid; }
+    
+    /**
+     * @brief Level an object with these bounds is stored in
+     */
+    int selectLevel(const Geometry::BoundingBox& bounds) const;
+    
+    /**
+     * @brief Cell size of a level (0 is the finest)
+     */
+    double getLevelCellSize(int level) const;
+    
+    /**
+     * @brief Number of non-empty cells across all levels
+     */
+    size_t getCellCount() const;
+
+private:
+    double finestCellSize_;
+    std::array<std::unique_ptr<HashedGridIndex>, kLevelCount> levels_;
+    
+    HashedGridIndex& getOrCreateLevel(int level);
+    
+    /**
+     * @brief Concatenate a query over every non-empty level
+     */
+    template<typename LevelQuery>
+    std::vector<ObjectHandle> collectLevels(LevelQuery&& query) const;
+};
+
+} // namespace Scene
+} // namespace KitchenCAD
\ No newline at end of file
@@ -0,0 +1,59 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+
+namespace KitchenCAD {
+namespace Scene {
+
+/**
+ * @brief Compact internal reference to a scene object
+ * 
+ * A handle is a slot index into the scene's object table plus the
+ * generation of that slot. Removing an object bumps the generation, so
+ * stale handles are detected instead of silently aliasing a new object.
+ * String ObjectIds remain the identity used for persistence and the UI;
+ * handles are what the scene, its spatial indexes and collision code use
+ * internally.
+ */
+struct ObjectHandle {
+    static constexpr uint32_t kInvalidSlot = ~uint32_t(0);
+    
+    uint32_t slot = kInvalidSlot;
+    uint32_t generation = 0;
+    
+    ObjectHandle() = default;
+    ObjectHandle(uint32_t slot, uint32_t generation) : slot(slot), generation(generation) {}
+    
+    bool isValid() const { return slot != kInvalidSlot; }
+    
+    /**
+     * @brief Pack into a single 64-bit value (generation in the high half)
+     */
+    uint64_t pack() const { return (static_cast<uint64_t>(generation) << 32) | slot; }
+    
+    static ObjectHandle unpack(uint64_t packed) {
+        return ObjectHandle(static_cast<uint32_t>(packed), static_cast<uint32_t>(packed >> 32));
+    }
+    
+    bool operator==(const ObjectHandle& other) const {
+        return slot == other.slot && generation == other.generation;
+    }
+    
+    bool operator!=(const ObjectHandle& other) const { return !(*this == other); }
+    
+    bool operator<(const ObjectHandle& other) const { return pack() < other.pack(); }
+};
+
+/**
+ * @brief Hash functor for ObjectHandle keys
+ */
+struct ObjectHandleHash {
+    size_t operator()(const ObjectHandle& handle) const {
+        return std::hash<uint64_t>()(handle.pack());
+    }
+};
+
+} // namespace Scene
+} // namespace KitchenCAD
\ No newline at end of file
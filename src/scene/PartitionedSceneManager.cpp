@@ -0,0 +1,821 @@
+#include "PartitionedSceneManager.h"
+#include "../utils/Logger.h"
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <sstream>
+#include <utility>
+
+namespace KitchenCAD {
+namespace Scene {
+
+Geometry::BoundingBox PartitionedSceneManager::Partition::getBounds() const {
+    std::lock_guard<std::mutex> lock(boundsMutex);
+    return bounds;
+}
+
+void PartitionedSceneManager::Partition::expandBounds(const Geometry::BoundingBox& objectBounds) {
+    if (objectBounds.isEmpty()) return;
+    
+    std::lock_guard<std::mutex> lock(boundsMutex);
+    bounds.expand(objectBounds);
+}
+
+PartitionedSceneManager::PartitionedSceneManager(double regionSize, double spatialCellSize,
+                                                 double collisionTolerance, SpatialIndexType indexType)
+    : PartitionedSceneManager(regionPartitioner(regionSize), spatialCellSize, collisionTolerance, indexType) {
+}
+
+PartitionedSceneManager::PartitionedSceneManager(Partitioner partitioner, double spatialCellSize,
+                                                 double collisionTolerance, SpatialIndexType indexType)
+    : partitioner_(std::move(partitioner))
+    , spatialCellSize_(spatialCellSize)
+    , collisionTolerance_(collisionTolerance)
+    , indexType_(indexType)
+    , collisionDetectionEnabled_(true)
+    , randomGenerator_(std::chrono::steady_clock::now().time_since_epoch().count())
+    , idDistribution_(0, std::numeric_limits<uint64_t>::max())
+    , batchDepth_(0) {
+    
+    if (!partitioner_) {
+        partitioner_ = regionPartitioner(10.0);
+        LOG_WARNING("No partitioner provided, using 10 m floor-plan regions");
+    }
+}
+
+PartitionedSceneManager::Partitioner PartitionedSceneManager::regionPartitioner(double regionSize) {
+    if (regionSize <= 0.0) {
+        regionSize = 10.0;
+        LOG_WARNING("Invalid region size provided, using default value of 10.0");
+    }
+    
+    return [inverseSize = 1.0 / regionSize](const SceneObject& object) {
+        const Geometry::Point3D& position = object.getTransform().translation;
+        return HashedGridIndex::encodeCellKey(static_cast<int>(std::floor(position.x * inverseSize)),
+                                              static_cast<int>(std::floor(position.y * inverseSize)), 0);
+    };
+}
+
+ObjectId PartitionedSceneManager::addObject(std::unique_ptr<SceneObject> object) {
+    if (!object) {
+        LOG_ERROR("Cannot add null object to scene");
+        return "";
+    }
+    
+    PartitionId partitionId = partitioner_(*object);
+    
+    // Reserve the id first, so two partitions can never both accept it
+    {
+        std::unique_lock<std::shared_mutex> lock(directoryMutex_);
+        
+        ObjectId id = object->getId();
+        if (!id.empty() && partitionById_.count(id) > 0) {
+            LOG_WARNING("Object with ID " + id + " already exists, generating new ID");
+            id.clear();
+        }
+        if (id.empty()) {
+            id = generateUniqueId();
+        }
+        
+        object->setId(id);
+        partitionById_.emplace(id, partitionId);
+    }
+    
+    PartitionPtr partition = getOrCreatePartition(partitionId);
+    ObjectId id = partition->scene.addObject(std::move(object));
+    partition->expandBounds(partition->scene.getObjectBounds(id));
+    
+    return id;
+}
+
+bool PartitionedSceneManager::removeObject(const ObjectId& id) {
+    PartitionPtr partition = findPartitionOf(id);
+    if (!partition || !partition->scene.removeObject(id)) {
+        LOG_WARNING("Attempted to remove non-existent object: " + id);
+        return false;
+    }
+    
+    {
+        std::unique_lock<std::shared_mutex> lock(directoryMutex_);
+        partitionById_.erase(id);
+    }
+    
+    std::vector<ObjectId> selection;
+    {
+        std::lock_guard<std::mutex> lock(selectionMutex_);
+        if (selection_.erase(id) == 0) return true;
+        selection.assign(selection_.begin(), selection_.end());
+    }
+    notifySelectionChanged(selection);
+    
+    return true;
+}
+
+SceneObject* PartitionedSceneManager::getObject(const ObjectId& id) {
+    PartitionPtr partition = findPartitionOf(id);
+    return partition ? partition->scene.getObject(id) : nullptr;
+}
+
+const SceneObject* PartitionedSceneManager::getObject(const ObjectId& id) const {
+    PartitionPtr partition = findPartitionOf(id);
+    return partition ? std::as_const(partition->scene).getObject(id) : nullptr;
+}
+
+bool PartitionedSceneManager::modifyObject(const ObjectId& id, const std::function<void(SceneObject&)>& edit) {
+    PartitionPtr partition = findPartitionOf(id);
+    if (!partition || !partition->scene.modifyObject(id, edit)) {
+        return false;
+    }
+    
+    // The edit may have moved or resized the object; it stays in its partition
+    partition->expandBounds(partition->scene.getObjectBounds(id));
+    return true;
+}
+
+std::vector<ObjectId> PartitionedSceneManager::getAllObjects() const {
+    std::vector<ObjectId> result;
+    for (const auto& partition : allPartitions()) {
+        auto ids = partition->scene.getAllObjects();
+        result.insert(result.end(), ids.begin(), ids.end());
+    }
+    return result;
+}
+
+std::vector<ObjectId> PartitionedSceneManager::getObjectsInRegion(const Geometry::BoundingBox& region) const {
+    std::vector<ObjectId> result;
+    for (const auto& partition : partitionsOverlapping(region)) {
+        auto ids = partition->scene.getObjectsInRegion(region);
+        result.insert(result.end(), ids.begin(), ids.end());
+    }
+    return result;
+}
+
+std::vector<ObjectId> PartitionedSceneManager::getObjectsOfType(const std::string& type) const {
+    std::vector<ObjectId> result;
+    for (const auto& partition : allPartitions()) {
+        auto ids = partition->scene.getObjectsOfType(type);
+        result.insert(result.end(), ids.begin(), ids.end());
+    }
+    return result;
+}
+
+std::vector<ObjectId> PartitionedSceneManager::getObjectsByCategory(const std::string& category) const {
+    std::vector<ObjectId> result;
+    for (const auto& partition : allPartitions()) {
+        auto ids = partition->scene.getObjectsByCategory(category);
+        result.insert(result.end(), ids.begin(), ids.end());
+    }
+    return result;
+}
+
+std::vector<ObjectId> PartitionedSceneManager::findIntersectingObjects(const ObjectId& objectId) const {
+    PartitionPtr owner = findPartitionOf(objectId);
+    if (!owner) {
+        return {};
+    }
+    
+    std::vector<ObjectId> result = owner->scene.findIntersectingObjects(objectId);
+    
+    const SceneObject* object = std::as_const(owner->scene).getObject(objectId);
+    if (!object) {
+        return result;
+    }
+    
+    Geometry::OrientedBoundingBox box = owner->scene.getOrientedBoundsAt(objectId, object->getTransform());
+    for (const auto& partition : partitionsOverlapping(box.bounds().expanded(collisionTolerance_))) {
+        if (partition == owner) continue;
+        
+        auto ids = partition->scene.findObjectsOverlapping(box);
+        result.insert(result.end(), ids.begin(), ids.end());
+    }
+    
+    return result;
+}
+
+std::vector<ObjectId> PartitionedSceneManager::findNearbyObjects(const ObjectId& objectId, double radius) const {
+    PartitionPtr owner = findPartitionOf(objectId);
+    if (!owner) {
+        return {};
+    }
+    
+    std::vector<ObjectId> result = owner->scene.findNearbyObjects(objectId, radius);
+    
+    // Object centres lie inside their partition's bounds, so farther partitions cannot contribute
+    Geometry::Point3D center = owner->scene.getObjectBounds(objectId).center();
+    for (const auto& partition : allPartitions()) {
+        if (partition == owner || partition->getBounds().distanceTo(center) > radius) continue;
+        
+        auto ids = partition->scene.findObjectsWithinRadius(center, radius);
+        result.insert(result.end(), ids.begin(), ids.end());
+    }
+    
+    return result;
+}
+
+std::vector<ObjectId> PartitionedSceneManager::findNearestObjects(const Geometry::Point3D& point, size_t k,
+                                                                  double maxDistance) const {
+    if (k == 0) return {};
+    
+    // Visit partitions nearest first; each can only improve on the current k-th distance
+    std::vector<std::pair<double, PartitionPtr>> candidates;
+    for (const auto& partition : allPartitions()) {
+        double distance = partition->getBounds().distanceTo(point);
+        if (distance <= maxDistance) {
+            candidates.emplace_back(distance, partition);
+        }
+    }
+    std::sort(candidates.begin(), candidates.end(),
+              [](const auto& a, const auto& b) { return a.first < b.first; });
+    
+    std::vector<std::pair<double, ObjectId>> nearest;
+    for (const auto& [partitionDistance, partition] : candidates) {
+        double bound = nearest.size() == k ? nearest.back().first : maxDistance;
+        if (partitionDistance > bound) break;
+        
+        for (const auto& id : partition->scene.findNearestObjects(point, k, bound)) {
+            nearest.emplace_back(partition->scene.getObjectBounds(id).distanceTo(point), id);
+        }
+        
+        std::stable_sort(nearest.begin(), nearest.end(),
+                         [](const auto& a, const auto& b) { return a.first < b.first; });
+        if (nearest.size() > k) {
+            nearest.resize(k);
+        }
+    }
+    
+    std::vector<ObjectId> result;
+    result.reserve(nearest.size());
+    for (auto& [distance, id] : nearest) {
+        result.push_back(std::move(id));
+    }
+    
+    return result;
+}
+
+bool PartitionedSceneManager::checkCollision(const ObjectId& objectId,
+                                             const Geometry::Transform3D& newTransform) const {
+    if (!collisionDetectionEnabled_) {
+        return false;
+    }
+    
+    PartitionPtr owner = findPartitionOf(objectId);
+    if (!owner) {
+        return false;
+    }
+    
+    if (owner->scene.checkCollision(objectId, newTransform)) {
+        return true;
+    }
+    
+    return collidesInOtherPartitions(*owner, owner->scene.getOrientedBoundsAt(objectId, newTransform));
+}
+
+SweepResult PartitionedSceneManager::checkSweptCollision(const ObjectId& objectId,
+                                                         const Geometry::Transform3D& fromTransform,
+                                                         const Geometry::Transform3D& toTransform) const {
+    SweepResult result;
+    result.transform = toTransform;
+    
+    PartitionPtr owner = findPartitionOf(objectId);
+    if (!owner || !collisionDetectionEnabled_) {
+        return result;
+    }
+    
+    result = owner->scene.checkSweptCollision(objectId, fromTransform, toTransform);
+    
+    Geometry::BoundingBox startBounds = owner->scene.getOrientedBoundsAt(objectId, fromTransform).bounds();
+    Geometry::BoundingBox endBounds = owner->scene.getOrientedBoundsAt(objectId, toTransform).bounds();
+    
+    // The swept box uses the larger of both sizes, so pad the union by that before culling partitions
+    Geometry::Vector3D startSize = startBounds.size();
+    Geometry::Vector3D endSize = endBounds.size();
+    double pad = std::max({startSize.x, startSize.y, startSize.z, endSize.x, endSize.y, endSize.z});
+    Geometry::BoundingBox region = startBounds;
+    region.expand(endBounds);
+    
+    bool blockedElsewhere = false;
+    for (const auto& partition : partitionsOverlapping(region.expanded(pad))) {
+        if (partition == owner) continue;
+        
+        SweepResult hit = partition->scene.sweepBounds(startBounds, endBounds);
+        if (hit.collided && hit.timeOfImpact < result.timeOfImpact) {
+            result.collided = true;
+            result.timeOfImpact = hit.timeOfImpact;
+            result.blockingObject = hit.blockingObject;
+            blockedElsewhere = true;
+        }
+    }
+    
+    if (blockedElsewhere) {
+        result.transform = toTransform;
+        result.transform.translation = fromTransform.translation +
+                                       (toTransform.translation - fromTransform.translation) * result.timeOfImpact;
+    }
+    
+    return result;
+}
+
+bool PartitionedSceneManager::moveObject(const ObjectId& id, const Geometry::Transform3D& transform) {
+    PartitionPtr owner = findPartitionOf(id);
+    if (!owner) {
+        LOG_WARNING("Cannot transform non-existent object: " + id);
+        return false;
+    }
+    
+    // The owner checks its own objects when applying the move; neighbours are checked here
+    if (collisionDetectionEnabled_ &&
+        collidesInOtherPartitions(*owner, owner->scene.getOrientedBoundsAt(id, transform))) {
+        LOG_DEBUG("Transform rejected due to collision in another partition for object: " + id);
+        return false;
+    }
+    
+    if (!owner->scene.moveObject(id, transform)) {
+        return false;
+    }
+    
+    owner->expandBounds(owner->scene.getObjectBounds(id));
+    return true;
+}
+
+bool PartitionedSceneManager::translateObject(const ObjectId& id, const Geometry::Vector3D& translation) {
+    return updateTransform(id, [&](Geometry::Transform3D& transform) { transform.translate(translation); });
+}
+
+bool PartitionedSceneManager::rotateObject(const ObjectId& id, const Geometry::Vector3D& rotation) {
+    return updateTransform(id, [&](Geometry::Transform3D& transform) { transform.rotate(rotation); });
+}
+
+bool PartitionedSceneManager::scaleObject(const ObjectId& id, const Geometry::Vector3D& scale) {
+    return updateTransform(id, [&](Geometry::Transform3D& transform) { transform.scaleBy(scale); });
+}
+
+template<typename TransformUpdate>
+bool PartitionedSceneManager::updateTransform(const ObjectId& id, TransformUpdate&& update) {
+    const SceneObject* object = std::as_const(*this).getObject(id);
+    if (!object) return false;
+    
+    Geometry::Transform3D transform = object->getTransform();
+    update(transform);
+    
+    return moveObject(id, transform);
+}
+
+bool PartitionedSceneManager::applyTransforms(std::span<const ObjectTransform> transforms) {
+    // Group by partition, keeping each partition's share in the caller's order
+    std::map<PartitionId, std::vector<ObjectTransform>> groups;
+    std::vector<std::pair<PartitionPtr, Geometry::OrientedBoundingBox>> moved;
+    std::unordered_map<ObjectId, size_t> batch;     // Object to its last entry; later transforms win
+    moved.reserve(transforms.size());
+    
+    for (size_t i = 0; i < transforms.size(); ++i) {
+        const auto& [id, transform] = transforms[i];
+        PartitionPtr owner = findPartitionOf(id);
+        if (!owner) {
+            LOG_WARNING("Cannot transform non-existent object: " + id);
+            return false;
+        }
+        
+        groups[owner->id].emplace_back(id, transform);
+        moved.emplace_back(owner, owner->scene.getOrientedBoundsAt(id, transform));
+        batch[id] = i;
+    }
+    
+    // Validate against every partition before applying any group, so a
+    // rejection leaves all partitions untouched
+    if (collisionDetectionEnabled_) {
+        for (size_t i = 0; i < moved.size(); ++i) {
+            const Geometry::OrientedBoundingBox& box = moved[i].second;
+            for (const auto& partition : partitionsOverlapping(box.bounds().expanded(collisionTolerance_))) {
+                for (const auto& hit : partition->scene.findObjectsOverlapping(box)) {
+                    if (batch.count(hit) == 0) {
+                        LOG_DEBUG("Batch transform rejected due to collision for object: " + transforms[i].first);
+                        return false;
+                    }
+                }
+            }
+        }
+        
+        // Batch members may sit in different partitions, so test their final boxes against each other here
+        std::vector<Geometry::OrientedBoundingBox> finalBoxes;
+        std::vector<Geometry::OrientedBoundingBox> currentBoxes;
+        std::vector<size_t> finalEntries;
+        finalBoxes.reserve(batch.size());
+        currentBoxes.reserve(batch.size());
+        finalEntries.reserve(batch.size());
+        for (const auto& [id, entry] : batch) {
+            const SceneObject* object = std::as_const(moved[entry].first->scene).getObject(id);
+            if (!object) {
+                LOG_WARNING("Cannot transform non-existent object: " + id);
+                return false;
+            }
+            
+            finalBoxes.push_back(moved[entry].second);
+            currentBoxes.push_back(moved[entry].first->scene.getOrientedBoundsAt(id, object->getTransform()));
+            finalEntries.push_back(entry);
+        }
+        
+        // Members already in contact, such as cabinets side by side, may stay so
+        auto introduced = Geometry::findOverlappingPair(finalBoxes, collisionTolerance_, [&](size_t a, size_t b) {
+            return !currentBoxes[a].intersects(currentBoxes[b], collisionTolerance_);
+        });
+        if (introduced) {
+            LOG_DEBUG("Batch transform rejected: objects would overlap each other, including " +
+                      transforms[finalEntries[introduced->first]].first);
+            return false;
+        }
+    }
+    
+    for (const auto& [partitionId, group] : groups) {
+        PartitionPtr partition = findPartition(partitionId);
+        if (!partition || !partition->scene.applyTransforms(group)) {
+            LOG_WARNING("Batch transform only partly applied: partition changed concurrently");
+            return false;
+        }
+        
+        for (const auto& [id, transform] : group) {
+            partition->expandBounds(partition->scene.getObjectBounds(id));
+        }
+    }
+    
+    return true;
+}
+
+void PartitionedSceneManager::setSelection(const std::vector<ObjectId>& selection) {
+    std::vector<ObjectId> current;
+    {
+        std::shared_lock<std::shared_mutex> directoryLock(directoryMutex_);
+        std::lock_guard<std::mutex> lock(selectionMutex_);
+        
+        selection_.clear();
+        for (const auto& id : selection) {
+            if (partitionById_.count(id) > 0) {
+                selection_.insert(id);
+            }
+        }
+        current.assign(selection_.begin(), selection_.end());
+    }
+    
+    notifySelectionChanged(current);
+}
+
+void PartitionedSceneManager::addToSelection(const ObjectId& id) {
+    std::vector<ObjectId> current;
+    {
+        std::shared_lock<std::shared_mutex> directoryLock(directoryMutex_);
+        std::lock_guard<std::mutex> lock(selectionMutex_);
+        
+        if (partitionById_.count(id) == 0 || !selection_.insert(id).second) return;
+        current.assign(selection_.begin(), selection_.end());
+    }
+    
+    notifySelectionChanged(current);
+}
+
+void PartitionedSceneManager::removeFromSelection(const ObjectId& id) {
+    std::vector<ObjectId> current;
+    {
+        std::lock_guard<std::mutex> lock(selectionMutex_);
+        
+        if (selection_.erase(id) == 0) return;
+        current.assign(selection_.begin(), selection_.end());
+    }
+    
+    notifySelectionChanged(current);
+}
+
+void PartitionedSceneManager::clearSelection() {
+    {
+        std::lock_guard<std::mutex> lock(selectionMutex_);
+        
+        if (selection_.empty()) return;
+        selection_.clear();
+    }
+    
+    notifySelectionChanged({});
+}
+
+std::vector<ObjectId> PartitionedSceneManager::getSelection() const {
+    std::lock_guard<std::mutex> lock(selectionMutex_);
+    return std::vector<ObjectId>(selection_.begin(), selection_.end());
+}
+
+bool PartitionedSceneManager::isSelected(const ObjectId& id) const {
+    std::lock_guard<std::mutex> lock(selectionMutex_);
+    return selection_.count(id) > 0;
+}
+
+Geometry::BoundingBox PartitionedSceneManager::getSceneBounds() const {
+    Geometry::BoundingBox result;
+    for (const auto& partition : allPartitions()) {
+        result.expand(partition->scene.getSceneBounds());
+    }
+    return result;
+}
+
+size_t PartitionedSceneManager::getObjectCount() const {
+    std::shared_lock<std::shared_mutex> lock(directoryMutex_);
+    return partitionById_.size();
+}
+
+bool PartitionedSceneManager::isEmpty() const {
+    std::shared_lock<std::shared_mutex> lock(directoryMutex_);
+    return partitionById_.empty();
+}
+
+void PartitionedSceneManager::clear() {
+    std::map<PartitionId, PartitionPtr> cleared;
+    {
+        std::unique_lock<std::shared_mutex> partitionsLock(partitionsMutex_);
+        std::unique_lock<std::shared_mutex> directoryLock(directoryMutex_);
+        
+        cleared.swap(partitions_);
+        partitionById_.clear();
+    }
+    
+    // Partitions handed out by getPartition() keep their objects until released
+    for (auto& [partitionId, partition] : cleared) {
+        partition->scene.clear();
+    }
+    
+    clearSelection();
+    
+    LOG_INFO("Partitioned scene cleared");
+}
+
+std::unique_ptr<SceneObject> PartitionedSceneManager::duplicateObject(const ObjectId& id) {
+    PartitionPtr partition = findPartitionOf(id);
+    if (!partition) {
+        LOG_WARNING("Cannot duplicate non-existent object: " + id);
+        return nullptr;
+    }
+    
+    return partition->scene.duplicateObject(id);
+}
+
+void PartitionedSceneManager::forEachObject(std::function<void(const ObjectId&, SceneObject*)> callback) {
+    for (const auto& partition : allPartitions()) {
+        partition->scene.forEachObject(callback);
+    }
+}
+
+void PartitionedSceneManager::forEachObject(std::function<void(const ObjectId&, const SceneObject*)> callback) const {
+    for (const auto& partition : allPartitions()) {
+        std::as_const(partition->scene).forEachObject(callback);
+    }
+}
+
+void PartitionedSceneManager::setObjectAddedCallback(ObjectCallback callback) {
+    std::unique_lock<std::shared_mutex> lock(partitionsMutex_);
+    objectAddedCallback_ = callback;
+    for (auto& [partitionId, partition] : partitions_) {
+        partition->scene.setObjectAddedCallback(callback);
+    }
+}
+
+void PartitionedSceneManager::setObjectRemovedCallback(ObjectCallback callback) {
+    std::unique_lock<std::shared_mutex> lock(partitionsMutex_);
+    objectRemovedCallback_ = callback;
+    for (auto& [partitionId, partition] : partitions_) {
+        partition->scene.setObjectRemovedCallback(callback);
+    }
+}
+
+void PartitionedSceneManager::setObjectModifiedCallback(ObjectCallback callback) {
+    std::unique_lock<std::shared_mutex> lock(partitionsMutex_);
+    objectModifiedCallback_ = callback;
+    for (auto& [partitionId, partition] : partitions_) {
+        partition->scene.setObjectModifiedCallback(callback);
+    }
+}
+
+void PartitionedSceneManager::setObjectsModifiedCallback(ObjectsCallback callback) {
+    std::unique_lock<std::shared_mutex> lock(partitionsMutex_);
+    objectsModifiedCallback_ = callback;
+    for (auto& [partitionId, partition] : partitions_) {
+        partition->scene.setObjectsModifiedCallback(callback);
+    }
+}
+
+void PartitionedSceneManager::setSelectionChangedCallback(SelectionCallback callback) {
+    std::lock_guard<std::mutex> lock(selectionMutex_);
+    selectionChangedCallback_ = callback;
+}
+
+void PartitionedSceneManager::setChangeSetCallback(ChangeSetCallback callback) {
+    std::unique_lock<std::shared_mutex> lock(partitionsMutex_);
+    changeSetCallback_ = callback;
+    for (auto& [partitionId, partition] : partitions_) {
+        partition->scene.setChangeSetCallback(callback);
+    }
+}
+
+void PartitionedSceneManager::beginBatch() {
+    std::unique_lock<std::shared_mutex> lock(partitionsMutex_);
+    ++batchDepth_;
+    for (auto& [partitionId, partition] : partitions_) {
+        partition->scene.beginBatch();
+    }
+}
+
+void PartitionedSceneManager::endBatch() {
+    std::vector<PartitionPtr> partitions;
+    {
+        std::unique_lock<std::shared_mutex> lock(partitionsMutex_);
+        if (batchDepth_ == 0) {
+            LOG_WARNING("endBatch called without a matching beginBatch");
+            return;
+        }
+        
+        --batchDepth_;
+        for (const auto& [partitionId, partition] : partitions_) {
+            partitions.push_back(partition);
+        }
+    }
+    
+    // Partitions deliver their change sets here, so do not hold the partition map
+    for (const auto& partition : partitions) {
+        partition->scene.endBatch();
+    }
+}
+
+void PartitionedSceneManager::setChangeFlushScheduler(std::function<void()> scheduler) {
+    std::vector<PartitionPtr> partitions;
+    {
+        std::unique_lock<std::shared_mutex> lock(partitionsMutex_);
+        flushScheduler_ = scheduler;
+        for (const auto& [partitionId, partition] : partitions_) {
+            partitions.push_back(partition);
+        }
+    }
+    
+    for (const auto& partition : partitions) {
+        partition->scene.setChangeFlushScheduler(scheduler);
+    }
+}
+
+void PartitionedSceneManager::flushChanges() {
+    for (const auto& partition : allPartitions()) {
+        partition->scene.flushChanges();
+    }
+}
+
+size_t PartitionedSceneManager::getPartitionCount() const {
+    std::shared_lock<std::shared_mutex> lock(partitionsMutex_);
+    return partitions_.size();
+}
+
+std::vector<PartitionedSceneManager::PartitionId> PartitionedSceneManager::getPartitionIds() const {
+    std::shared_lock<std::shared_mutex> lock(partitionsMutex_);
+    
+    std::vector<PartitionId> result;
+    result.reserve(partitions_.size());
+    for (const auto& [partitionId, partition] : partitions_) {
+        result.push_back(partitionId);
+    }
+    return result;
+}
+
+std::optional<PartitionedSceneManager::PartitionId> PartitionedSceneManager::getPartitionOf(const ObjectId& id) const {
+    std::shared_lock<std::shared_mutex> lock(directoryMutex_);
+    
+    auto it = partitionById_.find(id);
+    if (it == partitionById_.end()) {
+        return std::nullopt;
+    }
+    return it->second;
+}
+
+std::shared_ptr<SceneManager> PartitionedSceneManager::getPartition(PartitionId partitionId) const {
+    PartitionPtr partition = findPartition(partitionId);
+    if (!partition) {
+        return nullptr;
+    }
+    
+    // Shares ownership of the partition while pointing at its scene
+    return std::shared_ptr<SceneManager>(partition, &partition->scene);
+}
+
+std::vector<PartitionedSceneManager::PartitionId>
+PartitionedSceneManager::getPartitionsInRegion(const Geometry::BoundingBox& region) const {
+    std::vector<PartitionId> result;
+    for (const auto& partition : partitionsOverlapping(region)) {
+        result.push_back(partition->id);
+    }
+    return result;
+}
+
+void PartitionedSceneManager::setCollisionDetectionEnabled(bool enabled) {
+    std::unique_lock<std::shared_mutex> lock(partitionsMutex_);
+    collisionDetectionEnabled_ = enabled;
+    for (auto& [partitionId, partition] : partitions_) {
+        partition->scene.setCollisionDetectionEnabled(enabled);
+    }
+}
+
+PartitionedSceneManager::PartitionPtr PartitionedSceneManager::findPartition(PartitionId partitionId) const {
+    std::shared_lock<std::shared_mutex> lock(partitionsMutex_);
+    
+    auto it = partitions_.find(partitionId);
+    return it != partitions_.end() ? it->second : nullptr;
+}
+
+PartitionedSceneManager::PartitionPtr PartitionedSceneManager::findPartitionOf(const ObjectId& id) const {
+    std::optional<PartitionId> partitionId = getPartitionOf(id);
+    return partitionId ? findPartition(*partitionId) : nullptr;
+}
+
+PartitionedSceneManager::PartitionPtr PartitionedSceneManager::getOrCreatePartition(PartitionId partitionId) {
+    if (PartitionPtr existing = findPartition(partitionId)) {
+        return existing;
+    }
+    
+    std::unique_lock<std::shared_mutex> lock(partitionsMutex_);
+    
+    auto [it, inserted] = partitions_.try_emplace(partitionId);
+    if (!inserted) {
+        return it->second;
+    }
+    
+    // A new partition joins with the callbacks, settings and open batches of the others
+    auto partition = std::make_shared<Partition>(partitionId, spatialCellSize_, collisionTolerance_, indexType_);
+    SceneManager& scene = partition->scene;
+    scene.setCollisionDetectionEnabled(collisionDetectionEnabled_);
+    scene.setObjectAddedCallback(objectAddedCallback_);
+    scene.setObjectRemovedCallback(objectRemovedCallback_);
+    scene.setObjectModifiedCallback(objectModifiedCallback_);
+    scene.setObjectsModifiedCallback(objectsModifiedCallback_);
+    scene.setChangeSetCallback(changeSetCallback_);
+    scene.setChangeFlushScheduler(flushScheduler_);
+    for (int i = 0; i < batchDepth_; ++i) {
+        scene.beginBatch();
+    }
+    
+    it->second = partition;
+    return partition;
+}
+
+std::vector<PartitionedSceneManager::PartitionPtr> PartitionedSceneManager::allPartitions() const {
+    std::shared_lock<std::shared_mutex> lock(partitionsMutex_);
+    
+    std::vector<PartitionPtr> result;
+    result.reserve(partitions_.size());
+    for (const auto& [partitionId, partition] : partitions_) {
+        result.push_back(partition);
+    }
+    return result;
+}
+
+std::vector<PartitionedSceneManager::PartitionPtr>
+PartitionedSceneManager::partitionsOverlapping(const Geometry::BoundingBox& region) const {
+    std::shared_lock<std::shared_mutex> lock(partitionsMutex_);
+    
+    std::vector<PartitionPtr> result;
+    for (const auto& [partitionId, partition] : partitions_) {
+        if (region.intersects(partition->getBounds())) {
+            result.push_back(partition);
+        }
+    }
+    return result;
+}
+
+bool PartitionedSceneManager::collidesInOtherPartitions(const Partition& owner,
+                                                        const Geometry::OrientedBoundingBox& box) const {
+    for (const auto& partition : partitionsOverlapping(box.bounds().expanded(collisionTolerance_))) {
+        if (partition.get() != &owner && !partition->scene.findObjectsOverlapping(box).empty()) {
+            return true;
+        }
+    }
+    return false;
+}
+
+ObjectId PartitionedSceneManager::generateUniqueId() {
+    std::ostringstream oss;
+    do {
+        oss.str("");
+        oss << "obj_" << std::hex << idDistribution_(randomGenerator_);
+    } while (partitionById_.count(oss.str()) > 0);
+    
+    return oss.str();
+}
+
+void PartitionedSceneManager::notifySelectionChanged(const std::vector<ObjectId>& selection) {
+    SelectionCallback callback;
+    {
+        std::lock_guard<std::mutex> lock(selectionMutex_);
+        callback = selectionChangedCallback_;
+    }
+    
+    if (callback) {
+        callback(selection);
+    }
+}
+
+std::unique_ptr<ISceneManager> createSceneManager(size_t objectCount) {
+    if (objectCount >= kPartitionedSceneObjectThreshold) {
+        return std::make_unique<PartitionedSceneManager>();
+    }
+    return std::make_unique<SceneManager>();
+}
+
+} // namespace Scene
+} // namespace KitchenCAD
\ No newline at end of file
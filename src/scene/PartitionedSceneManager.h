@@ -0,0 +1,256 @@
+#pragma once
+
+#include "../interfaces/ISceneManager.h"
+#include "SceneManager.h"
+#include <atomic>
+#include <cstdint>
+#include <functional>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <random>
+#include <shared_mutex>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+namespace KitchenCAD {
+namespace Scene {
+
+/**
+ * @brief Scene split into independently locked partitions
+ * 
+ * Each partition is a complete SceneManager with its own lock, spatial index
+ * and collision state, so an edit in one room never waits for validation or
+ * rendering reading another. An object is assigned a partition when it is
+ * added, by default from the floor-plan region containing its position, or
+ * by a custom partitioner such as one that reads the room it was placed in.
+ * It stays in that partition when moved.
+ * 
+ * Every partition keeps conservative bounds of its contents. Region,
+ * nearest-neighbour and collision queries only visit partitions whose bounds
+ * can hold an answer, and collision checks test a moving object against
+ * neighbouring partitions as well as its own.
+ * 
+ * Operations spanning partitions are not atomic: a batch move is validated
+ * against every partition before any of it is applied, but an edit running
+ * concurrently in another partition may interleave. A notification batch
+ * spanning partitions is delivered as one change set per partition.
+ */
+class PartitionedSceneManager : public ISceneManager {
+public:
+    using PartitionId = uint64_t;
+    
+    /**
+     * @brief Chooses the partition of a newly added object
+     */
+    using Partitioner = std::function<PartitionId(const SceneObject& object)>;
+    
+    /**
+     * @brief Constructor partitioning the floor plan into square regions
+     * @param regionSize Side of each region in metres; one partition per occupied region
+     */
+    explicit PartitionedSceneManager(double regionSize = 10.0, double spatialCellSize = 1.0,
+                                     double collisionTolerance = 1e-6,
+                                     SpatialIndexType indexType = SpatialIndexType::HashedGrid);
+    
+    /**
+     * @brief Constructor with a custom partitioner, e.g. by room
+     */
+    explicit PartitionedSceneManager(Partitioner partitioner, double spatialCellSize = 1.0,
+                                     double collisionTolerance = 1e-6,
+                                     SpatialIndexType indexType = SpatialIndexType::HashedGrid);
+    
+    ~PartitionedSceneManager() override = default;
+    
+    // Non-copyable
+    PartitionedSceneManager(const PartitionedSceneManager&) = delete;
+    PartitionedSceneManager& operator=(const PartitionedSceneManager&) = delete;
+    
+    // ISceneManager interface implementation
+    ObjectId addObject(std::unique_ptr<SceneObject> object) override;
+    bool removeObject(const ObjectId& id) override;
+    SceneObject* getObject(const ObjectId& id) override;
+    const SceneObject* getObject(const ObjectId& id) const override;
+    bool modifyObject(const ObjectId& id, const std::function<void(SceneObject&)>& edit) override;
+    
+    std::vector<ObjectId> getAllObjects() const override;
+    std::vector<ObjectId> getObjectsInRegion(const Geometry::BoundingBox& region) const override;
+    std::vector<ObjectId> getObjectsOfType(const std::string& type) const override;
+    std::vector<ObjectId> getObjectsByCategory(const std::string& category) const override;
+    
+    std::vector<ObjectId> findIntersectingObjects(const ObjectId& objectId) const override;
+    std::vector<ObjectId> findNearbyObjects(const ObjectId& objectId, double radius) const override;
+    std::vector<ObjectId> findNearestObjects(const Geometry::Point3D& point, size_t k,
+                                             double maxDistance = std::numeric_limits<double>::infinity()) const override;
+    bool checkCollision(const ObjectId& objectId, const Geometry::Transform3D& newTransform) const override;
+    SweepResult checkSweptCollision(const ObjectId& objectId, const Geometry::Transform3D& fromTransform,
+                                    const Geometry::Transform3D& toTransform) const override;
+    
+    bool moveObject(const ObjectId& id, const Geometry::Transform3D& transform) override;
+    bool translateObject(const ObjectId& id, const Geometry::Vector3D& translation) override;
+    bool rotateObject(const ObjectId& id, const Geometry::Vector3D& rotation) override;
+    bool scaleObject(const ObjectId& id, const Geometry::Vector3D& scale) override;
+    bool applyTransforms(std::span<const ObjectTransform> transforms) override;
+    
+    void setSelection(const std::vector<ObjectId>& selection) override;
+    void addToSelection(const ObjectId& id) override;
+    void removeFromSelection(const ObjectId& id) override;
+    void clearSelection() override;
+    std::vector<ObjectId> getSelection() const override;
+    bool isSelected(const ObjectId& id) const override;
+    
+    Geometry::BoundingBox getSceneBounds() const override;
+    size_t getObjectCount() const override;
+    bool isEmpty() const override;
+    
+    void clear() override;
+    std::unique_ptr<SceneObject> duplicateObject(const ObjectId& id) override;
+    
+    void forEachObject(std::function<void(const ObjectId&, SceneObject*)> callback) override;
+    void forEachObject(std::function<void(const ObjectId&, const SceneObject*)> callback) const override;
+    
+    void setObjectAddedCallback(ObjectCallback callback) override;
+    void setObjectRemovedCallback(ObjectCallback callback) override;
+    void setObjectModifiedCallback(ObjectCallback callback) override;
+    void setObjectsModifiedCallback(ObjectsCallback callback) override;
+    void setSelectionChangedCallback(SelectionCallback callback) override;
+    
+    void setChangeSetCallback(ChangeSetCallback callback) override;
+    void beginBatch() override;
+    void endBatch() override;
+    void setChangeFlushScheduler(std::function<void()> scheduler) override;
+    void flushChanges() override;
+    
+    // Partition access
+    
+    /**
+     * @brief Partitioner placing objects by the floor-plan region of their position
+     */
+    static Partitioner regionPartitioner(double regionSize);
+    
+    size_t getPartitionCount() const;
+    std::vector<PartitionId> getPartitionIds() const;
+    
+    /**
+     * @brief Partition holding an object
+     */
+    std::optional<PartitionId> getPartitionOf(const ObjectId& id) const;
+    
+    /**
+     * @brief Scene of one partition, for work confined to a room
+     * 
+     * Stays valid after clear() but is then detached from this scene.
+     */
+    std::shared_ptr<SceneManager> getPartition(PartitionId partitionId) const;
+    
+    /**
+     * @brief Partitions whose contents may overlap a region
+     */
+    std::vector<PartitionId> getPartitionsInRegion(const Geometry::BoundingBox& region) const;
+    
+    /**
+     * @brief Enable or disable collision detection in every partition
+     */
+    void setCollisionDetectionEnabled(bool enabled);
+    bool isCollisionDetectionEnabled() const { return collisionDetectionEnabled_; }
+
+private:
+    /**
+     * @brief One partition: its scene and a conservative box around its objects
+     * 
+     * The box grows as objects are added or moved and is only reset by
+     * clear(), so it may be larger than the contents but never smaller.
+     */
+    struct Partition {
+        PartitionId id;
+        SceneManager scene;
+        
+        mutable std::mutex boundsMutex;
+        Geometry::BoundingBox bounds;
+        
+        Partition(PartitionId id, double spatialCellSize, double collisionTolerance, SpatialIndexType indexType)
+            : id(id), scene(spatialCellSize, collisionTolerance, indexType) {}
+        
+        Geometry::BoundingBox getBounds() const;
+        void expandBounds(const Geometry::BoundingBox& objectBounds);
+    };
+    
+    using PartitionPtr = std::shared_ptr<Partition>;
+    
+    Partitioner partitioner_;
+    double spatialCellSize_;
+    double collisionTolerance_;
+    SpatialIndexType indexType_;
+    std::atomic<bool> collisionDetectionEnabled_;
+    
+    // Partitions by id; also guards the settings new partitions inherit
+    mutable std::shared_mutex partitionsMutex_;
+    std::map<PartitionId, PartitionPtr> partitions_;
+    
+    // Which partition each object lives in. Held only for lookups and
+    // insertions, never while a partition is working
+    mutable std::shared_mutex directoryMutex_;
+    std::unordered_map<ObjectId, PartitionId> partitionById_;
+    std::mt19937 randomGenerator_;
+    std::uniform_int_distribution<uint64_t> idDistribution_;
+    
+    // Selection spans partitions, so it is kept here rather than in them
+    mutable std::mutex selectionMutex_;
+    std::unordered_set<ObjectId> selection_;
+    
+    // Callbacks and batching state installed on every partition, including later ones
+    ObjectCallback objectAddedCallback_;
+    ObjectCallback objectRemovedCallback_;
+    ObjectCallback objectModifiedCallback_;
+    ObjectsCallback objectsModifiedCallback_;
+    SelectionCallback selectionChangedCallback_;
+    ChangeSetCallback changeSetCallback_;
+    std::function<void()> flushScheduler_;
+    int batchDepth_;
+    
+    PartitionPtr findPartition(PartitionId partitionId) const;
+    PartitionPtr findPartitionOf(const ObjectId& id) const;
+    PartitionPtr getOrCreatePartition(PartitionId partitionId);
+    
+    std::vector<PartitionPtr> allPartitions() const;
+    std::vector<PartitionPtr> partitionsOverlapping(const Geometry::BoundingBox& region) const;
+    
+    /**
+     * @brief Whether a box in its owner's partition would hit an object in another partition
+     */
+    bool collidesInOtherPartitions(const Partition& owner, const Geometry::OrientedBoundingBox& box) const;
+    
+    /**
+     * @brief Move an object to a transform derived from its current one
+     */
+    template<typename TransformUpdate>
+    bool updateTransform(const ObjectId& id, TransformUpdate&& update);
+    
+    /**
+     * @brief Id unused in every partition; requires the directory lock
+     */
+    ObjectId generateUniqueId();
+    
+    void notifySelectionChanged(const std::vector<ObjectId>& selection);
+};
+
+/**
+ * @brief Projects with at least this many objects get a partitioned scene
+ * 
+ * Below it the single lock is rarely contended, and one index answers
+ * queries faster than a fan-out over partitions.
+ */
+constexpr size_t kPartitionedSceneObjectThreshold = 2000;
+
+/**
+ * @brief Scene manager suited to a project with the given number of objects
+ * 
+ * A SceneManager for small projects, a PartitionedSceneManager from
+ * kPartitionedSceneObjectThreshold objects on.
+ */
+std::unique_ptr<ISceneManager> createSceneManager(size_t objectCount);
+
+} // namespace Scene
+} // namespace KitchenCAD
\ No newline at end of file
@@ -1,110 +1,79 @@
 #include "SceneManager.h"
+#include "../models/ShapePrototype.h"
 #include "../utils/Logger.h"
 #include <algorithm>
 #include <cmath>
 #include <sstream>
 #include <iomanip>
 #include <chrono>
+#include <utility>
 
 namespace KitchenCAD {
 namespace Scene {
 
-// SpatialIndex Implementation
-
-SpatialIndex::SpatialIndex(double cellSize) : cellSize_(cellSize) {
-    if (cellSize <= 0.0) {
-        cellSize_ = 1.0;
-        LOG_WARNING("Invalid cell size provided, using default value of 1.0");
-    }
-}
-
-void SpatialIndex::addObject(const ObjectId& id, const Geometry::BoundingBox& bounds) {
-    if (bounds.isEmpty()) return;
-    
-    auto cells = getCellsForBounds(bounds);
-    for (const auto& cellKey : cells) {
-        grid_[cellKey].objects.insert(id);
-    }
-}
-
-void SpatialIndex::removeObject(const ObjectId& id, const Geometry::BoundingBox& bounds) {
-    if (bounds.isEmpty()) return;
-    
-    auto cells = getCellsForBounds(bounds);
-    for (const auto& cellKey : cells) {
-        auto it = grid_.find(cellKey);
-        if (it != grid_.end()) {
-            it->second.objects.erase(id);
-            if (it->second.objects.empty()) {
-                grid_.erase(it);
+namespace {
+
+// Up to about this many slots a SIMD scan of the packed bounds is as fast as the
+// spatial index for object-sized queries and faster for room-sized ones
+constexpr size_t kPackedScanSlotLimit = 1024;
+
+// Nearest-hit raycasts search a prefix of the ray this many cells long first,
+// growing it geometrically, so objects far along the ray are rarely collected
+constexpr double kRaycastInitialReachCells = 4.0;
+constexpr double kRaycastReachGrowth = 4.0;
+constexpr int kRaycastMaxPrefixSearches = 16;
+
+// Swept moves stop this far beyond the collision tolerance: a gap of exactly
+// the tolerance still counts as contact for checkCollision
+constexpr double kSweepClearance = 1e-6;
+
+/**
+ * @brief Earliest time in [0, 1] at which a box moving by displacement starts to
+ * overlap an obstacle, or infinity if it does not; touching is not overlap
+ */
+double sweptTimeOfImpact(const Geometry::BoundingBox& moving, const Geometry::Vector3D& displacement,
+                         const Geometry::BoundingBox& obstacle) {
+    const double infinity = std::numeric_limits<double>::infinity();
+    double enter = -infinity;
+    double exit = infinity;
+    
+    for (int axis = 0; axis < 3; ++axis) {
+        double velocity = displacement[axis];
+        if (velocity == 0.0) {
+            if (moving.max[axis] <= obstacle.min[axis] || moving.min[axis] >= obstacle.max[axis]) {
+                return infinity;
             }
+            continue;
+        }
+        
+        double t0 = (obstacle.min[axis] - moving.max[axis]) / velocity;
+        double t1 = (obstacle.max[axis] - moving.min[axis]) / velocity;
+        if (velocity < 0.0) {
+            std::swap(t0, t1);
         }
+        
+        enter = std::max(enter, t0);
+        exit = std::min(exit, t1);
     }
-}
-
-void SpatialIndex::updateObject(const ObjectId& id, const Geometry::BoundingBox& oldBounds, 
-                               const Geometry::BoundingBox& newBounds) {
-    removeObject(id, oldBounds);
-    addObject(id, newBounds);
-}
-
-std::vector<ObjectId> SpatialIndex::queryRegion(const Geometry::BoundingBox& region) const {
-    std::unordered_set<ObjectId> result;
     
-    auto cells = getCellsForBounds(region);
-    for (const auto& cellKey : cells) {
-        auto it = grid_.find(cellKey);
-        if (it != grid_.end()) {
-            for (const auto& objectId : it->second.objects) {
-                result.insert(objectId);
-            }
-        }
+    if (enter >= exit || enter >= 1.0 || exit <= 0.0) {
+        return infinity;
     }
     
-    return std::vector<ObjectId>(result.begin(), result.end());
-}
-
-std::vector<ObjectId> SpatialIndex::queryRadius(const Geometry::Point3D& center, double radius) const {
-    Geometry::BoundingBox region(
-        Geometry::Point3D(center.x - radius, center.y - radius, center.z - radius),
-        Geometry::Point3D(center.x + radius, center.y + radius, center.z + radius)
-    );
-    return queryRegion(region);
-}
-
-void SpatialIndex::clear() {
-    grid_.clear();
-}
-
-std::string SpatialIndex::getCellKey(int x, int y, int z) const {
-    std::ostringstream oss;
-    oss << x << "," << y << "," << z;
-    return oss.str();
+    return std::max(enter, 0.0);
 }
 
-std::vector<std::string> SpatialIndex::getCellsForBounds(const Geometry::BoundingBox& bounds) const {
-    std::vector<std::string> cells;
-    
-    if (bounds.isEmpty()) return cells;
-    
-    int minX = static_cast<int>(std::floor(bounds.min.x / cellSize_));
-    int maxX = static_cast<int>(std::floor(bounds.max.x / cellSize_));
-    int minY = static_cast<int>(std::floor(bounds.min.y / cellSize_));
-    int maxY = static_cast<int>(std::floor(bounds.max.y / cellSize_));
-    int minZ = static_cast<int>(std::floor(bounds.min.z / cellSize_));
-    int maxZ = static_cast<int>(std::floor(bounds.max.z / cellSize_));
-    
-    for (int x = minX; x <= maxX; ++x) {
-        for (int y = minY; y <= maxY; ++y) {
-            for (int z = minZ; z <= maxZ; ++z) {
-                cells.push_back(getCellKey(x, y, z));
-            }
+bool interiorsOverlap(const Geometry::BoundingBox& a, const Geometry::BoundingBox& b) {
+    for (int axis = 0; axis < 3; ++axis) {
+        if (a.max[axis] <= b.min[axis] || a.min[axis] >= b.max[axis]) {
+            return false;
         }
     }
-    
-    return cells;
+    return true;
 }
 
+} // namespace
+
 // CollisionDetector Implementation
 
 bool CollisionDetector::checkBoundingBoxIntersection(const Geometry::BoundingBox& a, 
@@ -139,6 +108,25 @@ CollisionDetector::CollisionInfo CollisionDetector::calculatePenetration(
     return CollisionInfo(idA, idB, penetrationVector, minOverlap);
 }
 
+bool CollisionDetector::checkOrientedBoxIntersection(const Geometry::OrientedBoundingBox& a,
+                                                    const Geometry::OrientedBoundingBox& b,
+                                                    double tolerance) {
+    return a.intersects(b, tolerance);
+}
+
+CollisionDetector::CollisionInfo CollisionDetector::calculatePenetration(
+    const ObjectId& idA, const ObjectId& idB,
+    const Geometry::OrientedBoundingBox& a, const Geometry::OrientedBoundingBox& b) {
+    
+    Geometry::Vector3D axis;
+    double depth;
+    if (!a.penetration(b, axis, depth)) {
+        return CollisionInfo(idA, idB, Geometry::Vector3D(), 0.0);
+    }
+    
+    return CollisionInfo(idA, idB, axis * depth, depth);
+}
+
 bool CollisionDetector::wouldCollide(const Geometry::BoundingBox& objectBounds,
                                     const Geometry::Transform3D& transform,
                                     const std::vector<Geometry::BoundingBox>& otherBounds) {
@@ -156,10 +144,20 @@ bool CollisionDetector::wouldCollide(const Geometry::BoundingBox& objectBounds,
 
 // SceneManager Implementation
 
-SceneManager::SceneManager(double spatialCellSize, double collisionTolerance)
-    : spatialIndex_(std::make_unique<SpatialIndex>(spatialCellSize))
+SceneManager::SceneManager(double spatialCellSize, double collisionTolerance, SpatialIndexType indexType)
+    : spatialIndex_(ISpatialIndex::create(indexType, spatialCellSize))
+    , spatialCellSize_(spatialCellSize)
+    , collisionPairCount_(0)
+    , objectPool_(Models::SceneObjectPool::create())
     , randomGenerator_(std::chrono::steady_clock::now().time_since_epoch().count())
     , idDistribution_(0, std::numeric_limits<uint64_t>::max())
+    , version_(0)
+    , selectionVersion_(0)
+    , changeLogFloor_(0)
+    , changeLogCapacity_(kDefaultChangeLogCapacity)
+    , batchDepth_(0)
+    , flushScheduled_(false)
+    , flushRequested_(false)
     , collisionTolerance_(collisionTolerance)
     , enableCollisionDetection_(true) {
     
@@ -173,7 +171,7 @@ ObjectId SceneManager::addObject(std::unique_ptr<SceneObject> object) {
         return "";
     }
     
-    std::lock_guard<std::mutex> lock(mutex_);
+    std::unique_lock<std::shared_mutex> lock(mutex_);
     
     ObjectId id = object->getId();
     if (id.empty()) {
@@ -182,77 +180,157 @@ ObjectId SceneManager::addObject(std::unique_ptr<SceneObject> object) {
     }
     
     // Check if ID already exists
-    if (objects_.find(id) != objects_.end()) {
+    if (handlesById_.find(id) != handlesById_.end()) {
         LOG_WARNING("Object with ID " + id + " already exists, generating new ID");
         id = generateUniqueId();
         object->setId(id);
     }
     
     // Calculate bounding box
-    Geometry::BoundingBox bounds = calculateObjectBounds(*object);
+    Geometry::OrientedBoundingBox orientedBounds = calculateOrientedBounds(*object);
+    Geometry::BoundingBox bounds = orientedBounds.bounds();
+    
+    // Claim a slot; reused slots keep their bumped generation
+    uint32_t slot;
+    if (!freeSlots_.empty()) {
+        slot = freeSlots_.back();
+        freeSlots_.pop_back();
+    } else {
+        slot = static_cast<uint32_t>(records_.size());
+        records_.emplace_back();
+    }
+    
+    ObjectRecord& record = records_[slot];
+    record.object = std::move(object);
+    record.bounds = bounds;
+    record.orientedBounds = orientedBounds;
     
-    // Store object and its bounds
-    objects_[id] = std::move(object);
-    objectBounds_[id] = bounds;
+    ObjectHandle handle(slot, record.generation);
+    handlesById_.emplace(id, handle);
     
     // Add to spatial index
-    spatialIndex_->addObject(id, bounds);
+    spatialIndex_->addObject(handle, bounds);
+    packedBounds_.set(slot, bounds);
+    sweepAndPrune_.addObject(handle, bounds);
+    
+    std::vector<CollisionPair> started;
+    std::vector<CollisionPair> stopped;
+    updateCollisionPairs(handle, bounds, started, stopped);
+    notifyCollisionsChanged(started, stopped);
+    markObjectModified(handle, ChangeKind::Added);
     
     LOG_DEBUG("Added object " + id + " to scene");
     notifyObjectAdded(id);
+    deliverQueuedChanges(lock);
     
     return id;
 }
 
 bool SceneManager::removeObject(const ObjectId& id) {
-    std::lock_guard<std::mutex> lock(mutex_);
+    std::unique_lock<std::shared_mutex> lock(mutex_);
     
-    auto it = objects_.find(id);
-    if (it == objects_.end()) {
+    ObjectHandle handle = findHandle(id);
+    if (!handle.isValid()) {
         LOG_WARNING("Attempted to remove non-existent object: " + id);
         return false;
     }
     
+    ObjectRecord& record = records_[handle.slot];
+    
     // Remove from spatial index
-    auto boundsIt = objectBounds_.find(id);
-    if (boundsIt != objectBounds_.end()) {
-        spatialIndex_->removeObject(id, boundsIt->second);
-        objectBounds_.erase(boundsIt);
-    }
+    spatialIndex_->removeObject(handle, record.bounds);
+    packedBounds_.reset(handle.slot);
+    sweepAndPrune_.removeObject(handle);
+    removeCollisionPairs(handle);
+    unindexAttributes(handle);
     
     // Remove from selection if selected
-    selectedObjects_.erase(id);
-    
-    // Remove object
-    objects_.erase(it);
+    bool wasSelected = selectedObjects_.erase(handle) > 0;
+    
+    // Remove object; the generation bump invalidates outstanding handles
+    handlesById_.erase(id);
+    record.object.reset();
+    record.snapshotCopy.reset();
+    record.bounds = Geometry::BoundingBox();
+    record.orientedBounds = Geometry::OrientedBoundingBox();
+    ++record.generation;
+    freeSlots_.push_back(handle.slot);
+    ++version_;
+    logChange(id, ChangeKind::Removed);
+    if (wasSelected) {
+        selectionVersion_ = version_;
+    }
     
     LOG_DEBUG("Removed object " + id + " from scene");
     notifyObjectRemoved(id);
+    deliverQueuedChanges(lock);
     
     return true;
 }
 
 SceneObject* SceneManager::getObject(const ObjectId& id) {
-    std::lock_guard<std::mutex> lock(mutex_);
+    std::shared_lock<std::shared_mutex> lock(mutex_);
     
-    auto it = objects_.find(id);
-    return (it != objects_.end()) ? it->second.get() : nullptr;
+    const ObjectRecord* record = findRecord(findHandle(id));
+    return record ? record->object.get() : nullptr;
 }
 
 const SceneObject* SceneManager::getObject(const ObjectId& id) const {
-    std::lock_guard<std::mutex> lock(mutex_);
+    std::shared_lock<std::shared_mutex> lock(mutex_);
     
-    auto it = objects_.find(id);
-    return (it != objects_.end()) ? it->second.get() : nullptr;
+    const ObjectRecord* record = findRecord(findHandle(id));
+    return record ? record->object.get() : nullptr;
+}
+
+bool SceneManager::modifyObject(const ObjectId& id, const std::function<void(SceneObject&)>& edit) {
+    std::unique_lock<std::shared_mutex> lock(mutex_);
+    
+    ObjectHandle handle = findHandle(id);
+    if (!handle.isValid()) {
+        LOG_WARNING("Cannot modify non-existent object: " + id);
+        return false;
+    }
+    
+    ObjectRecord& record = records_[handle.slot];
+    edit(*record.object);
+    
+    // The id keys the handle table, so an edit cannot change it
+    if (record.object->getId() != id) {
+        LOG_WARNING("Object edit tried to change the id of " + id + "; id restored");
+        record.object->setId(id);
+    }
+    
+    // The edit may have moved or resized the object
+    Geometry::OrientedBoundingBox newOrientedBounds = calculateOrientedBounds(*record.object);
+    Geometry::BoundingBox oldBounds = record.bounds;
+    Geometry::BoundingBox newBounds = newOrientedBounds.bounds();
+    record.bounds = newBounds;
+    record.orientedBounds = newOrientedBounds;
+    
+    if (!(newBounds.min == oldBounds.min && newBounds.max == oldBounds.max)) {
+        updateSpatialIndex(handle, oldBounds, newBounds);
+        
+        std::vector<CollisionPair> started;
+        std::vector<CollisionPair> stopped;
+        updateCollisionPairs(handle, newBounds, started, stopped);
+        notifyCollisionsChanged(started, stopped);
+    }
+    markObjectModified(handle);
+    
+    LOG_DEBUG("Modified object: " + id);
+    notifyObjectModified(id);
+    deliverQueuedChanges(lock);
+    
+    return true;
 }
 
 std::vector<ObjectId> SceneManager::getAllObjects() const {
-    std::lock_guard<std::mutex> lock(mutex_);
+    std::shared_lock<std::shared_mutex> lock(mutex_);
     
     std::vector<ObjectId> result;
-    result.reserve(objects_.size());
+    result.reserve(handlesById_.size());
     
-    for (const auto& pair : objects_) {
+    for (const auto& pair : handlesById_) {
         result.push_back(pair.first);
     }
     
@@ -260,68 +338,115 @@ std::vector<ObjectId> SceneManager::getAllObjects() const {
 }
 
 std::vector<ObjectId> SceneManager::getObjectsInRegion(const Geometry::BoundingBox& region) const {
-    std::lock_guard<std::mutex> lock(mutex_);
+    std::shared_lock<std::shared_mutex> lock(mutex_);
+    return toObjectIds(queryRegion(region));
+}
+
+std::vector<ObjectHandle> SceneManager::queryRegion(const Geometry::BoundingBox& region) const {
+    std::vector<ObjectHandle> result;
     
-    auto candidates = spatialIndex_->queryRegion(region);
-    std::vector<ObjectId> result;
+    if (records_.size() <= kPackedScanSlotLimit) {
+        // Float candidates are conservative, so confirm each against the exact bounds
+        std::vector<uint32_t> slots;
+        packedBounds_.findOverlapping(region, slots);
+        
+        for (uint32_t slot : slots) {
+            const ObjectRecord& record = records_[slot];
+            if (record.object && region.intersects(record.bounds)) {
+                result.emplace_back(slot, record.generation);
+            }
+        }
+        
+        return result;
+    }
     
-    for (const auto& id : candidates) {
-        auto boundsIt = objectBounds_.find(id);
-        if (boundsIt != objectBounds_.end() && region.intersects(boundsIt->second)) {
-            result.push_back(id);
+    for (const auto& handle : spatialIndex_->queryRegion(region)) {
+        const ObjectRecord* record = findRecord(handle);
+        if (record && region.intersects(record->bounds)) {
+            result.push_back(handle);
         }
     }
     
     return result;
 }
 
-std::vector<ObjectId> SceneManager::getObjectsOfType(const std::string& type) const {
-    std::lock_guard<std::mutex> lock(mutex_);
-    
-    std::vector<ObjectId> result;
-    
-    for (const auto& pair : objects_) {
-        // This would need to be implemented based on how SceneObject stores type information
-        // For now, we'll use a placeholder implementation
-        result.push_back(pair.first);
+bool SceneManager::overlapsOtherObjects(ObjectHandle handle, const Geometry::OrientedBoundingBox& box) const {
+    for (const auto& other : queryRegion(box.bounds())) {
+        if (other != handle && narrowPhaseOverlaps(box, other)) {
+            return true;
+        }
     }
     
-    return result;
+    return false;
+}
+
+bool SceneManager::narrowPhaseOverlaps(const Geometry::OrientedBoundingBox& box, ObjectHandle other) const {
+    return box.intersects(records_[other.slot].orientedBounds, collisionTolerance_);
+}
+
+std::vector<ObjectId> SceneManager::getObjectsOfType(const std::string& type) const {
+    std::shared_lock<std::shared_mutex> lock(mutex_);
+    return toObjectIds(objectsByType_.find(type));
 }
 
 std::vector<ObjectId> SceneManager::getObjectsByCategory(const std::string& category) const {
-    std::lock_guard<std::mutex> lock(mutex_);
-    
-    std::vector<ObjectId> result;
-    
-    for (const auto& pair : objects_) {
-        // This would need to be implemented based on how SceneObject stores category information
-        // For now, we'll use a placeholder implementation
-        result.push_back(pair.first);
+    std::shared_lock<std::shared_mutex> lock(mutex_);
+    return toObjectIds(objectsByCategory_.find(category));
+}
+
+std::vector<ObjectId> SceneManager::getObjectsByCatalogItem(const std::string& catalogItemId) const {
+    std::shared_lock<std::shared_mutex> lock(mutex_);
+    return toObjectIds(objectsByCatalogItem_.find(catalogItemId));
+}
+
+size_t SceneManager::countObjectsOfType(const std::string& type) const {
+    std::shared_lock<std::shared_mutex> lock(mutex_);
+    return objectsByType_.count(type);
+}
+
+size_t SceneManager::countObjectsByCategory(const std::string& category) const {
+    std::shared_lock<std::shared_mutex> lock(mutex_);
+    return objectsByCategory_.count(category);
+}
+
+size_t SceneManager::countObjectsByCatalogItem(const std::string& catalogItemId) const {
+    std::shared_lock<std::shared_mutex> lock(mutex_);
+    return objectsByCatalogItem_.count(catalogItemId);
+}
+
+void SceneManager::setClassificationResolver(ClassificationResolver resolver) {
+    std::unique_lock<std::shared_mutex> lock(mutex_);
+    
+    classificationResolver_ = std::move(resolver);
+    
+    objectsByType_.clear();
+    objectsByCategory_.clear();
+    objectsByCatalogItem_.clear();
+    for (uint32_t slot = 0; slot < records_.size(); ++slot) {
+        ObjectRecord& record = records_[slot];
+        record.typeKey = AttributeIndex::kNoKey;
+        record.categoryKey = AttributeIndex::kNoKey;
+        record.catalogItemKey = AttributeIndex::kNoKey;
+        if (record.object) {
+            indexAttributes(ObjectHandle(slot, record.generation));
+        }
     }
-    
-    return result;
 }
 
 std::vector<ObjectId> SceneManager::findIntersectingObjects(const ObjectId& objectId) const {
-    std::lock_guard<std::mutex> lock(mutex_);
+    std::shared_lock<std::shared_mutex> lock(mutex_);
     
-    auto boundsIt = objectBounds_.find(objectId);
-    if (boundsIt == objectBounds_.end()) {
+    ObjectHandle handle = findHandle(objectId);
+    if (!handle.isValid()) {
         return {};
     }
     
-    const auto& bounds = boundsIt->second;
-    auto candidates = spatialIndex_->queryRegion(bounds);
     std::vector<ObjectId> result;
     
-    for (const auto& candidateId : candidates) {
-        if (candidateId == objectId) continue;
-        
-        auto candidateBoundsIt = objectBounds_.find(candidateId);
-        if (candidateBoundsIt != objectBounds_.end() && 
-            CollisionDetector::checkBoundingBoxIntersection(bounds, candidateBoundsIt->second)) {
-            result.push_back(candidateId);
+    const ObjectRecord& record = records_[handle.slot];
+    for (const auto& candidate : queryRegion(record.bounds)) {
+        if (candidate != handle && narrowPhaseOverlaps(record.orientedBounds, candidate)) {
+            result.push_back(idOf(candidate));
         }
     }
     
@@ -329,25 +454,34 @@ std::vector<ObjectId> SceneManager::findIntersectingObjects(const ObjectId& obje
 }
 
 std::vector<ObjectId> SceneManager::findNearbyObjects(const ObjectId& objectId, double radius) const {
-    std::lock_guard<std::mutex> lock(mutex_);
+    std::shared_lock<std::shared_mutex> lock(mutex_);
     
-    auto boundsIt = objectBounds_.find(objectId);
-    if (boundsIt == objectBounds_.end()) {
+    ObjectHandle handle = findHandle(objectId);
+    if (!handle.isValid()) {
         return {};
     }
     
-    Geometry::Point3D center = boundsIt->second.center();
+    return collectWithinRadius(records_[handle.slot].bounds.center(), radius, handle);
+}
+
+std::vector<ObjectId> SceneManager::findObjectsWithinRadius(const Geometry::Point3D& center, double radius) const {
+    std::shared_lock<std::shared_mutex> lock(mutex_);
+    return collectWithinRadius(center, radius, ObjectHandle());
+}
+
+std::vector<ObjectId> SceneManager::collectWithinRadius(const Geometry::Point3D& center, double radius,
+                                                        ObjectHandle exclude) const {
     auto candidates = spatialIndex_->queryRadius(center, radius);
     std::vector<ObjectId> result;
     
-    for (const auto& candidateId : candidates) {
-        if (candidateId == objectId) continue;
+    for (const auto& candidate : candidates) {
+        if (candidate == exclude) continue;
         
-        auto candidateBoundsIt = objectBounds_.find(candidateId);
-        if (candidateBoundsIt != objectBounds_.end()) {
-            double distance = center.distanceTo(candidateBoundsIt->second.center());
+        const ObjectRecord* record = findRecord(candidate);
+        if (record) {
+            double distance = center.distanceTo(record->bounds.center());
             if (distance <= radius) {
-                result.push_back(candidateId);
+                result.push_back(record->object->getId());
             }
         }
     }
@@ -355,27 +489,37 @@ std::vector<ObjectId> SceneManager::findNearbyObjects(const ObjectId& objectId,
     return result;
 }
 
+std::vector<ObjectId> SceneManager::findNearestObjects(const Geometry::Point3D& point, size_t k,
+                                                       double maxDistance) const {
+    std::shared_lock<std::shared_mutex> lock(mutex_);
+    
+    auto nearest = spatialIndex_->queryNearest(point, k, maxDistance, [&](ObjectHandle handle) {
+        const ObjectRecord* record = findRecord(handle);
+        return record ? record->bounds.distanceTo(point) : std::numeric_limits<double>::infinity();
+    });
+    
+    std::vector<ObjectId> result;
+    result.reserve(nearest.size());
+    for (const auto& [distance, handle] : nearest) {
+        result.push_back(idOf(handle));
+    }
+    
+    return result;
+}
+
 bool SceneManager::checkCollision(const ObjectId& objectId, const Geometry::Transform3D& newTransform) const {
     if (!enableCollisionDetection_) {
         return false;
     }
     
-    std::lock_guard<std::mutex> lock(mutex_);
+    std::shared_lock<std::shared_mutex> lock(mutex_);
     
-    auto boundsIt = objectBounds_.find(objectId);
-    if (boundsIt == objectBounds_.end()) {
+    ObjectHandle handle = findHandle(objectId);
+    if (!handle.isValid()) {
         return false;
     }
     
-    // Get all other object bounds
-    std::vector<Geometry::BoundingBox> otherBounds;
-    for (const auto& pair : objectBounds_) {
-        if (pair.first != objectId) {
-            otherBounds.push_back(pair.second);
-        }
-    }
-    
-    return CollisionDetector::wouldCollide(boundsIt->second, newTransform, otherBounds);
+    return overlapsOtherObjects(handle, calculateOrientedBounds(*records_[handle.slot].object, newTransform));
 }
 
 bool SceneManager::moveObject(const ObjectId& id, const Geometry::Transform3D& transform) {
@@ -383,7 +527,8 @@ bool SceneManager::moveObject(const ObjectId& id, const Geometry::Transform3D& t
 }
 
 bool SceneManager::translateObject(const ObjectId& id, const Geometry::Vector3D& translation) {
-    auto object = getObject(id);
+    // Read through the const accessor: only the applied transform counts as a change
+    const SceneObject* object = std::as_const(*this).getObject(id);
     if (!object) return false;
     
     Geometry::Transform3D currentTransform = object->getTransform();
@@ -393,7 +538,7 @@ bool SceneManager::translateObject(const ObjectId& id, const Geometry::Vector3D&
 }
 
 bool SceneManager::rotateObject(const ObjectId& id, const Geometry::Vector3D& rotation) {
-    auto object = getObject(id);
+    const SceneObject* object = std::as_const(*this).getObject(id);
     if (!object) return false;
     
     Geometry::Transform3D currentTransform = object->getTransform();
@@ -403,7 +548,7 @@ bool SceneManager::rotateObject(const ObjectId& id, const Geometry::Vector3D& ro
 }
 
 bool SceneManager::scaleObject(const ObjectId& id, const Geometry::Vector3D& scale) {
-    auto object = getObject(id);
+    const SceneObject* object = std::as_const(*this).getObject(id);
     if (!object) return false;
     
     Geometry::Transform3D currentTransform = object->getTransform();
@@ -412,102 +557,241 @@ bool SceneManager::scaleObject(const ObjectId& id, const Geometry::Vector3D& sca
     return applyTransformToObject(id, currentTransform);
 }
 
+bool SceneManager::applyTransforms(std::span<const ObjectTransform> transforms) {
+    // Nothing to move, so nothing to report
+    if (transforms.empty()) return true;
+    
+    std::unique_lock<std::shared_mutex> lock(mutex_);
+    
+    std::vector<ObjectHandle> handles;
+    handles.reserve(transforms.size());
+    
+    for (const auto& [id, transform] : transforms) {
+        ObjectHandle handle = findHandle(id);
+        if (!handle.isValid()) {
+            LOG_WARNING("Cannot transform non-existent object: " + id);
+            return false;
+        }
+        handles.push_back(handle);
+    }
+    
+    // Objects in the batch move together, so members are checked against each other's new boxes
+    std::vector<ObjectHandle> batch(handles);
+    std::sort(batch.begin(), batch.end());
+    batch.erase(std::unique(batch.begin(), batch.end()), batch.end());
+    
+    // Each target's world matrix is built once and reused for validation, bounds and the object
+    std::vector<Geometry::CachedTransform3D> placed;
+    placed.reserve(transforms.size());
+    for (const auto& [id, transform] : transforms) {
+        placed.emplace_back(transform);
+    }
+    
+    if (enableCollisionDetection_) {
+        // Final box of each batch member; an object listed twice ends at its last transform
+        std::vector<Geometry::OrientedBoundingBox> finalBoxes(batch.size());
+        std::vector<size_t> finalEntries(batch.size());
+        
+        for (size_t i = 0; i < handles.size(); ++i) {
+            Geometry::OrientedBoundingBox moved = calculateOrientedBounds(*records_[handles[i].slot].object,
+                                                                          placed[i].matrix());
+            
+            for (const auto& other : queryRegion(moved.bounds())) {
+                if (!std::binary_search(batch.begin(), batch.end(), other) && narrowPhaseOverlaps(moved, other)) {
+                    LOG_DEBUG("Batch transform rejected due to collision for object: " + transforms[i].first);
+                    return false;
+                }
+            }
+            
+            size_t member = std::lower_bound(batch.begin(), batch.end(), handles[i]) - batch.begin();
+            finalBoxes[member] = moved;
+            finalEntries[member] = i;
+        }
+        
+        // Members already in contact, such as cabinets side by side, may stay so
+        auto introduced = Geometry::findOverlappingPair(finalBoxes, collisionTolerance_, [&](size_t a, size_t b) {
+            return !records_[batch[a].slot].orientedBounds.intersects(records_[batch[b].slot].orientedBounds,
+                                                                      collisionTolerance_);
+        });
+        if (introduced) {
+            LOG_DEBUG("Batch transform rejected: objects would overlap each other, including " +
+                      transforms[finalEntries[introduced->first]].first);
+            return false;
+        }
+    }
+    
+    // Move everything first so collision pairs are evaluated against final positions only
+    for (size_t i = 0; i < handles.size(); ++i) {
+        ObjectRecord& record = records_[handles[i].slot];
+        Geometry::BoundingBox oldBounds = record.bounds;
+        
+        record.object->setTransform(placed[i]);
+        record.orientedBounds = calculateOrientedBounds(*record.object);
+        record.bounds = record.orientedBounds.bounds();
+        
+        updateSpatialIndex(handles[i], oldBounds, record.bounds);
+        markObjectModified(handles[i]);
+    }
+    
+    std::vector<CollisionPair> started;
+    std::vector<CollisionPair> stopped;
+    for (const auto& handle : batch) {
+        updateCollisionPairs(handle, records_[handle.slot].bounds, started, stopped);
+    }
+    notifyCollisionsChanged(started, stopped);
+    
+    LOG_DEBUG("Applied batched transform to " + std::to_string(batch.size()) + " objects");
+    notifyObjectsModified(toObjectIds(batch));
+    deliverQueuedChanges(lock);
+    
+    return true;
+}
+
 void SceneManager::setSelection(const std::vector<ObjectId>& selection) {
-    std::lock_guard<std::mutex> lock(mutex_);
+    std::unique_lock<std::shared_mutex> lock(mutex_);
     
     selectedObjects_.clear();
     for (const auto& id : selection) {
-        if (validateObjectId(id)) {
-            selectedObjects_.insert(id);
+        ObjectHandle handle = findHandle(id);
+        if (handle.isValid()) {
+            selectedObjects_.insert(handle);
         }
     }
+    selectionVersion_ = ++version_;
     
     notifySelectionChanged();
 }
 
 void SceneManager::addToSelection(const ObjectId& id) {
-    std::lock_guard<std::mutex> lock(mutex_);
+    std::unique_lock<std::shared_mutex> lock(mutex_);
     
-    if (validateObjectId(id)) {
-        selectedObjects_.insert(id);
+    ObjectHandle handle = findHandle(id);
+    if (handle.isValid()) {
+        selectedObjects_.insert(handle);
+        selectionVersion_ = ++version_;
         notifySelectionChanged();
     }
 }
 
 void SceneManager::removeFromSelection(const ObjectId& id) {
-    std::lock_guard<std::mutex> lock(mutex_);
+    std::unique_lock<std::shared_mutex> lock(mutex_);
     
-    if (selectedObjects_.erase(id) > 0) {
+    ObjectHandle handle = findHandle(id);
+    if (handle.isValid() && selectedObjects_.erase(handle) > 0) {
+        selectionVersion_ = ++version_;
         notifySelectionChanged();
     }
 }
 
 void SceneManager::clearSelection() {
-    std::lock_guard<std::mutex> lock(mutex_);
+    std::unique_lock<std::shared_mutex> lock(mutex_);
     
     if (!selectedObjects_.empty()) {
         selectedObjects_.clear();
+        selectionVersion_ = ++version_;
         notifySelectionChanged();
     }
 }
 
 std::vector<ObjectId> SceneManager::getSelection() const {
-    std::lock_guard<std::mutex> lock(mutex_);
+    std::shared_lock<std::shared_mutex> lock(mutex_);
     
-    return std::vector<ObjectId>(selectedObjects_.begin(), selectedObjects_.end());
+    return toObjectIds(std::vector<ObjectHandle>(selectedObjects_.begin(), selectedObjects_.end()));
 }
 
 bool SceneManager::isSelected(const ObjectId& id) const {
-    std::lock_guard<std::mutex> lock(mutex_);
+    std::shared_lock<std::shared_mutex> lock(mutex_);
     
-    return selectedObjects_.find(id) != selectedObjects_.end();
+    ObjectHandle handle = findHandle(id);
+    return handle.isValid() && selectedObjects_.find(handle) != selectedObjects_.end();
 }
 
 Geometry::BoundingBox SceneManager::getSceneBounds() const {
-    std::lock_guard<std::mutex> lock(mutex_);
+    std::shared_lock<std::shared_mutex> lock(mutex_);
     
     Geometry::BoundingBox result;
     
-    for (const auto& pair : objectBounds_) {
-        result.expand(pair.second);
+    for (const auto& record : records_) {
+        if (record.object) {
+            result.expand(record.bounds);
+        }
     }
     
     return result;
 }
 
 size_t SceneManager::getObjectCount() const {
-    std::lock_guard<std::mutex> lock(mutex_);
-    return objects_.size();
+    std::shared_lock<std::shared_mutex> lock(mutex_);
+    return handlesById_.size();
 }
 
 bool SceneManager::isEmpty() const {
-    std::lock_guard<std::mutex> lock(mutex_);
-    return objects_.empty();
+    std::shared_lock<std::shared_mutex> lock(mutex_);
+    return handlesById_.empty();
 }
 
 void SceneManager::clear() {
-    std::lock_guard<std::mutex> lock(mutex_);
+    std::unique_lock<std::shared_mutex> lock(mutex_);
+    
+    std::vector<CollisionPair> stopped;
+    stopped.reserve(collisionPairCount_);
+    for (uint32_t slot = 0; slot < records_.size(); ++slot) {
+        ObjectHandle handle(slot, records_[slot].generation);
+        for (const auto& partner : records_[slot].collisionPartners) {
+            if (handle.slot < partner.slot) {
+                stopped.push_back(makeCollisionPair(handle, partner));
+            }
+        }
+    }
     
-    objects_.clear();
-    objectBounds_.clear();
+    // Free every slot but keep the records, so generations survive and
+    // handles from before the clear stay stale
+    freeSlots_.clear();
+    for (uint32_t slot = static_cast<uint32_t>(records_.size()); slot-- > 0;) {
+        ObjectRecord& record = records_[slot];
+        if (record.object) {
+            uint32_t generation = record.generation + 1;
+            record = ObjectRecord();
+            record.generation = generation;
+        }
+        freeSlots_.push_back(slot);
+    }
+    
+    packedBounds_.clear();
+    handlesById_.clear();
     selectedObjects_.clear();
     spatialIndex_->clear();
+    sweepAndPrune_.clear();
+    objectsByType_.clear();
+    objectsByCategory_.clear();
+    objectsByCatalogItem_.clear();
+    collisionPairCount_ = 0;
+    ++version_;
+    
+    // Deltas cannot describe a clear; consumers from before it rebuild
+    changeLog_.clear();
+    changeLogFloor_ = version_;
+    selectionVersion_ = version_;
+    
+    notifyCollisionsChanged({}, stopped);
     
     LOG_INFO("Scene cleared");
+    deliverQueuedChanges(lock);
 }
 
 std::unique_ptr<SceneObject> SceneManager::duplicateObject(const ObjectId& id) {
-    std::lock_guard<std::mutex> lock(mutex_);
+    std::unique_lock<std::shared_mutex> lock(mutex_);
     
-    auto it = objects_.find(id);
-    if (it == objects_.end()) {
+    const ObjectRecord* record = findRecord(findHandle(id));
+    if (!record) {
         LOG_WARNING("Cannot duplicate non-existent object: " + id);
         return nullptr;
     }
     
     // Create a copy using JSON serialization/deserialization
     try {
-        nlohmann::json objectJson = it->second->toJson();
+        nlohmann::json objectJson = record->object->toJson();
+        Models::SceneObjectPool::Scope scope(objectPool_);
         auto duplicate = std::make_unique<SceneObject>();
         duplicate->fromJson(objectJson);
         
@@ -522,19 +806,139 @@ std::unique_ptr<SceneObject> SceneManager::duplicateObject(const ObjectId& id) {
 }
 
 void SceneManager::forEachObject(std::function<void(const ObjectId&, SceneObject*)> callback) {
-    std::lock_guard<std::mutex> lock(mutex_);
+    std::unique_lock<std::shared_mutex> lock(mutex_);
     
-    for (auto& pair : objects_) {
-        callback(pair.first, pair.second.get());
+    for (auto& record : records_) {
+        if (record.object) {
+            callback(record.object->getId(), record.object.get());
+        }
     }
 }
 
 void SceneManager::forEachObject(std::function<void(const ObjectId&, const SceneObject*)> callback) const {
-    std::lock_guard<std::mutex> lock(mutex_);
+    std::shared_lock<std::shared_mutex> lock(mutex_);
+    
+    for (const auto& record : records_) {
+        if (record.object) {
+            callback(record.object->getId(), record.object.get());
+        }
+    }
+}
+
+ObjectHandle SceneManager::getHandle(const ObjectId& id) const {
+    std::shared_lock<std::shared_mutex> lock(mutex_);
+    return findHandle(id);
+}
+
+ObjectId SceneManager::getObjectId(ObjectHandle handle) const {
+    std::shared_lock<std::shared_mutex> lock(mutex_);
+    
+    const ObjectRecord* record = findRecord(handle);
+    return record ? record->object->getId() : ObjectId();
+}
+
+bool SceneManager::isValidHandle(ObjectHandle handle) const {
+    std::shared_lock<std::shared_mutex> lock(mutex_);
+    return findRecord(handle) != nullptr;
+}
+
+uint64_t SceneManager::getVersion() const {
+    std::shared_lock<std::shared_mutex> lock(mutex_);
+    return version_;
+}
+
+SceneManager::SceneDelta SceneManager::getChangesSince(uint64_t version) const {
+    std::shared_lock<std::shared_mutex> lock(mutex_);
     
-    for (const auto& pair : objects_) {
-        callback(pair.first, pair.second.get());
+    SceneDelta delta;
+    delta.fromVersion = version;
+    delta.toVersion = version_;
+    if (version < changeLogFloor_ || version > version_) {
+        delta.complete = false;
+        return delta;
     }
+    
+    delta.selectionChanged = selectionVersion_ > version;
+    
+    // The log is in version order, so only its tail needs folding
+    auto first = std::upper_bound(changeLog_.begin(), changeLog_.end(), version,
+                                  [](uint64_t v, const ChangeLogEntry& entry) { return v < entry.version; });
+    
+    ChangeSetBuilder builder;
+    for (auto it = first; it != changeLog_.end(); ++it) {
+        switch (it->kind) {
+            case ChangeKind::Added:
+                builder.objectAdded(it->id);
+                break;
+            case ChangeKind::Removed:
+                builder.objectRemoved(it->id);
+                break;
+            case ChangeKind::Modified:
+                builder.objectModified(it->id);
+                break;
+        }
+    }
+    delta.changes = builder.take();
+    
+    return delta;
+}
+
+uint64_t SceneManager::getObjectVersion(const ObjectId& id) const {
+    std::shared_lock<std::shared_mutex> lock(mutex_);
+    
+    const ObjectRecord* record = findRecord(findHandle(id));
+    return record ? record->lastModifiedVersion : 0;
+}
+
+void SceneManager::setChangeLogCapacity(size_t capacity) {
+    std::unique_lock<std::shared_mutex> lock(mutex_);
+    
+    changeLogCapacity_ = capacity;
+    trimChangeLog();
+}
+
+std::shared_ptr<Models::SceneObjectPool> SceneManager::getObjectPool() const {
+    std::shared_lock<std::shared_mutex> lock(mutex_);
+    return objectPool_;
+}
+
+void SceneManager::setObjectPool(std::shared_ptr<Models::SceneObjectPool> pool) {
+    std::unique_lock<std::shared_mutex> lock(mutex_);
+    objectPool_ = pool ? std::move(pool) : Models::SceneObjectPool::create();
+}
+
+std::shared_ptr<const SceneSnapshot> SceneManager::getSnapshot() const {
+    std::shared_lock<std::shared_mutex> lock(mutex_);
+    std::lock_guard<std::mutex> snapshotLock(snapshotMutex_);
+    
+    if (snapshot_ && snapshot_->getVersion() == version_) {
+        return snapshot_;
+    }
+    
+    auto snapshot = std::make_shared<SceneSnapshot>();
+    snapshot->version_ = version_;
+    snapshot->entries_.reserve(handlesById_.size());
+    
+    for (const auto& record : records_) {
+        if (!record.object) continue;
+        
+        // Unmodified objects share the copy made for an earlier snapshot
+        if (!record.snapshotCopy) {
+            record.snapshotCopy = std::make_shared<const SceneObject>(*record.object);
+        }
+        
+        SceneSnapshot::Entry entry;
+        entry.object = record.snapshotCopy;
+        entry.bounds = record.bounds;
+        snapshot->entries_.emplace(record.object->getId(), std::move(entry));
+    }
+    
+    for (const auto& handle : selectedObjects_) {
+        snapshot->selection_.insert(idOf(handle));
+    }
+    
+    snapshot_ = snapshot;
+    return snapshot_;
 }
 
 void SceneManager::setObjectAddedCallback(ObjectCallback callback) {
@@ -549,73 +953,351 @@ void SceneManager::setObjectModifiedCallback(ObjectCallback callback) {
     objectModifiedCallback_ = callback;
 }
 
+void SceneManager::setObjectsModifiedCallback(ObjectsCallback callback) {
+    objectsModifiedCallback_ = callback;
+}
+
 void SceneManager::setSelectionChangedCallback(SelectionCallback callback) {
     selectionChangedCallback_ = callback;
 }
 
+void SceneManager::setCollisionChangedCallback(CollisionChangedCallback callback) {
+    collisionChangedCallback_ = callback;
+}
+
+void SceneManager::setChangeSetCallback(ChangeSetCallback callback) {
+    changeSetCallback_ = callback;
+}
+
+void SceneManager::beginBatch() {
+    std::unique_lock<std::shared_mutex> lock(mutex_);
+    ++batchDepth_;
+}
+
+void SceneManager::endBatch() {
+    SceneChangeSet changes;
+    {
+        std::unique_lock<std::shared_mutex> lock(mutex_);
+        if (batchDepth_ == 0) {
+            LOG_WARNING("endBatch called without a matching beginBatch");
+            return;
+        }
+        
+        // A scheduled flush will pick the changes up on the next tick
+        if (--batchDepth_ > 0 || flushScheduled_) return;
+        changes = pendingChanges_.take();
+    }
+    
+    // Delivered unlocked so subscribers can query the scene
+    deliverChanges(changes);
+}
+
+void SceneManager::setChangeFlushScheduler(std::function<void()> scheduler) {
+    SceneChangeSet changes;
+    {
+        std::unique_lock<std::shared_mutex> lock(mutex_);
+        flushScheduler_ = std::move(scheduler);
+        if (flushScheduler_ || batchDepth_ > 0) return;
+        
+        // Going back to immediate delivery: nothing may stay held back
+        flushScheduled_ = false;
+        flushRequested_ = false;
+        changes = pendingChanges_.take();
+    }
+    
+    deliverChanges(changes);
+}
+
+void SceneManager::flushChanges() {
+    SceneChangeSet changes;
+    {
+        std::unique_lock<std::shared_mutex> lock(mutex_);
+        flushScheduled_ = false;
+        
+        // An open batch delivers everything when it ends
+        if (batchDepth_ > 0) return;
+        changes = pendingChanges_.take();
+    }
+    
+    deliverChanges(changes);
+}
+
+SweepResult SceneManager::checkSweptCollision(const ObjectId& objectId, const Geometry::Transform3D& fromTransform,
+                                              const Geometry::Transform3D& toTransform) const {
+    SweepResult result;
+    result.transform = toTransform;
+    
+    if (!enableCollisionDetection_) {
+        return result;
+    }
+    
+    std::shared_lock<std::shared_mutex> lock(mutex_);
+    
+    ObjectHandle handle = findHandle(objectId);
+    if (!handle.isValid()) {
+        return result;
+    }
+    
+    const SceneObject& object = *records_[handle.slot].object;
+    sweepBoundsUnlocked(calculateObjectBounds(object, fromTransform), calculateObjectBounds(object, toTransform),
+                        handle, result);
+    
+    if (result.collided) {
+        result.transform.translation = fromTransform.translation +
+                                       (toTransform.translation - fromTransform.translation) * result.timeOfImpact;
+    }
+    
+    return result;
+}
+
+SweepResult SceneManager::sweepBounds(const Geometry::BoundingBox& startBounds,
+                                      const Geometry::BoundingBox& endBounds) const {
+    SweepResult result;
+    if (!enableCollisionDetection_ || startBounds.isEmpty() || endBounds.isEmpty()) {
+        return result;
+    }
+    
+    std::shared_lock<std::shared_mutex> lock(mutex_);
+    sweepBoundsUnlocked(startBounds, endBounds, ObjectHandle(), result);
+    return result;
+}
+
+void SceneManager::sweepBoundsUnlocked(const Geometry::BoundingBox& startBounds,
+                                       const Geometry::BoundingBox& endBounds, ObjectHandle exclude,
+                                       SweepResult& result) const {
+    Geometry::Vector3D displacement = endBounds.center() - startBounds.center();
+    
+    // Translate one box big enough for both poses, so rotation or scale changes stay conservative
+    Geometry::Vector3D startSize = startBounds.size();
+    Geometry::Vector3D endSize = endBounds.size();
+    Geometry::BoundingBox moving = Geometry::BoundingBox::fromCenterAndSize(
+        startBounds.center(),
+        Geometry::Vector3D(std::max(startSize.x, endSize.x), std::max(startSize.y, endSize.y),
+                           std::max(startSize.z, endSize.z)));
+    
+    Geometry::BoundingBox swept = moving;
+    swept.expand(Geometry::BoundingBox(moving.min + displacement, moving.max + displacement));
+    
+    // Obstacles grow past the collision tolerance, so the move ends where checkCollision accepts it
+    double margin = collisionTolerance_ + kSweepClearance;
+    for (const auto& candidate : queryRegion(swept.expanded(margin))) {
+        if (candidate == exclude) continue;
+        
+        const Geometry::BoundingBox& bounds = records_[candidate.slot].bounds;
+        if (interiorsOverlap(startBounds, bounds.expanded(collisionTolerance_))) continue;
+        
+        Geometry::BoundingBox obstacle = bounds.expanded(margin);
+        
+        double timeOfImpact = sweptTimeOfImpact(moving, displacement, obstacle);
+        if (timeOfImpact < result.timeOfImpact) {
+            result.collided = true;
+            result.timeOfImpact = timeOfImpact;
+            result.blockingObject = idOf(candidate);
+        }
+    }
+}
+
+std::optional<SceneManager::RaycastHit> SceneManager::raycast(const Geometry::Point3D& origin,
+                                                              const Geometry::Vector3D& direction,
+                                                              double maxDistance) const {
+    std::shared_lock<std::shared_mutex> lock(mutex_);
+    
+    // Any hit within the searched prefix is nearer than every object beyond it
+    std::vector<std::pair<double, ObjectHandle>> hits;
+    double reach = spatialCellSize_ * kRaycastInitialReachCells;
+    for (int search = 0; hits.empty(); ++search) {
+        if (search == kRaycastMaxPrefixSearches || reach >= maxDistance) {
+            reach = maxDistance;
+        }
+        
+        hits = findRayHits(origin, direction, reach);
+        if (reach == maxDistance) break;
+        reach *= kRaycastReachGrowth;
+    }
+    
+    if (hits.empty()) {
+        return std::nullopt;
+    }
+    
+    auto nearest = std::min_element(hits.begin(), hits.end());
+    Geometry::Ray ray(origin, direction);
+    return RaycastHit{idOf(nearest->second), nearest->first, ray.pointAt(nearest->first)};
+}
+
+std::vector<SceneManager::RaycastHit> SceneManager::raycastAll(const Geometry::Point3D& origin,
+                                                               const Geometry::Vector3D& direction,
+                                                               double maxDistance) const {
+    std::shared_lock<std::shared_mutex> lock(mutex_);
+    
+    auto hits = findRayHits(origin, direction, maxDistance);
+    std::sort(hits.begin(), hits.end());
+    
+    Geometry::Ray ray(origin, direction);
+    std::vector<RaycastHit> result;
+    result.reserve(hits.size());
+    for (const auto& [distance, handle] : hits) {
+        result.push_back(RaycastHit{idOf(handle), distance, ray.pointAt(distance)});
+    }
+    
+    return result;
+}
+
+std::vector<ObjectId> SceneManager::queryFrustum(const Geometry::Frustum& frustum) const {
+    std::shared_lock<std::shared_mutex> lock(mutex_);
+    
+    std::vector<ObjectId> result;
+    
+    for (const auto& handle : spatialIndex_->queryFrustum(frustum)) {
+        const ObjectRecord* record = findRecord(handle);
+        if (record && frustum.intersects(record->bounds)) {
+            result.push_back(record->object->getId());
+        }
+    }
+    
+    return result;
+}
+
+Geometry::BoundingBox SceneManager::getObjectBounds(const ObjectId& id) const {
+    std::shared_lock<std::shared_mutex> lock(mutex_);
+    
+    const ObjectRecord* record = findRecord(findHandle(id));
+    return record ? record->bounds : Geometry::BoundingBox();
+}
+
+Geometry::OrientedBoundingBox SceneManager::getOrientedBoundsAt(const ObjectId& id,
+                                                                const Geometry::Transform3D& transform) const {
+    std::shared_lock<std::shared_mutex> lock(mutex_);
+    
+    const ObjectRecord* record = findRecord(findHandle(id));
+    return record ? calculateOrientedBounds(*record->object, transform) : Geometry::OrientedBoundingBox();
+}
+
+std::vector<ObjectId> SceneManager::findObjectsOverlapping(const Geometry::OrientedBoundingBox& box) const {
+    std::shared_lock<std::shared_mutex> lock(mutex_);
+    
+    std::vector<ObjectId> result;
+    if (box.isEmpty()) return result;
+    
+    for (const auto& candidate : queryRegion(box.bounds())) {
+        if (narrowPhaseOverlaps(box, candidate)) {
+            result.push_back(idOf(candidate));
+        }
+    }
+    
+    return result;
+}
+
+std::vector<std::pair<double, ObjectHandle>> SceneManager::findRayHits(const Geometry::Point3D& origin,
+                                                                       const Geometry::Vector3D& direction,
+                                                                       double maxDistance) const {
+    double length = direction.length();
+    if (!(length > 0.0) || !std::isfinite(length) || !(maxDistance >= 0.0)) {
+        return {};
+    }
+    
+    Geometry::Ray ray(origin, direction);
+    std::vector<std::pair<double, ObjectHandle>> hits;
+    
+    for (const auto& handle : spatialIndex_->queryRay(ray, maxDistance)) {
+        const ObjectRecord* record = findRecord(handle);
+        double tEnter, tExit;
+        if (record && ray.intersects(record->bounds, tEnter, tExit) && tEnter <= maxDistance) {
+            hits.emplace_back(tEnter, handle);
+        }
+    }
+    
+    return hits;
+}
+
+SpatialIndexType SceneManager::getSpatialIndexType() const {
+    std::shared_lock<std::shared_mutex> lock(mutex_);
+    return spatialIndex_->getType();
+}
+
+void SceneManager::setSpatialIndexType(SpatialIndexType type) {
+    std::unique_lock<std::shared_mutex> lock(mutex_);
+    
+    if (spatialIndex_->getType() == type) {
+        return;
+    }
+    
+    auto newIndex = ISpatialIndex::create(type, spatialCellSize_);
+    for (uint32_t slot = 0; slot < records_.size(); ++slot) {
+        if (records_[slot].object) {
+            newIndex->addObject(ObjectHandle(slot, records_[slot].generation), records_[slot].bounds);
+        }
+    }
+    spatialIndex_ = std::move(newIndex);
+    
+    LOG_INFO("Spatial index rebuilt for " + std::to_string(handlesById_.size()) + " objects");
+}
+
 std::vector<CollisionDetector::CollisionInfo> SceneManager::detectAllCollisions() const {
-    std::lock_guard<std::mutex> lock(mutex_);
+    std::shared_lock<std::shared_mutex> lock(mutex_);
     
     std::vector<CollisionDetector::CollisionInfo> collisions;
     
-    // Create object IDs list directly without calling getAllObjects() to avoid deadlock
-    std::vector<ObjectId> objectIds;
-    objectIds.reserve(objects_.size());
-    for (const auto& pair : objects_) {
-        objectIds.push_back(pair.first);
-    }
+    // The sweep sorts pending endpoints lazily, so concurrent readers take turns
+    std::lock_guard<std::mutex> sweepLock(sweepMutex_);
+    sweepAndPrune_.forEachOverlappingPair([&](ObjectHandle a, ObjectHandle b) {
+        const ObjectRecord& recordA = records_[a.slot];
+        const ObjectRecord& recordB = records_[b.slot];
+        if (!narrowPhaseOverlaps(recordA.orientedBounds, b)) return;
+        
+        collisions.push_back(CollisionDetector::calculatePenetration(
+            recordA.object->getId(), recordB.object->getId(), recordA.orientedBounds, recordB.orientedBounds));
+    });
     
-    for (size_t i = 0; i < objectIds.size(); ++i) {
-        for (size_t j = i + 1; j < objectIds.size(); ++j) {
-            const auto& idA = objectIds[i];
-            const auto& idB = objectIds[j];
-            
-            auto boundsA = objectBounds_.find(idA);
-            auto boundsB = objectBounds_.find(idB);
-            
-            if (boundsA != objectBounds_.end() && boundsB != objectBounds_.end()) {
-                if (CollisionDetector::checkBoundingBoxIntersection(boundsA->second, boundsB->second)) {
-                    collisions.push_back(
-                        CollisionDetector::calculatePenetration(idA, idB, boundsA->second, boundsB->second)
-                    );
-                }
+    return collisions;
+}
+
+std::vector<SceneManager::CollisionPair> SceneManager::getCurrentCollisions() const {
+    std::shared_lock<std::shared_mutex> lock(mutex_);
+    
+    std::vector<CollisionPair> pairs;
+    pairs.reserve(collisionPairCount_);
+    
+    for (uint32_t slot = 0; slot < records_.size(); ++slot) {
+        ObjectHandle handle(slot, records_[slot].generation);
+        for (const auto& partner : records_[slot].collisionPartners) {
+            if (handle.slot < partner.slot) {
+                pairs.push_back(makeCollisionPair(handle, partner));
             }
         }
     }
     
-    return collisions;
+    return pairs;
 }
 
 std::vector<ObjectId> SceneManager::getAffectedObjects(const ObjectId& objectId, 
                                                       const Geometry::Transform3D& newTransform) const {
-    std::lock_guard<std::mutex> lock(mutex_);
+    std::shared_lock<std::shared_mutex> lock(mutex_);
     
-    auto boundsIt = objectBounds_.find(objectId);
-    if (boundsIt == objectBounds_.end()) {
+    const ObjectRecord* record = findRecord(findHandle(objectId));
+    if (!record) {
         return {};
     }
     
-    Geometry::BoundingBox transformedBounds = boundsIt->second.transformed(newTransform);
-    return getObjectsInRegion(transformedBounds);
+    Geometry::BoundingBox transformedBounds = record->bounds.transformed(newTransform);
+    return toObjectIds(queryRegion(transformedBounds));
 }
 
 std::vector<std::string> SceneManager::validateScene() const {
-    std::lock_guard<std::mutex> lock(mutex_);
+    std::shared_lock<std::shared_mutex> lock(mutex_);
     
     std::vector<std::string> issues;
     
     // Check for objects without valid bounds
-    for (const auto& pair : objects_) {
-        auto boundsIt = objectBounds_.find(pair.first);
-        if (boundsIt == objectBounds_.end() || boundsIt->second.isEmpty()) {
-            issues.push_back("Object " + pair.first + " has invalid bounding box");
+    for (const auto& record : records_) {
+        if (record.object && record.bounds.isEmpty()) {
+            issues.push_back("Object " + record.object->getId() + " has invalid bounding box");
         }
     }
     
     // Check for selected objects that don't exist
-    for (const auto& selectedId : selectedObjects_) {
-        if (objects_.find(selectedId) == objects_.end()) {
-            issues.push_back("Selected object " + selectedId + " does not exist");
+    for (const auto& selected : selectedObjects_) {
+        if (!findRecord(selected)) {
+            issues.push_back("Selected object in slot " + std::to_string(selected.slot) + " does not exist");
         }
     }
     
@@ -623,49 +1305,27 @@ std::vector<std::string> SceneManager::validateScene() const {
 }
 
 SceneManager::SceneStatistics SceneManager::getStatistics() const {
-    std::lock_guard<std::mutex> lock(mutex_);
+    std::shared_lock<std::shared_mutex> lock(mutex_);
     
     SceneStatistics stats;
-    stats.totalObjects = objects_.size();
+    stats.totalObjects = handlesById_.size();
     stats.selectedObjects = selectedObjects_.size();
     
-    // Calculate collisions directly to avoid deadlock
-    std::vector<ObjectId> objectIds;
-    objectIds.reserve(objects_.size());
-    for (const auto& pair : objects_) {
-        objectIds.push_back(pair.first);
-    }
-    
-    size_t collisionCount = 0;
-    for (size_t i = 0; i < objectIds.size(); ++i) {
-        for (size_t j = i + 1; j < objectIds.size(); ++j) {
-            const auto& idA = objectIds[i];
-            const auto& idB = objectIds[j];
-            
-            auto boundsA = objectBounds_.find(idA);
-            auto boundsB = objectBounds_.find(idB);
-            
-            if (boundsA != objectBounds_.end() && boundsB != objectBounds_.end()) {
-                if (CollisionDetector::checkBoundingBoxIntersection(boundsA->second, boundsB->second)) {
-                    collisionCount++;
-                }
-            }
-        }
-    }
-    stats.collisions = collisionCount;
+    // Maintained incrementally, so no pair scan is needed
+    stats.collisions = collisionPairCount_;
+    stats.objectsByType = objectsByType_.getCounts();
+    stats.objectsByCategory = objectsByCategory_.getCounts();
     
-    // Calculate scene bounds directly to avoid deadlock
+    // Calculate scene bounds and total volume directly to avoid deadlock
     Geometry::BoundingBox sceneBounds;
-    for (const auto& pair : objectBounds_) {
-        sceneBounds.expand(pair.second);
-    }
-    stats.sceneBounds = sceneBounds;
-    
-    // Calculate total volume
     stats.totalVolume = 0.0;
-    for (const auto& pair : objectBounds_) {
-        stats.totalVolume += pair.second.volume();
+    for (const auto& record : records_) {
+        if (record.object) {
+            sceneBounds.expand(record.bounds);
+            stats.totalVolume += record.bounds.volume();
+        }
     }
+    stats.sceneBounds = sceneBounds;
     
     return stats;
 }
@@ -680,7 +1340,7 @@ ObjectId SceneManager::generateUniqueId() {
     
     // Ensure uniqueness
     std::string idStr = oss.str();
-    while (objects_.find(idStr) != objects_.end()) {
+    while (handlesById_.find(idStr) != handlesById_.end()) {
         id = idDistribution_(randomGenerator_);
         oss.str("");
         oss << "obj_" << std::hex << id;
@@ -691,99 +1351,396 @@ ObjectId SceneManager::generateUniqueId() {
 }
 
 Geometry::BoundingBox SceneManager::calculateObjectBounds(const SceneObject& object) const {
-    // For now, create a simple bounding box based on the object's transform
-    // In a real implementation, this would use the object's geometry
-    const auto& transform = object.getTransform();
+    return calculateOrientedBounds(object).bounds();
+}
+
+Geometry::BoundingBox SceneManager::calculateObjectBounds(const SceneObject& object,
+                                                          const Geometry::Transform3D& transform) const {
+    return calculateOrientedBounds(object, transform).bounds();
+}
+
+Geometry::OrientedBoundingBox SceneManager::calculateOrientedBounds(const SceneObject& object) const {
+    return calculateOrientedBounds(object, object.getWorldMatrix());
+}
+
+Geometry::OrientedBoundingBox SceneManager::calculateOrientedBounds(const SceneObject& object,
+                                                                    const Geometry::Transform3D& transform) const {
+    return calculateOrientedBounds(object, transform.toMatrix());
+}
+
+Geometry::OrientedBoundingBox SceneManager::calculateOrientedBounds(const SceneObject& object,
+                                                                    const Geometry::Matrix4x4& worldMatrix) const {
+    // Objects with shared geometry use its extents
+    if (const auto& prototype = object.getShapePrototype()) {
+        return Geometry::OrientedBoundingBox::fromMatrix(prototype->getLocalBounds(), worldMatrix);
+    }
     
-    // Create a unit cube and transform it
-    Geometry::BoundingBox unitBox(
+    // Otherwise, create a unit cube and transform it
+    static const Geometry::BoundingBox unitBox(
         Geometry::Point3D(-0.5, -0.5, -0.5),
         Geometry::Point3D(0.5, 0.5, 0.5)
     );
     
-    return unitBox.transformed(transform);
+    return Geometry::OrientedBoundingBox::fromMatrix(unitBox, worldMatrix);
 }
 
-void SceneManager::updateSpatialIndex(const ObjectId& id, const Geometry::BoundingBox& oldBounds, 
+void SceneManager::updateSpatialIndex(ObjectHandle handle, const Geometry::BoundingBox& oldBounds, 
                                      const Geometry::BoundingBox& newBounds) {
-    spatialIndex_->updateObject(id, oldBounds, newBounds);
+    spatialIndex_->updateObject(handle, oldBounds, newBounds);
+    packedBounds_.set(handle.slot, newBounds);
+    sweepAndPrune_.updateObject(handle, newBounds);
+}
+
+void SceneManager::updateCollisionPairs(ObjectHandle handle, const Geometry::BoundingBox& bounds,
+                                        std::vector<CollisionPair>& started, std::vector<CollisionPair>& stopped) {
+    std::vector<ObjectHandle> overlapping;
+    if (!bounds.isEmpty()) {
+        const Geometry::OrientedBoundingBox& box = records_[handle.slot].orientedBounds;
+        overlapping = queryRegion(bounds);
+        overlapping.erase(std::remove_if(overlapping.begin(), overlapping.end(), [&](ObjectHandle other) {
+            return other == handle || !narrowPhaseOverlaps(box, other);
+        }), overlapping.end());
+    }
+    std::sort(overlapping.begin(), overlapping.end());
+    
+    auto& partners = records_[handle.slot].collisionPartners;
+    size_t startedBefore = started.size();
+    size_t stoppedBefore = stopped.size();
+    
+    // Both lists are sorted, so one merge pass finds the pairs that changed
+    auto current = partners.begin();
+    auto next = overlapping.begin();
+    while (current != partners.end() || next != overlapping.end()) {
+        if (next == overlapping.end() || (current != partners.end() && *current < *next)) {
+            stopped.push_back(makeCollisionPair(handle, *current));
+            dropCollisionPartner(*current, handle);
+            ++current;
+        } else if (current == partners.end() || *next < *current) {
+            started.push_back(makeCollisionPair(handle, *next));
+            auto& otherPartners = records_[next->slot].collisionPartners;
+            otherPartners.insert(std::upper_bound(otherPartners.begin(), otherPartners.end(), handle), handle);
+            ++next;
+        } else {
+            ++current;
+            ++next;
+        }
+    }
+    
+    partners = std::move(overlapping);
+    
+    collisionPairCount_ += started.size() - startedBefore;
+    collisionPairCount_ -= stopped.size() - stoppedBefore;
+}
+
+void SceneManager::removeCollisionPairs(ObjectHandle handle) {
+    auto& partners = records_[handle.slot].collisionPartners;
+    if (partners.empty()) return;
+    
+    std::vector<CollisionPair> stopped;
+    for (const auto& partner : partners) {
+        stopped.push_back(makeCollisionPair(handle, partner));
+        dropCollisionPartner(partner, handle);
+    }
+    
+    collisionPairCount_ -= stopped.size();
+    partners.clear();
+    
+    notifyCollisionsChanged({}, stopped);
+}
+
+void SceneManager::dropCollisionPartner(ObjectHandle handle, ObjectHandle partner) {
+    auto& partners = records_[handle.slot].collisionPartners;
+    auto it = std::lower_bound(partners.begin(), partners.end(), partner);
+    if (it != partners.end() && *it == partner) {
+        partners.erase(it);
+    }
+}
+
+void SceneManager::markObjectModified(ObjectHandle handle, ChangeKind kind) {
+    ObjectRecord& record = records_[handle.slot];
+    ++version_;
+    record.lastModifiedVersion = version_;
+    record.snapshotCopy.reset();
+    indexAttributes(handle);
+    logChange(record.object->getId(), kind);
+}
+
+void SceneManager::logChange(const ObjectId& id, ChangeKind kind) {
+    changeLog_.push_back(ChangeLogEntry{version_, id, kind});
+    trimChangeLog();
+}
+
+void SceneManager::trimChangeLog() {
+    while (changeLog_.size() > changeLogCapacity_) {
+        changeLogFloor_ = changeLog_.front().version;
+        changeLog_.pop_front();
+    }
+}
+
+void SceneManager::indexAttributes(ObjectHandle handle) {
+    ObjectRecord& record = records_[handle.slot];
+    const std::string& catalogItemId = record.object->getCatalogItemId();
+    
+    // Classification follows the catalog item, so an unchanged item needs no work
+    if (record.catalogItemKey != AttributeIndex::kNoKey &&
+        objectsByCatalogItem_.getKey(record.catalogItemKey) == catalogItemId) {
+        return;
+    }
+    
+    unindexAttributes(handle);
+    
+    ObjectClassification classification = classify(*record.object);
+    record.typeKey = objectsByType_.add(classification.type, handle);
+    record.categoryKey = objectsByCategory_.add(classification.category, handle);
+    record.catalogItemKey = objectsByCatalogItem_.add(catalogItemId, handle);
+}
+
+void SceneManager::unindexAttributes(ObjectHandle handle) {
+    ObjectRecord& record = records_[handle.slot];
+    
+    objectsByType_.remove(record.typeKey, handle);
+    objectsByCategory_.remove(record.categoryKey, handle);
+    objectsByCatalogItem_.remove(record.catalogItemKey, handle);
+    record.typeKey = AttributeIndex::kNoKey;
+    record.categoryKey = AttributeIndex::kNoKey;
+    record.catalogItemKey = AttributeIndex::kNoKey;
+}
+
+SceneManager::ObjectClassification SceneManager::classify(const SceneObject& object) const {
+    if (classificationResolver_) {
+        return classificationResolver_(object);
+    }
+    
+    return ObjectClassification{object.getCatalogItemId(), std::string()};
+}
+
+ObjectHandle SceneManager::findHandle(const ObjectId& id) const {
+    auto it = handlesById_.find(id);
+    return (it != handlesById_.end()) ? it->second : ObjectHandle();
+}
+
+const SceneManager::ObjectRecord* SceneManager::findRecord(ObjectHandle handle) const {
+    if (!handle.isValid() || handle.slot >= records_.size()) {
+        return nullptr;
+    }
+    
+    const ObjectRecord& record = records_[handle.slot];
+    return (record.object && record.generation == handle.generation) ? &record : nullptr;
+}
+
+const ObjectId& SceneManager::idOf(ObjectHandle handle) const {
+    return records_[handle.slot].object->getId();
+}
+
+std::vector<ObjectId> SceneManager::toObjectIds(const AttributeIndex::HandleSet* handles) const {
+    if (!handles) {
+        return {};
+    }
+    
+    std::vector<ObjectId> ids;
+    ids.reserve(handles->size());
+    
+    for (const auto& handle : *handles) {
+        ids.push_back(idOf(handle));
+    }
+    
+    return ids;
+}
+
+std::vector<ObjectId> SceneManager::toObjectIds(const std::vector<ObjectHandle>& handles) const {
+    std::vector<ObjectId> ids;
+    ids.reserve(handles.size());
+    
+    for (const auto& handle : handles) {
+        ids.push_back(idOf(handle));
+    }
+    
+    return ids;
+}
+
+SceneManager::CollisionPair SceneManager::makeCollisionPair(ObjectHandle a, ObjectHandle b) const {
+    const ObjectId& idA = idOf(a);
+    const ObjectId& idB = idOf(b);
+    return (idA < idB) ? CollisionPair(idA, idB) : CollisionPair(idB, idA);
 }
 
 void SceneManager::notifyObjectAdded(const ObjectId& id) {
-    if (objectAddedCallback_) {
-        objectAddedCallback_(id);
+    if (deferObjectEvents()) {
+        pendingChanges_.objectAdded(id);
+        return;
     }
+    
+    QueuedChanges queued{SceneChangeSet(), false};
+    queued.changes.added.push_back(id);
+    queuedChanges_.push_back(std::move(queued));
 }
 
 void SceneManager::notifyObjectRemoved(const ObjectId& id) {
-    if (objectRemovedCallback_) {
-        objectRemovedCallback_(id);
+    if (deferObjectEvents()) {
+        pendingChanges_.objectRemoved(id);
+        return;
     }
+    
+    QueuedChanges queued{SceneChangeSet(), false};
+    queued.changes.removed.push_back(id);
+    queuedChanges_.push_back(std::move(queued));
 }
 
 void SceneManager::notifyObjectModified(const ObjectId& id) {
-    if (objectModifiedCallback_) {
-        objectModifiedCallback_(id);
+    if (deferObjectEvents()) {
+        pendingChanges_.objectModified(id);
+        return;
+    }
+    
+    QueuedChanges queued{SceneChangeSet(), false};
+    queued.changes.modified.push_back(id);
+    queuedChanges_.push_back(std::move(queued));
+}
+
+void SceneManager::notifyObjectsModified(const std::vector<ObjectId>& ids) {
+    if (deferObjectEvents()) {
+        for (const auto& id : ids) {
+            pendingChanges_.objectModified(id);
+        }
+        return;
+    }
+    
+    QueuedChanges queued{SceneChangeSet(), true};
+    queued.changes.modified = ids;
+    queuedChanges_.push_back(std::move(queued));
+}
+
+bool SceneManager::deferObjectEvents() {
+    if (batchDepth_ > 0) return true;
+    if (!flushScheduler_) return false;
+    
+    if (!flushScheduled_) {
+        flushScheduled_ = true;
+        flushRequested_ = true;
+    }
+    return true;
+}
+
+void SceneManager::deliverQueuedChanges(std::unique_lock<std::shared_mutex>& lock) {
+    std::vector<QueuedChanges> queued;
+    std::vector<QueuedCollisions> collisions;
+    queued.swap(queuedChanges_);
+    collisions.swap(queuedCollisions_);
+    CollisionChangedCallback collisionCallback;
+    if (!collisions.empty()) {
+        collisionCallback = collisionChangedCallback_;
+    }
+    
+    std::function<void()> scheduler;
+    if (flushRequested_) {
+        flushRequested_ = false;
+        scheduler = flushScheduler_;
+    }
+    lock.unlock();
+    
+    if (scheduler) {
+        scheduler();
+    }
+    for (const auto& entry : collisions) {
+        if (collisionCallback) {
+            collisionCallback(entry.started, entry.stopped);
+        }
+    }
+    for (const auto& entry : queued) {
+        deliverChanges(entry.changes, entry.grouped);
+    }
+}
+
+void SceneManager::deliverChanges(const SceneChangeSet& changes, bool grouped) {
+    if (changes.empty()) return;
+    
+    if (changeSetCallback_) {
+        changeSetCallback_(changes);
+        return;
+    }
+    
+    // Removals first, so an id is never reported twice as live
+    if (objectRemovedCallback_) {
+        for (const auto& id : changes.removed) {
+            objectRemovedCallback_(id);
+        }
+    }
+    if (objectAddedCallback_) {
+        for (const auto& id : changes.added) {
+            objectAddedCallback_(id);
+        }
+    }
+    if (objectsModifiedCallback_ && grouped) {
+        if (!changes.modified.empty()) {
+            objectsModifiedCallback_(changes.modified);
+        }
+    } else if (objectModifiedCallback_) {
+        for (const auto& id : changes.modified) {
+            objectModifiedCallback_(id);
+        }
     }
 }
 
 void SceneManager::notifySelectionChanged() {
     if (selectionChangedCallback_) {
-        std::vector<ObjectId> selection(selectedObjects_.begin(), selectedObjects_.end());
-        selectionChangedCallback_(selection);
+        selectionChangedCallback_(toObjectIds(std::vector<ObjectHandle>(selectedObjects_.begin(),
+                                                                        selectedObjects_.end())));
+    }
+}
+
+void SceneManager::notifyCollisionsChanged(const std::vector<CollisionPair>& started,
+                                           const std::vector<CollisionPair>& stopped) {
+    if (collisionChangedCallback_ && (!started.empty() || !stopped.empty())) {
+        queuedCollisions_.push_back({started, stopped});
     }
 }
 
 bool SceneManager::validateObjectId(const ObjectId& id) const {
-    return objects_.find(id) != objects_.end();
+    return handlesById_.find(id) != handlesById_.end();
 }
 
 bool SceneManager::applyTransformToObject(const ObjectId& id, const Geometry::Transform3D& transform) {
-    std::lock_guard<std::mutex> lock(mutex_);
+    std::unique_lock<std::shared_mutex> lock(mutex_);
     
-    auto objectIt = objects_.find(id);
-    if (objectIt == objects_.end()) {
+    ObjectHandle handle = findHandle(id);
+    if (!handle.isValid()) {
         LOG_WARNING("Cannot transform non-existent object: " + id);
         return false;
     }
     
-    auto boundsIt = objectBounds_.find(id);
-    if (boundsIt == objectBounds_.end()) {
-        LOG_ERROR("Object " + id + " has no bounding box information");
-        return false;
-    }
+    ObjectRecord& record = records_[handle.slot];
     
-    // Check for collisions if enabled
-    if (enableCollisionDetection_) {
-        // Get all other object bounds (without acquiring lock since we already have it)
-        std::vector<Geometry::BoundingBox> otherBounds;
-        for (const auto& pair : objectBounds_) {
-            if (pair.first != id) {
-                otherBounds.push_back(pair.second);
-            }
-        }
-        
-        if (CollisionDetector::wouldCollide(boundsIt->second, transform, otherBounds)) {
-            LOG_DEBUG("Transform rejected due to collision for object: " + id);
-            return false;
-        }
+    // Check for collisions if enabled; the matrix built here is kept by the object
+    Geometry::CachedTransform3D placed(transform);
+    Geometry::OrientedBoundingBox newOrientedBounds = calculateOrientedBounds(*record.object, placed.matrix());
+    if (enableCollisionDetection_ && overlapsOtherObjects(handle, newOrientedBounds)) {
+        LOG_DEBUG("Transform rejected due to collision for object: " + id);
+        return false;
     }
     
     // Store old bounds for spatial index update
-    Geometry::BoundingBox oldBounds = boundsIt->second;
+    Geometry::BoundingBox oldBounds = record.bounds;
     
     // Apply transform to object
-    objectIt->second->setTransform(transform);
+    record.object->setTransform(placed);
     
     // Recalculate bounds
-    Geometry::BoundingBox newBounds = calculateObjectBounds(*objectIt->second);
-    boundsIt->second = newBounds;
+    Geometry::BoundingBox newBounds = newOrientedBounds.bounds();
+    record.bounds = newBounds;
+    record.orientedBounds = newOrientedBounds;
     
     // Update spatial index
-    updateSpatialIndex(id, oldBounds, newBounds);
+    updateSpatialIndex(handle, oldBounds, newBounds);
+    
+    std::vector<CollisionPair> started;
+    std::vector<CollisionPair> stopped;
+    updateCollisionPairs(handle, newBounds, started, stopped);
+    notifyCollisionsChanged(started, stopped);
+    markObjectModified(handle);
     
     LOG_DEBUG("Applied transform to object: " + id);
     notifyObjectModified(id);
+    deliverQueuedChanges(lock);
     
     return true;
 }
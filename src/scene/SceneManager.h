@@ -3,57 +3,38 @@
 #include "../interfaces/ISceneManager.h"
 #include "../models/Project.h"
 #include "../geometry/BoundingBox.h"
+#include "../geometry/OrientedBoundingBox.h"
 #include "../geometry/Transform3D.h"
+#include "../geometry/CachedTransform3D.h"
+#include "SpatialIndex.h"
+#include "SweepAndPrune.h"
+#include "SceneSnapshot.h"
+#include "BoundsSoA.h"
+#include "AttributeIndex.h"
+#include "ChangeSetBuilder.h"
+#include "ObjectHandle.h"
 #include <unordered_map>
 #include <unordered_set>
 #include <vector>
 #include <memory>
 #include <string>
 #include <functional>
+#include <limits>
+#include <optional>
 #include <mutex>
+#include <shared_mutex>
 #include <random>
+#include <deque>
 
 namespace KitchenCAD {
 namespace Scene {
 
-/**
- * @brief Spatial index for efficient spatial queries
- * 
- * Simple spatial partitioning system for fast collision detection
- * and spatial queries. Uses a grid-based approach for simplicity.
- */
-class SpatialIndex {
-private:
-    struct GridCell {
-        std::unordered_set<ObjectId> objects;
-    };
-    
-    double cellSize_;
-    std::unordered_map<std::string, GridCell> grid_;
-    
-public:
-    explicit SpatialIndex(double cellSize = 1.0);
-    
-    void addObject(const ObjectId& id, const Geometry::BoundingBox& bounds);
-    void removeObject(const ObjectId& id, const Geometry::BoundingBox& bounds);
-    void updateObject(const ObjectId& id, const Geometry::BoundingBox& oldBounds, 
-                      const Geometry::BoundingBox& newBounds);
-    
-    std::vector<ObjectId> queryRegion(const Geometry::BoundingBox& region) const;
-    std::vector<ObjectId> queryRadius(const Geometry::Point3D& center, double radius) const;
-    
-    void clear();
-    
-private:
-    std::string getCellKey(int x, int y, int z) const;
-    std::vector<std::string> getCellsForBounds(const Geometry::BoundingBox& bounds) const;
-};
-
 /**
  * @brief Collision detection system
  * 
- * Handles collision detection between objects using bounding boxes
- * and more precise geometric tests when available.
+ * Handles collision detection between objects using bounding boxes.
+ * Axis-aligned boxes serve as the broadphase; oriented boxes give the exact
+ * answer for rotated objects.
  */
 class CollisionDetector {
 public:
@@ -81,6 +62,22 @@ public:
                                             const Geometry::BoundingBox& a, 
                                             const Geometry::BoundingBox& b);
     
+    /**
+     * @brief Check if two oriented boxes intersect (separating axis test)
+     */
+    static bool checkOrientedBoxIntersection(const Geometry::OrientedBoundingBox& a,
+                                             const Geometry::OrientedBoundingBox& b,
+                                             double tolerance = 0.0);
+    
+    /**
+     * @brief Calculate the minimum separating translation of box a out of box b
+     * 
+     * Boxes that do not intersect report a zero vector and depth.
+     */
+    static CollisionInfo calculatePenetration(const ObjectId& idA, const ObjectId& idB,
+                                              const Geometry::OrientedBoundingBox& a,
+                                              const Geometry::OrientedBoundingBox& b);
+    
     /**
      * @brief Check if an object at a given transform would collide with others
      */
@@ -96,39 +93,179 @@ public:
  * collision detection, and spatial queries.
  */
 class SceneManager : public ISceneManager {
+public:
+    /**
+     * @brief Unordered pair of overlapping objects, stored with first < second
+     */
+    using CollisionPair = std::pair<ObjectId, ObjectId>;
+    
+    /**
+     * @brief Reports pairs that started and stopped overlapping after a change
+     */
+    using CollisionChangedCallback = std::function<void(const std::vector<CollisionPair>& started,
+                                                        const std::vector<CollisionPair>& stopped)>;
+    
+    /**
+     * @brief Object bounds hit by a ray, at the distance the ray enters them
+     */
+    struct RaycastHit {
+        ObjectId objectId;
+        double distance;
+        Geometry::Point3D point;
+    };
+    
+    /**
+     * @brief Type and category an object is indexed under
+     */
+    struct ObjectClassification {
+        std::string type;
+        std::string category;
+    };
+    
+    /**
+     * @brief Derives an object's classification, typically from its catalog item
+     */
+    using ClassificationResolver = std::function<ObjectClassification(const SceneObject& object)>;
+    
+    /**
+     * @brief Net object changes between two scene versions
+     */
+    struct SceneDelta {
+        uint64_t fromVersion = 0;
+        uint64_t toVersion = 0;
+        
+        // False when the change log no longer reaches back to fromVersion (or the
+        // scene was cleared since); the caller must then rebuild from scratch
+        bool complete = true;
+        
+        bool selectionChanged = false;
+        SceneChangeSet changes;
+    };
+    
+    static constexpr size_t kDefaultChangeLogCapacity = 65536;
+
 private:
-    // Object storage
-    std::unordered_map<ObjectId, std::unique_ptr<SceneObject>> objects_;
-    std::unordered_map<ObjectId, Geometry::BoundingBox> objectBounds_;
+    /**
+     * @brief Storage for one object slot, addressed by ObjectHandle::slot
+     */
+    struct ObjectRecord {
+        std::unique_ptr<SceneObject> object;    // Null for free slots
+        Geometry::BoundingBox bounds;
+        Geometry::OrientedBoundingBox orientedBounds;   // Narrow phase shape; bounds encloses it
+        uint32_t generation = 0;
+        
+        // Scene version of the object's last change
+        uint64_t lastModifiedVersion = 0;
+        
+        // Live overlapping partners, kept sorted
+        std::vector<ObjectHandle> collisionPartners;
+        
+        // Copy shared by snapshots until the object changes; guarded by snapshotMutex_
+        mutable std::shared_ptr<const SceneObject> snapshotCopy;
+        
+        // Keys this object is filed under in the attribute indexes
+        uint32_t typeKey = AttributeIndex::kNoKey;
+        uint32_t categoryKey = AttributeIndex::kNoKey;
+        uint32_t catalogItemKey = AttributeIndex::kNoKey;
+    };
+    
+    // Object storage: dense slots internally, string ids only at the API boundary
+    std::vector<ObjectRecord> records_;
+    std::vector<uint32_t> freeSlots_;
+    std::unordered_map<ObjectId, ObjectHandle> handlesById_;
     
     // Selection management
-    std::unordered_set<ObjectId> selectedObjects_;
+    std::unordered_set<ObjectHandle, ObjectHandleHash> selectedObjects_;
     
     // Spatial indexing
-    std::unique_ptr<SpatialIndex> spatialIndex_;
+    std::unique_ptr<ISpatialIndex> spatialIndex_;
+    double spatialCellSize_;
+    
+    // Packed float copy of record bounds, scanned with SIMD in small scenes
+    BoundsSoA packedBounds_;
+    
+    // All-pairs broadphase for scene-wide collision reporting
+    SweepAndPrune sweepAndPrune_;
+    
+    // Number of live overlapping pairs across all records
+    size_t collisionPairCount_;
+    
+    // Secondary indexes for attribute queries and counts
+    AttributeIndex objectsByType_;
+    AttributeIndex objectsByCategory_;
+    AttributeIndex objectsByCatalogItem_;
+    ClassificationResolver classificationResolver_;
+    
+    // Allocation target for objects the scene creates itself
+    std::shared_ptr<Models::SceneObjectPool> objectPool_;
     
     // ID generation
     std::mt19937 randomGenerator_;
     std::uniform_int_distribution<uint64_t> idDistribution_;
     
-    // Thread safety
-    mutable std::mutex mutex_;
+    // Thread safety: queries take a shared lock, edits an exclusive one
+    mutable std::shared_mutex mutex_;
+    mutable std::mutex sweepMutex_;
+    
+    // Snapshot support. Readers rebuild the cached snapshot under the shared
+    // lock, so the snapshot and per-record copies are additionally guarded by snapshotMutex_
+    uint64_t version_;
+    uint64_t selectionVersion_;
+    mutable std::mutex snapshotMutex_;
+    mutable std::shared_ptr<const SceneSnapshot> snapshot_;
+    
+    // Object changes in version order, for getChangesSince(). Entries at or
+    // below changeLogFloor_ have been dropped, so older versions cannot be served
+    enum class ChangeKind : uint8_t { Added, Removed, Modified };
+    struct ChangeLogEntry {
+        uint64_t version;
+        ObjectId id;
+        ChangeKind kind;
+    };
+    std::deque<ChangeLogEntry> changeLog_;
+    uint64_t changeLogFloor_;
+    size_t changeLogCapacity_;
     
     // Event callbacks
     ObjectCallback objectAddedCallback_;
     ObjectCallback objectRemovedCallback_;
     ObjectCallback objectModifiedCallback_;
+    ObjectsCallback objectsModifiedCallback_;
     SelectionCallback selectionChangedCallback_;
+    CollisionChangedCallback collisionChangedCallback_;
+    ChangeSetCallback changeSetCallback_;
+    
+    // Object events held back while a batch is open or a flush is scheduled
+    ChangeSetBuilder pendingChanges_;
+    int batchDepth_;
+    std::function<void()> flushScheduler_;
+    bool flushScheduled_;
+    bool flushRequested_;       // Scheduler is called once the scene is unlocked
+    
+    // Object events raised outside a batch; delivered once the change releases the lock
+    struct QueuedChanges {
+        SceneChangeSet changes;
+        bool grouped;           // A multi-object edit, reported as one event
+    };
+    std::vector<QueuedChanges> queuedChanges_;
+    
+    // Collision pair changes, delivered like queued object events
+    struct QueuedCollisions {
+        std::vector<CollisionPair> started;
+        std::vector<CollisionPair> stopped;
+    };
+    std::vector<QueuedCollisions> queuedCollisions_;
     
     // Configuration
     double collisionTolerance_;
     bool enableCollisionDetection_;
-    
+
 public:
     /**
      * @brief Constructor
      */
-    explicit SceneManager(double spatialCellSize = 1.0, double collisionTolerance = 1e-6);
+    explicit SceneManager(double spatialCellSize = 1.0, double collisionTolerance = 1e-6,
+                          SpatialIndexType indexType = SpatialIndexType::HashedGrid);
     
     /**
      * @brief Destructor
@@ -142,6 +279,7 @@ public:
     bool removeObject(const ObjectId& id) override;
     SceneObject* getObject(const ObjectId& id) override;
     const SceneObject* getObject(const ObjectId& id) const override;
+    bool modifyObject(const ObjectId& id, const std::function<void(SceneObject&)>& edit) override;
     
     // Object queries
     std::vector<ObjectId> getAllObjects() const override;
@@ -152,13 +290,18 @@ public:
     // Spatial queries
     std::vector<ObjectId> findIntersectingObjects(const ObjectId& objectId) const override;
     std::vector<ObjectId> findNearbyObjects(const ObjectId& objectId, double radius) const override;
+    std::vector<ObjectId> findNearestObjects(const Geometry::Point3D& point, size_t k,
+                                             double maxDistance = std::numeric_limits<double>::infinity()) const override;
     bool checkCollision(const ObjectId& objectId, const Geometry::Transform3D& newTransform) const override;
+    SweepResult checkSweptCollision(const ObjectId& objectId, const Geometry::Transform3D& fromTransform,
+                                    const Geometry::Transform3D& toTransform) const override;
     
     // Object transformation
     bool moveObject(const ObjectId& id, const Geometry::Transform3D& transform) override;
     bool translateObject(const ObjectId& id, const Geometry::Vector3D& translation) override;
     bool rotateObject(const ObjectId& id, const Geometry::Vector3D& rotation) override;
     bool scaleObject(const ObjectId& id, const Geometry::Vector3D& scale) override;
+    bool applyTransforms(std::span<const ObjectTransform> transforms) override;
     
     // Selection management
     void setSelection(const std::vector<ObjectId>& selection) override;
@@ -185,8 +328,16 @@ public:
     void setObjectAddedCallback(ObjectCallback callback) override;
     void setObjectRemovedCallback(ObjectCallback callback) override;
     void setObjectModifiedCallback(ObjectCallback callback) override;
+    void setObjectsModifiedCallback(ObjectsCallback callback) override;
     void setSelectionChangedCallback(SelectionCallback callback) override;
     
+    // Change batching
+    void setChangeSetCallback(ChangeSetCallback callback) override;
+    void beginBatch() override;
+    void endBatch() override;
+    void setChangeFlushScheduler(std::function<void()> scheduler) override;
+    void flushChanges() override;
+    
     // Additional functionality
     
     /**
@@ -209,11 +360,191 @@ public:
      */
     double getCollisionTolerance() const { return collisionTolerance_; }
     
+    /**
+     * @brief Get the internal handle of an object (invalid if it does not exist)
+     */
+    ObjectHandle getHandle(const ObjectId& id) const;
+    
+    /**
+     * @brief Get the object ID for a handle (empty if the handle is stale)
+     */
+    ObjectId getObjectId(ObjectHandle handle) const;
+    
+    /**
+     * @brief Check whether a handle still refers to a live object
+     */
+    bool isValidHandle(ObjectHandle handle) const;
+    
+    /**
+     * @brief Get the scene version, incremented on every change
+     */
+    uint64_t getVersion() const;
+    
+    /**
+     * @brief Get an immutable snapshot of objects, bounds and selection
+     * 
+     * The snapshot is cached until the scene changes, and unchanged objects
+     * are shared with the previous snapshot rather than copied. Worker threads
+     * can keep reading it while the scene is edited. Objects modified through
+     * a pointer from the non-const getObject() are only picked up if the
+     * modification happened before the snapshot was taken.
+     */
+    std::shared_ptr<const SceneSnapshot> getSnapshot() const;
+    
+    /**
+     * @brief Net object changes made after a version returned by getVersion()
+     * 
+     * Lets validation, pricing, rendering and autosave caches process only
+     * what changed: remember toVersion and pass it back next time. Cost is
+     * proportional to the number of changes logged since the version.
+     */
+    SceneDelta getChangesSince(uint64_t version) const;
+    
+    /**
+     * @brief Scene version at which an object last changed (0 if it does not exist)
+     */
+    uint64_t getObjectVersion(const ObjectId& id) const;
+    
+    /**
+     * @brief Limit the change log to the most recent entries
+     * 
+     * Versions older than the retained log get an incomplete delta.
+     */
+    void setChangeLogCapacity(size_t capacity);
+    
+    /**
+     * @brief Construct a SceneObject in the scene's object pool
+     * 
+     * The object is not added to the scene.
+     */
+    template<typename... Args>
+    std::unique_ptr<SceneObject> createObject(Args&&... args) const {
+        auto pool = getObjectPool();
+        Models::SceneObjectPool::Scope scope(pool);
+        return std::make_unique<SceneObject>(std::forward<Args>(args)...);
+    }
+    
+    /**
+     * @brief Pool that duplicated and created objects are allocated from
+     * 
+     * The scene starts with its own pool; a controller holding a project
+     * passes the project's pool so both allocate from the same slabs.
+     */
+    std::shared_ptr<Models::SceneObjectPool> getObjectPool() const;
+    void setObjectPool(std::shared_ptr<Models::SceneObjectPool> pool);
+    
+    /**
+     * @brief Get the spatial index backend in use
+     */
+    SpatialIndexType getSpatialIndexType() const;
+    
+    /**
+     * @brief Switch the spatial index backend, rebuilding it from current bounds
+     * 
+     * Small rooms are well served by a uniform grid; large projects with a wide
+     * range of object sizes should use the AABB tree.
+     */
+    void setSpatialIndexType(SpatialIndexType type);
+    
     /**
      * @brief Get all current collisions in the scene
      */
     std::vector<CollisionDetector::CollisionInfo> detectAllCollisions() const;
     
+    /**
+     * @brief Get the overlapping pairs tracked incrementally as objects change
+     * 
+     * Unlike detectAllCollisions() this does not scan the scene; the set is
+     * maintained by addObject, removeObject and every applied transform.
+     */
+    std::vector<CollisionPair> getCurrentCollisions() const;
+    
+    /**
+     * @brief Set callback invoked when pairs start or stop overlapping
+     * 
+     * Called once the change has released the scene, so it may query it.
+     */
+    void setCollisionChangedCallback(CollisionChangedCallback callback);
+    
+    /**
+     * @brief Find the nearest object whose bounds the ray hits within maxDistance
+     * 
+     * Candidates come from the spatial index, so picking only visits the
+     * cells or tree nodes along the ray. A ray starting inside an object's
+     * bounds hits it at distance zero.
+     */
+    std::optional<RaycastHit> raycast(const Geometry::Point3D& origin, const Geometry::Vector3D& direction,
+                                      double maxDistance = std::numeric_limits<double>::infinity()) const;
+    
+    /**
+     * @brief Find every object whose bounds the ray hits, sorted by distance
+     */
+    std::vector<RaycastHit> raycastAll(const Geometry::Point3D& origin, const Geometry::Vector3D& direction,
+                                       double maxDistance = std::numeric_limits<double>::infinity()) const;
+    
+    /**
+     * @brief Get objects whose bounds are at least partly inside the frustum
+     * 
+     * The box test is conservative near frustum corners, so this is a
+     * candidate set for view culling rather than an exact visibility test.
+     */
+    std::vector<ObjectId> queryFrustum(const Geometry::Frustum& frustum) const;
+    
+    /**
+     * @brief Get an object's bounds (empty if it does not exist)
+     */
+    Geometry::BoundingBox getObjectBounds(const ObjectId& id) const;
+    
+    /**
+     * @brief Oriented box an object would have with another transform (empty if it does not exist)
+     */
+    Geometry::OrientedBoundingBox getOrientedBoundsAt(const ObjectId& id, const Geometry::Transform3D& transform) const;
+    
+    /**
+     * @brief Get objects whose oriented boxes overlap a box, within the collision tolerance
+     * 
+     * The box need not belong to an object of this scene, which lets a
+     * partitioned scene test an object against its neighbours' partitions.
+     */
+    std::vector<ObjectId> findObjectsOverlapping(const Geometry::OrientedBoundingBox& box) const;
+    
+    /**
+     * @brief Get objects whose bounds centres lie within a radius of a point
+     */
+    std::vector<ObjectId> findObjectsWithinRadius(const Geometry::Point3D& center, double radius) const;
+    
+    /**
+     * @brief Sweep a box from one set of bounds to another, as checkSweptCollision() does for objects
+     * 
+     * Objects overlapping the start bounds are ignored. The result's transform
+     * is left at its default; callers interpolate their own.
+     */
+    SweepResult sweepBounds(const Geometry::BoundingBox& startBounds, const Geometry::BoundingBox& endBounds) const;
+    
+    /**
+     * @brief Set how objects are classified for type and category queries
+     * 
+     * Without a resolver an object's type is its catalog item id and its
+     * category is empty. Classifications are resolved when an object is
+     * added and again only when modifyObject() changes its catalog item id,
+     * so the resolver should depend on the catalog item alone. It is called
+     * with the scene locked and must not call back into the scene. Setting a
+     * resolver re-indexes every object.
+     */
+    void setClassificationResolver(ClassificationResolver resolver);
+    
+    /**
+     * @brief Get objects created from a catalog item
+     */
+    std::vector<ObjectId> getObjectsByCatalogItem(const std::string& catalogItemId) const;
+    
+    /**
+     * @brief Object counts per type, category or catalog item, in constant time
+     */
+    size_t countObjectsOfType(const std::string& type) const;
+    size_t countObjectsByCategory(const std::string& category) const;
+    size_t countObjectsByCatalogItem(const std::string& catalogItemId) const;
+    
     /**
      * @brief Get objects that would be affected by moving an object
      */
@@ -235,6 +566,7 @@ public:
         Geometry::BoundingBox sceneBounds;
         double totalVolume;
         std::unordered_map<std::string, size_t> objectsByType;
+        std::unordered_map<std::string, size_t> objectsByCategory;
     };
     
     SceneStatistics getStatistics() const;
@@ -251,18 +583,137 @@ private:
     Geometry::BoundingBox calculateObjectBounds(const SceneObject& object) const;
     
     /**
-     * @brief Update spatial index when object changes
+     * @brief Calculate the bounding box an object would have with another transform
+     */
+    Geometry::BoundingBox calculateObjectBounds(const SceneObject& object,
+                                                const Geometry::Transform3D& transform) const;
+    
+    /**
+     * @brief Calculate an object's oriented box from its cached world matrix
      */
-    void updateSpatialIndex(const ObjectId& id, const Geometry::BoundingBox& oldBounds, 
+    Geometry::OrientedBoundingBox calculateOrientedBounds(const SceneObject& object) const;
+    
+    /**
+     * @brief Calculate the oriented box an object would have with a transform
+     */
+    Geometry::OrientedBoundingBox calculateOrientedBounds(const SceneObject& object,
+                                                          const Geometry::Transform3D& transform) const;
+    Geometry::OrientedBoundingBox calculateOrientedBounds(const SceneObject& object,
+                                                          const Geometry::Matrix4x4& worldMatrix) const;
+    
+    /**
+     * @brief Update spatial index, packed bounds and broadphase when object changes
+     */
+    void updateSpatialIndex(ObjectHandle handle, const Geometry::BoundingBox& oldBounds, 
                            const Geometry::BoundingBox& newBounds);
     
     /**
-     * @brief Notify callbacks about object changes
+     * @brief Queue object changes for the callbacks
+     * 
+     * Called with the scene locked; the events reach subscribers through
+     * deliverQueuedChanges() once the change is complete.
      */
     void notifyObjectAdded(const ObjectId& id);
     void notifyObjectRemoved(const ObjectId& id);
     void notifyObjectModified(const ObjectId& id);
+    void notifyObjectsModified(const std::vector<ObjectId>& ids);
     void notifySelectionChanged();
+    void notifyCollisionsChanged(const std::vector<CollisionPair>& started,
+                                 const std::vector<CollisionPair>& stopped);
+    
+    /**
+     * @brief Whether object events should be collected rather than delivered now
+     * 
+     * Requests a flush on the first deferred event outside a batch.
+     */
+    bool deferObjectEvents();
+    
+    /**
+     * @brief Release the scene lock, then run a requested flush scheduler and deliver queued
+     * collision and object events
+     * 
+     * Subscribers run unlocked, so they may query or edit the scene.
+     */
+    void deliverQueuedChanges(std::unique_lock<std::shared_mutex>& lock);
+    
+    /**
+     * @brief Deliver a change set to the change set callback or the per-object callbacks
+     * @param grouped Report modifications through the objects-modified callback when set
+     */
+    void deliverChanges(const SceneChangeSet& changes, bool grouped = true);
+    
+    /**
+     * @brief Re-evaluate the live collision pairs of one object against its new bounds
+     * 
+     * Pairs that changed are appended to started and stopped for the caller to report.
+     */
+    void updateCollisionPairs(ObjectHandle handle, const Geometry::BoundingBox& bounds,
+                              std::vector<CollisionPair>& started, std::vector<CollisionPair>& stopped);
+    
+    /**
+     * @brief Drop all live collision pairs involving an object
+     */
+    void removeCollisionPairs(ObjectHandle handle);
+    void dropCollisionPartner(ObjectHandle handle, ObjectHandle partner);
+    
+    /**
+     * @brief Bump the scene version, log the change and mark the object for re-copy in the next snapshot
+     */
+    void markObjectModified(ObjectHandle handle, ChangeKind kind = ChangeKind::Modified);
+    
+    /**
+     * @brief Append an object change at the current version
+     */
+    void logChange(const ObjectId& id, ChangeKind kind);
+    void trimChangeLog();
+    
+    /**
+     * @brief File an object in the attribute indexes, re-classifying it if its catalog item changed
+     */
+    void indexAttributes(ObjectHandle handle);
+    void unindexAttributes(ObjectHandle handle);
+    ObjectClassification classify(const SceneObject& object) const;
+    
+    /**
+     * @brief Region query without locking
+     */
+    std::vector<ObjectHandle> queryRegion(const Geometry::BoundingBox& region) const;
+    
+    /**
+     * @brief Check whether a box would overlap any object other than the given one
+     */
+    bool overlapsOtherObjects(ObjectHandle handle, const Geometry::OrientedBoundingBox& box) const;
+    
+    /**
+     * @brief Narrow phase for a broadphase candidate: exact oriented box test
+     */
+    bool narrowPhaseOverlaps(const Geometry::OrientedBoundingBox& box, ObjectHandle other) const;
+    
+    /**
+     * @brief Centre-distance radius query and bounds sweep shared by the object and
+     * free-box variants; caller holds the lock
+     */
+    std::vector<ObjectId> collectWithinRadius(const Geometry::Point3D& center, double radius,
+                                              ObjectHandle exclude) const;
+    void sweepBoundsUnlocked(const Geometry::BoundingBox& startBounds, const Geometry::BoundingBox& endBounds,
+                             ObjectHandle exclude, SweepResult& result) const;
+    
+    /**
+     * @brief Collect (entry distance, handle) for objects the ray hits; caller holds the lock
+     */
+    std::vector<std::pair<double, ObjectHandle>> findRayHits(const Geometry::Point3D& origin,
+                                                             const Geometry::Vector3D& direction,
+                                                             double maxDistance) const;
+    
+    /**
+     * @brief Handle lookups without locking
+     */
+    ObjectHandle findHandle(const ObjectId& id) const;
+    const ObjectRecord* findRecord(ObjectHandle handle) const;
+    const ObjectId& idOf(ObjectHandle handle) const;
+    std::vector<ObjectId> toObjectIds(const std::vector<ObjectHandle>& handles) const;
+    std::vector<ObjectId> toObjectIds(const AttributeIndex::HandleSet* handles) const;
+    CollisionPair makeCollisionPair(ObjectHandle a, ObjectHandle b) const;
     
     /**
      * @brief Validate object ID exists
@@ -0,0 +1,65 @@
+#include "SceneSnapshot.h"
+
+namespace KitchenCAD {
+namespace Scene {
+
+const SceneObject* SceneSnapshot::getObject(const ObjectId& id) const {
+    auto it = entries_.find(id);
+    return (it != entries_.end()) ? it->second.object.get() : nullptr;
+}
+
+Geometry::BoundingBox SceneSnapshot::getObjectBounds(const ObjectId& id) const {
+    auto it = entries_.find(id);
+    return (it != entries_.end()) ? it->second.bounds : Geometry::BoundingBox();
+}
+
+std::vector<ObjectId> SceneSnapshot::getAllObjects() const {
+    std::vector<ObjectId> result;
+    result.reserve(entries_.size());
+    
+    for (const auto& pair : entries_) {
+        result.push_back(pair.first);
+    }
+    
+    return result;
+}
+
+std::vector<ObjectId> SceneSnapshot::getObjectsInRegion(const Geometry::BoundingBox& region) const {
+    std::vector<ObjectId> result;
+    
+    // Snapshots carry no spatial index; workers scan, which keeps snapshots cheap to take
+    for (const auto& pair : entries_) {
+        if (region.intersects(pair.second.bounds)) {
+            result.push_back(pair.first);
+        }
+    }
+    
+    return result;
+}
+
+std::vector<ObjectId> SceneSnapshot::getSelection() const {
+    return std::vector<ObjectId>(selection_.begin(), selection_.end());
+}
+
+bool SceneSnapshot::isSelected(const ObjectId& id) const {
+    return selection_.find(id) != selection_.end();
+}
+
+Geometry::BoundingBox SceneSnapshot::getSceneBounds() const {
+    Geometry::BoundingBox result;
+    
+    for (const auto& pair : entries_) {
+        result.expand(pair.second.bounds);
+    }
+    
+    return result;
+}
+
+void SceneSnapshot::forEachObject(std::function<void(const ObjectId&, const SceneObject*)> callback) const {
+    for (const auto& pair : entries_) {
+        callback(pair.first, pair.second.object.get());
+    }
+}
+
+} // namespace Scene
+} // namespace KitchenCAD
\ No newline at end of file
@@ -0,0 +1,63 @@
+#pragma once
+
+#include "../interfaces/ISceneManager.h"
+#include "../models/Project.h"
+#include "../geometry/BoundingBox.h"
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+namespace KitchenCAD {
+namespace Scene {
+
+/**
+ * @brief Immutable, versioned view of a scene at one point in time
+ * 
+ * Snapshots are produced by SceneManager::getSnapshot() and can be read from
+ * any thread without locking while the scene keeps being edited. Objects are
+ * shared between consecutive snapshots and only copied again once they have
+ * been modified, so taking a snapshot of a mostly idle scene is cheap.
+ */
+class SceneSnapshot {
+public:
+    struct Entry {
+        std::shared_ptr<const SceneObject> object;
+        Geometry::BoundingBox bounds;
+    };
+    
+    /**
+     * @brief Scene version this snapshot was taken at
+     */
+    uint64_t getVersion() const { return version_; }
+    
+    // Object access
+    const SceneObject* getObject(const ObjectId& id) const;
+    Geometry::BoundingBox getObjectBounds(const ObjectId& id) const;
+    std::vector<ObjectId> getAllObjects() const;
+    std::vector<ObjectId> getObjectsInRegion(const Geometry::BoundingBox& region) const;
+    
+    // Selection
+    std::vector<ObjectId> getSelection() const;
+    bool isSelected(const ObjectId& id) const;
+    
+    // Scene properties
+    Geometry::BoundingBox getSceneBounds() const;
+    size_t getObjectCount() const { return entries_.size(); }
+    bool isEmpty() const { return entries_.empty(); }
+    
+    // Iteration support
+    void forEachObject(std::function<void(const ObjectId&, const SceneObject*)> callback) const;
+
+private:
+    friend class SceneManager;
+    
+    uint64_t version_ = 0;
+    std::unordered_map<ObjectId, Entry> entries_;
+    std::unordered_set<ObjectId> selection_;
+};
+
+} // namespace Scene
+} // namespace KitchenCAD
\ No newline at end of file
@@ -0,0 +1,706 @@
+#include "SpatialIndex.h"
+#include "DynamicAABBTree.h"
+#include "HierarchicalGridIndex.h"
+#include "../utils/Logger.h"
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <limits>
+#include <sstream>
+
+namespace KitchenCAD {
+namespace Scene {
+
+namespace {
+
+// Cell coordinates are biased into 21 bits per axis for Morton packing
+constexpr int kCellCoordinateBits = 21;
+constexpr int kCellCoordinateBias = 1 << (kCellCoordinateBits - 1);
+constexpr int kMinCellCoordinate = -kCellCoordinateBias;
+constexpr int kMaxCellCoordinate = kCellCoordinateBias - 1;
+
+constexpr size_t kInitialCellTableSize = 64;
+
+uint64_t spreadBits(uint64_t value) {
+    value &= 0x1fffff;
+    value = (value | (value << 32)) & 0x1f00000000ffffULL;
+    value = (value | (value << 16)) & 0x1f0000ff0000ffULL;
+    value = (value | (value << 8)) & 0x100f00f00f00f00fULL;
+    value = (value | (value << 4)) & 0x10c30c30c30c30c3ULL;
+    value = (value | (value << 2)) & 0x1249249249249249ULL;
+    return value;
+}
+
+uint64_t compactBits(uint64_t value) {
+    value &= 0x1249249249249249ULL;
+    value = (value | (value >> 2)) & 0x10c30c30c30c30c3ULL;
+    value = (value | (value >> 4)) & 0x100f00f00f00f00fULL;
+    value = (value | (value >> 8)) & 0x1f0000ff0000ffULL;
+    value = (value | (value >> 16)) & 0x1f00000000ffffULL;
+    value = (value | (value >> 32)) & 0x1fffff;
+    return value;
+}
+
+} // namespace
+
+// ISpatialIndex factory
+
+std::unique_ptr<ISpatialIndex> ISpatialIndex::create(SpatialIndexType type, double cellSize) {
+    switch (type) {
+        case SpatialIndexType::Grid:
+            return std::make_unique<SpatialIndex>(cellSize);
+        case SpatialIndexType::HashedGrid:
+            return std::make_unique<HashedGridIndex>(cellSize);
+        case SpatialIndexType::AABBTree:
+            return std::make_unique<DynamicAABBTree>();
+        case SpatialIndexType::HierarchicalGrid:
+            return std::make_unique<HierarchicalGridIndex>(cellSize);
+    }
+    
+    return std::make_unique<HashedGridIndex>(cellSize);
+}
+
+// SpatialIndex Implementation
+
+SpatialIndex::SpatialIndex(double cellSize) : cellSize_(cellSize) {
+    if (cellSize <= 0.0) {
+        cellSize_ = 1.0;
+        LOG_WARNING("Invalid cell size provided, using default value of 1.0");
+    }
+}
+
+void SpatialIndex::addObject(ObjectHandle handle, const Geometry::BoundingBox& bounds) {
+    if (bounds.isEmpty()) return;
+    
+    auto cells = getCellsForBounds(bounds);
+    for (const auto& cellKey : cells) {
+        grid_[cellKey].objects.insert(handle);
+    }
+}
+
+void SpatialIndex::removeObject(ObjectHandle handle, const Geometry::BoundingBox& bounds) {
+    if (bounds.isEmpty()) return;
+    
+    auto cells = getCellsForBounds(bounds);
+    for (const auto& cellKey : cells) {
+        auto it = grid_.find(cellKey);
+        if (it != grid_.end()) {
+            it->second.objects.erase(handle);
+            if (it->second.objects.empty()) {
+                grid_.erase(it);
+            }
+        }
+    }
+}
+
+void SpatialIndex::updateObject(ObjectHandle handle, const Geometry::BoundingBox& oldBounds,
+                               const Geometry::BoundingBox& newBounds) {
+    removeObject(handle, oldBounds);
+    addObject(handle, newBounds);
+}
+
+std::vector<ObjectHandle> SpatialIndex::queryRegion(const Geometry::BoundingBox& region) const {
+    std::unordered_set<ObjectHandle, ObjectHandleHash> result;
+    
+    auto cells = getCellsForBounds(region);
+    for (const auto& cellKey : cells) {
+        auto it = grid_.find(cellKey);
+        if (it != grid_.end()) {
+            for (const auto& handle : it->second.objects) {
+                result.insert(handle);
+            }
+        }
+    }
+    
+    return std::vector<ObjectHandle>(result.begin(), result.end());
+}
+
+std::vector<ObjectHandle> SpatialIndex::queryRadius(const Geometry::Point3D& center, double radius) const {
+    Geometry::BoundingBox region(
+        Geometry::Point3D(center.x - radius, center.y - radius, center.z - radius),
+        Geometry::Point3D(center.x + radius, center.y + radius, center.z + radius)
+    );
+    return queryRegion(region);
+}
+
+std::vector<ObjectHandle> SpatialIndex::queryRay(const Geometry::Ray& ray, double maxDistance) const {
+    return collectCells([&](const Geometry::BoundingBox& cellBounds) {
+        double tEnter, tExit;
+        return ray.intersects(cellBounds, tEnter, tExit) && tEnter <= maxDistance;
+    });
+}
+
+std::vector<ObjectHandle> SpatialIndex::queryFrustum(const Geometry::Frustum& frustum) const {
+    return collectCells([&](const Geometry::BoundingBox& cellBounds) { return frustum.intersects(cellBounds); });
+}
+
+std::vector<std::pair<double, ObjectHandle>> SpatialIndex::queryNearest(const Geometry::Point3D&, size_t k,
+                                                                        double maxDistance,
+                                                                        const DistanceFunction& distance) const {
+    // Every object is ranked by the caller's distance, so the query point itself is not needed
+    std::unordered_set<ObjectHandle, ObjectHandleHash> handles;
+    for (const auto& [cellKey, cell] : grid_) {
+        handles.insert(cell.objects.begin(), cell.objects.end());
+    }
+    
+    std::vector<std::pair<double, ObjectHandle>> result;
+    for (const auto& handle : handles) {
+        double objectDistance = distance(handle);
+        if (objectDistance <= maxDistance) {
+            result.emplace_back(objectDistance, handle);
+        }
+    }
+    
+    size_t count = std::min(k, result.size());
+    std::partial_sort(result.begin(), result.begin() + count, result.end());
+    result.resize(count);
+    
+    return result;
+}
+
+void SpatialIndex::clear() {
+    grid_.clear();
+}
+
+std::string SpatialIndex::getCellKey(int x, int y, int z) const {
+    std::ostringstream oss;
+    oss << x << "," << y << "," << z;
+    return oss.str();
+}
+
+template<typename CellTest>
+std::vector<ObjectHandle> SpatialIndex::collectCells(CellTest&& test) const {
+    std::unordered_set<ObjectHandle, ObjectHandleHash> result;
+    
+    for (const auto& [cellKey, cell] : grid_) {
+        int x, y, z;
+        if (std::sscanf(cellKey.c_str(), "%d,%d,%d", &x, &y, &z) != 3) continue;
+        
+        Geometry::BoundingBox cellBounds(Geometry::Point3D(x * cellSize_, y * cellSize_, z * cellSize_),
+                                         Geometry::Point3D((x + 1) * cellSize_, (y + 1) * cellSize_,
+                                                           (z + 1) * cellSize_));
+        if (test(cellBounds)) {
+            result.insert(cell.objects.begin(), cell.objects.end());
+        }
+    }
+    
+    return std::vector<ObjectHandle>(result.begin(), result.end());
+}
+
+std::vector<std::string> SpatialIndex::getCellsForBounds(const Geometry::BoundingBox& bounds) const {
+    std::vector<std::string> cells;
+    
+    if (bounds.isEmpty()) return cells;
+    
+    int minX = static_cast<int>(std::floor(bounds.min.x / cellSize_));
+    int maxX = static_cast<int>(std::floor(bounds.max.x / cellSize_));
+    int minY = static_cast<int>(std::floor(bounds.min.y / cellSize_));
+    int maxY = static_cast<int>(std::floor(bounds.max.y / cellSize_));
+    int minZ = static_cast<int>(std::floor(bounds.min.z / cellSize_));
+    int maxZ = static_cast<int>(std::floor(bounds.max.z / cellSize_));
+    
+    for (int x = minX; x <= maxX; ++x) {
+        for (int y = minY; y <= maxY; ++y) {
+            for (int z = minZ; z <= maxZ; ++z) {
+                cells.push_back(getCellKey(x, y, z));
+            }
+        }
+    }
+    
+    return cells;
+}
+
+// HashedGridIndex Implementation
+
+void HashedGridIndex::CellObjects::add(uint32_t slot) {
+    if (count < kInlineObjects) {
+        inlineSlots[count] = slot;
+    } else {
+        overflow.push_back(slot);
+    }
+    ++count;
+}
+
+bool HashedGridIndex::CellObjects::remove(uint32_t slot) {
+    uint32_t inlineCount = count < kInlineObjects ? count : static_cast<uint32_t>(kInlineObjects);
+    
+    for (uint32_t i = 0; i < inlineCount; ++i) {
+        if (inlineSlots[i] != slot) continue;
+        
+        // Refill the hole from the overflow first so inline storage stays dense
+        if (!overflow.empty()) {
+            inlineSlots[i] = overflow.back();
+            overflow.pop_back();
+        } else {
+            inlineSlots[i] = inlineSlots[inlineCount - 1];
+        }
+        --count;
+        return true;
+    }
+    
+    auto it = std::find(overflow.begin(), overflow.end(), slot);
+    if (it != overflow.end()) {
+        *it = overflow.back();
+        overflow.pop_back();
+        --count;
+        return true;
+    }
+    
+    return false;
+}
+
+HashedGridIndex::HashedGridIndex(double cellSize)
+    : cellSize_(cellSize)
+    , cells_(kInitialCellTableSize)
+    , cellCount_(0)
+    , occupied_{kMaxCellCoordinate, kMaxCellCoordinate, kMaxCellCoordinate,
+                kMinCellCoordinate, kMinCellCoordinate, kMinCellCoordinate} {
+    if (cellSize <= 0.0) {
+        cellSize_ = 1.0;
+        LOG_WARNING("Invalid cell size provided, using default value of 1.0");
+    }
+    inverseCellSize_ = 1.0 / cellSize_;
+}
+
+void HashedGridIndex::addObject(ObjectHandle handle, const Geometry::BoundingBox& bounds) {
+    if (bounds.isEmpty() || !handle.isValid()) return;
+    
+    if (isIndexed(handle)) {
+        return;
+    }
+    if (handleBySlot_.size() <= handle.slot) {
+        handleBySlot_.resize(handle.slot + 1);
+    }
+    handleBySlot_[handle.slot] = handle;
+    
+    CellRange range = getCellRange(bounds);
+    
+    for (int x = range.minX; x <= range.maxX; ++x) {
+        for (int y = range.minY; y <= range.maxY; ++y) {
+            for (int z = range.minZ; z <= range.maxZ; ++z) {
+                insertIntoCell(x, y, z, handle.slot);
+            }
+        }
+    }
+}
+
+void HashedGridIndex::removeObject(ObjectHandle handle, const Geometry::BoundingBox& bounds) {
+    if (bounds.isEmpty() || !isIndexed(handle)) return;
+    
+    CellRange range = getCellRange(bounds);
+    
+    for (int x = range.minX; x <= range.maxX; ++x) {
+        for (int y = range.minY; y <= range.maxY; ++y) {
+            for (int z = range.minZ; z <= range.maxZ; ++z) {
+                removeFromCell(x, y, z, handle.slot);
+            }
+        }
+    }
+    
+    handleBySlot_[handle.slot] = ObjectHandle();
+}
+
+void HashedGridIndex::updateObject(ObjectHandle handle, const Geometry::BoundingBox& oldBounds,
+                                   const Geometry::BoundingBox& newBounds) {
+    if (oldBounds.isEmpty() || newBounds.isEmpty() || !isIndexed(handle)) {
+        removeObject(handle, oldBounds);
+        addObject(handle, newBounds);
+        return;
+    }
+    
+    CellRange oldRange = getCellRange(oldBounds);
+    CellRange newRange = getCellRange(newBounds);
+    if (oldRange == newRange) return;
+    
+    uint32_t slot = handle.slot;
+    
+    // Only touch the cells that differ between the two footprints
+    for (int x = oldRange.minX; x <= oldRange.maxX; ++x) {
+        for (int y = oldRange.minY; y <= oldRange.maxY; ++y) {
+            for (int z = oldRange.minZ; z <= oldRange.maxZ; ++z) {
+                if (!newRange.contains(x, y, z)) {
+                    removeFromCell(x, y, z, slot);
+                }
+            }
+        }
+    }
+    
+    for (int x = newRange.minX; x <= newRange.maxX; ++x) {
+        for (int y = newRange.minY; y <= newRange.maxY; ++y) {
+            for (int z = newRange.minZ; z <= newRange.maxZ; ++z) {
+                if (!oldRange.contains(x, y, z)) {
+                    insertIntoCell(x, y, z, slot);
+                }
+            }
+        }
+    }
+}
+
+std::vector<ObjectHandle> HashedGridIndex::queryRegion(const Geometry::BoundingBox& region) const {
+    if (region.isEmpty() || cellCount_ == 0) return {};
+    
+    return collectRange(getCellRange(region), [](int, int, int) { return true; });
+}
+
+std::vector<ObjectHandle> HashedGridIndex::queryRadius(const Geometry::Point3D& center, double radius) const {
+    Geometry::BoundingBox region(
+        Geometry::Point3D(center.x - radius, center.y - radius, center.z - radius),
+        Geometry::Point3D(center.x + radius, center.y + radius, center.z + radius)
+    );
+    return queryRegion(region);
+}
+
+std::vector<ObjectHandle> HashedGridIndex::queryRay(const Geometry::Ray& ray, double maxDistance) const {
+    if (cellCount_ == 0 || !(maxDistance >= 0.0)) return {};
+    
+    // Clip to the occupied cells so even an unbounded ray walks a finite path
+    Geometry::BoundingBox occupiedBounds(getCellBounds(occupied_.minX, occupied_.minY, occupied_.minZ).min,
+                                         getCellBounds(occupied_.maxX, occupied_.maxY, occupied_.maxZ).max);
+    double tEnter, tExit;
+    if (!ray.intersects(occupiedBounds, tEnter, tExit) || tEnter > maxDistance) return {};
+    tExit = std::min(tExit, maxDistance);
+    
+    Geometry::Point3D start = ray.pointAt(tEnter);
+    const int minCell[3] = {occupied_.minX, occupied_.minY, occupied_.minZ};
+    const int maxCell[3] = {occupied_.maxX, occupied_.maxY, occupied_.maxZ};
+    
+    int cell[3];
+    int step[3];
+    double tNext[3];
+    double tDelta[3];
+    for (int axis = 0; axis < 3; ++axis) {
+        // Rounding at the entry face can land one cell outside the occupied range
+        cell[axis] = std::clamp(toCellCoordinate(start[axis]), minCell[axis], maxCell[axis]);
+        
+        double direction = ray.direction[axis];
+        if (direction > 0.0) {
+            step[axis] = 1;
+            tNext[axis] = tEnter + ((cell[axis] + 1) * cellSize_ - start[axis]) / direction;
+            tDelta[axis] = cellSize_ / direction;
+        } else if (direction < 0.0) {
+            step[axis] = -1;
+            tNext[axis] = tEnter + (cell[axis] * cellSize_ - start[axis]) / direction;
+            tDelta[axis] = -cellSize_ / direction;
+        } else {
+            step[axis] = 0;
+            tNext[axis] = std::numeric_limits<double>::infinity();
+            tDelta[axis] = std::numeric_limits<double>::infinity();
+        }
+    }
+    
+    std::vector<uint32_t> slots;
+    
+    // Amanatides-Woo traversal: always step across the nearest cell boundary
+    while (true) {
+        size_t index = findCell(encodeCellKey(cell[0], cell[1], cell[2]));
+        if (index != cells_.size()) {
+            cells_[index].objects.forEach([&](uint32_t slot) { slots.push_back(slot); });
+        }
+        
+        int axis = tNext[0] < tNext[1] ? (tNext[0] < tNext[2] ? 0 : 2) : (tNext[1] < tNext[2] ? 1 : 2);
+        if (tNext[axis] > tExit) break;
+        
+        cell[axis] += step[axis];
+        if (cell[axis] < minCell[axis] || cell[axis] > maxCell[axis]) break;
+        tNext[axis] += tDelta[axis];
+    }
+    
+    return toHandles(slots);
+}
+
+std::vector<ObjectHandle> HashedGridIndex::queryFrustum(const Geometry::Frustum& frustum) const {
+    if (cellCount_ == 0) return {};
+    
+    CellRange range = getCellRange(frustum.bounds());
+    range.minX = std::max(range.minX, occupied_.minX);
+    range.minY = std::max(range.minY, occupied_.minY);
+    range.minZ = std::max(range.minZ, occupied_.minZ);
+    range.maxX = std::min(range.maxX, occupied_.maxX);
+    range.maxY = std::min(range.maxY, occupied_.maxY);
+    range.maxZ = std::min(range.maxZ, occupied_.maxZ);
+    if (range.minX > range.maxX || range.minY > range.maxY || range.minZ > range.maxZ) return {};
+    
+    return collectRange(range, [&](int x, int y, int z) {
+        return frustum.intersects(getCellBounds(x, y, z));
+    });
+}
+
+std::vector<std::pair<double, ObjectHandle>> HashedGridIndex::queryNearest(const Geometry::Point3D& point, size_t k,
+                                                                           double maxDistance,
+                                                                           const DistanceFunction& distance) const {
+    // Max-heap of the best k so far, so the current k-th distance is at the front
+    std::vector<std::pair<double, ObjectHandle>> nearest;
+    if (k == 0 || cellCount_ == 0 || !(maxDistance >= 0.0)) return nearest;
+    
+    const int center[3] = {toCellCoordinate(point.x), toCellCoordinate(point.y), toCellCoordinate(point.z)};
+    const int minCell[3] = {occupied_.minX, occupied_.minY, occupied_.minZ};
+    const int maxCell[3] = {occupied_.maxX, occupied_.maxY, occupied_.maxZ};
+    
+    // Objects spanning several cells are measured once
+    std::vector<bool> measured(handleBySlot_.size(), false);
+    
+    auto measure = [&](uint32_t slot) {
+        if (measured[slot]) return;
+        measured[slot] = true;
+        
+        ObjectHandle handle = handleBySlot_[slot];
+        double objectDistance = distance(handle);
+        if (objectDistance > maxDistance) return;
+        
+        if (nearest.size() < k) {
+            nearest.emplace_back(objectDistance, handle);
+            std::push_heap(nearest.begin(), nearest.end());
+        } else if (objectDistance < nearest.front().first) {
+            std::pop_heap(nearest.begin(), nearest.end());
+            nearest.back() = {objectDistance, handle};
+            std::push_heap(nearest.begin(), nearest.end());
+        }
+    };
+    
+    // Rings closer than the occupied cells are empty, so start at the first that can hold objects
+    int firstRing = 0;
+    for (int axis = 0; axis < 3; ++axis) {
+        firstRing = std::max({firstRing, minCell[axis] - center[axis], center[axis] - maxCell[axis]});
+    }
+    
+    for (int ring = firstRing; ; ++ring) {
+        int lo[3];
+        int hi[3];
+        bool coversOccupied = true;
+        for (int axis = 0; axis < 3; ++axis) {
+            lo[axis] = std::max(center[axis] - ring, minCell[axis]);
+            hi[axis] = std::min(center[axis] + ring, maxCell[axis]);
+            coversOccupied = coversOccupied && lo[axis] == minCell[axis] && hi[axis] == maxCell[axis];
+        }
+        
+        // Visit the shell of cells at Chebyshev distance `ring` from the centre cell
+        for (int x = lo[0]; x <= hi[0]; ++x) {
+            for (int y = lo[1]; y <= hi[1]; ++y) {
+                bool onShell = std::abs(x - center[0]) == ring || std::abs(y - center[1]) == ring;
+                for (int z = lo[2]; z <= hi[2]; ++z) {
+                    if (!onShell && std::abs(z - center[2]) != ring) {
+                        // Interior of the column was visited by earlier rings: jump to the far face
+                        z = std::max(z, center[2] + ring - 1);
+                        continue;
+                    }
+                    
+                    size_t index = findCell(encodeCellKey(x, y, z));
+                    if (index != cells_.size()) {
+                        cells_[index].objects.forEach(measure);
+                    }
+                }
+            }
+        }
+        
+        if (coversOccupied) break;
+        
+        // Every unvisited cell lies outside the cube of rings searched so far
+        double reach = std::numeric_limits<double>::infinity();
+        for (int axis = 0; axis < 3; ++axis) {
+            reach = std::min({reach, point[axis] - (center[axis] - ring) * cellSize_,
+                              (center[axis] + ring + 1) * cellSize_ - point[axis]});
+        }
+        
+        double bound = nearest.size() == k ? nearest.front().first : maxDistance;
+        if (reach > bound) break;
+    }
+    
+    std::sort_heap(nearest.begin(), nearest.end());
+    return nearest;
+}
+
+void HashedGridIndex::clear() {
+    cells_.assign(kInitialCellTableSize, Cell());
+    cellCount_ = 0;
+    occupied_ = CellRange{kMaxCellCoordinate, kMaxCellCoordinate, kMaxCellCoordinate,
+                          kMinCellCoordinate, kMinCellCoordinate, kMinCellCoordinate};
+    handleBySlot_.clear();
+}
+
+uint64_t HashedGridIndex::encodeCellKey(int x, int y, int z) {
+    uint64_t ux = static_cast<uint64_t>(x + kCellCoordinateBias);
+    uint64_t uy = static_cast<uint64_t>(y + kCellCoordinateBias);
+    uint64_t uz = static_cast<uint64_t>(z + kCellCoordinateBias);
+    
+    return spreadBits(ux) | (spreadBits(uy) << 1) | (spreadBits(uz) << 2);
+}
+
+void HashedGridIndex::decodeCellKey(uint64_t key, int& x, int& y, int& z) {
+    x = static_cast<int>(compactBits(key)) - kCellCoordinateBias;
+    y = static_cast<int>(compactBits(key >> 1)) - kCellCoordinateBias;
+    z = static_cast<int>(compactBits(key >> 2)) - kCellCoordinateBias;
+}
+
+HashedGridIndex::CellRange HashedGridIndex::getCellRange(const Geometry::BoundingBox& bounds) const {
+    return CellRange{
+        toCellCoordinate(bounds.min.x), toCellCoordinate(bounds.min.y), toCellCoordinate(bounds.min.z),
+        toCellCoordinate(bounds.max.x), toCellCoordinate(bounds.max.y), toCellCoordinate(bounds.max.z)
+    };
+}
+
+int HashedGridIndex::toCellCoordinate(double value) const {
+    double cell = std::floor(value * inverseCellSize_);
+    
+    // Clamp into the packable range; far-away cells simply share boundary keys
+    if (!(cell >= kMinCellCoordinate)) return kMinCellCoordinate;
+    if (cell > kMaxCellCoordinate) return kMaxCellCoordinate;
+    return static_cast<int>(cell);
+}
+
+Geometry::BoundingBox HashedGridIndex::getCellBounds(int x, int y, int z) const {
+    return Geometry::BoundingBox(Geometry::Point3D(x * cellSize_, y * cellSize_, z * cellSize_),
+                                 Geometry::Point3D((x + 1) * cellSize_, (y + 1) * cellSize_, (z + 1) * cellSize_));
+}
+
+size_t HashedGridIndex::bucketFor(uint64_t key) const {
+    // Fibonacci hashing spreads neighbouring Morton codes across the table
+    uint64_t hash = key * 0x9E3779B97F4A7C15ULL;
+    return static_cast<size_t>(hash >> 32) & (cells_.size() - 1);
+}
+
+size_t HashedGridIndex::findCell(uint64_t key) const {
+    size_t mask = cells_.size() - 1;
+    
+    for (size_t index = bucketFor(key); ; index = (index + 1) & mask) {
+        const Cell& cell = cells_[index];
+        if (cell.key == key) return index;
+        if (cell.key == kEmptyKey) return cells_.size();
+    }
+}
+
+HashedGridIndex::Cell& HashedGridIndex::findOrInsertCell(uint64_t key) {
+    // Keep the load factor below 0.7 so probe sequences stay short
+    if ((cellCount_ + 1) * 10 > cells_.size() * 7) {
+        grow();
+    }
+    
+    size_t mask = cells_.size() - 1;
+    size_t index = bucketFor(key);
+    
+    while (cells_[index].key != kEmptyKey && cells_[index].key != key) {
+        index = (index + 1) & mask;
+    }
+    
+    Cell& cell = cells_[index];
+    if (cell.key == kEmptyKey) {
+        cell.key = key;
+        ++cellCount_;
+    }
+    
+    return cell;
+}
+
+void HashedGridIndex::eraseCell(size_t index) {
+    size_t mask = cells_.size() - 1;
+    
+    // Backward-shift deletion keeps probe chains intact without tombstones
+    size_t hole = index;
+    size_t next = (hole + 1) & mask;
+    
+    while (cells_[next].key != kEmptyKey) {
+        size_t home = bucketFor(cells_[next].key);
+        size_t distanceFromHome = (next - home) & mask;
+        size_t distanceToHole = (next - hole) & mask;
+        
+        if (distanceFromHome >= distanceToHole) {
+            cells_[hole] = std::move(cells_[next]);
+            hole = next;
+        }
+        next = (next + 1) & mask;
+    }
+    
+    cells_[hole] = Cell();
+    --cellCount_;
+}
+
+void HashedGridIndex::grow() {
+    std::vector<Cell> oldCells(cells_.size() * 2);
+    oldCells.swap(cells_);
+    
+    size_t mask = cells_.size() - 1;
+    for (auto& cell : oldCells) {
+        if (cell.key == kEmptyKey) continue;
+        
+        size_t index = bucketFor(cell.key);
+        while (cells_[index].key != kEmptyKey) {
+            index = (index + 1) & mask;
+        }
+        cells_[index] = std::move(cell);
+    }
+}
+
+void HashedGridIndex::insertIntoCell(int x, int y, int z, uint32_t slot) {
+    findOrInsertCell(encodeCellKey(x, y, z)).objects.add(slot);
+    
+    occupied_.minX = std::min(occupied_.minX, x);
+    occupied_.minY = std::min(occupied_.minY, y);
+    occupied_.minZ = std::min(occupied_.minZ, z);
+    occupied_.maxX = std::max(occupied_.maxX, x);
+    occupied_.maxY = std::max(occupied_.maxY, y);
+    occupied_.maxZ = std::max(occupied_.maxZ, z);
+}
+
+void HashedGridIndex::removeFromCell(int x, int y, int z, uint32_t slot) {
+    size_t index = findCell(encodeCellKey(x, y, z));
+    if (index == cells_.size()) return;
+    
+    Cell& cell = cells_[index];
+    if (cell.objects.remove(slot) && cell.objects.empty()) {
+        eraseCell(index);
+    }
+}
+
+bool HashedGridIndex::isIndexed(ObjectHandle handle) const {
+    return handle.isValid() && handle.slot < handleBySlot_.size() && handleBySlot_[handle.slot] == handle;
+}
+
+template<typename CellTest>
+std::vector<ObjectHandle> HashedGridIndex::collectRange(const CellRange& range, CellTest&& test) const {
+    std::vector<uint32_t> slots;
+    
+    auto collectCell = [&](const Cell& cell) {
+        cell.objects.forEach([&](uint32_t slot) { slots.push_back(slot); });
+    };
+    
+    if (range.cellCount() > cells_.size()) {
+        // Region spans more cells than the table holds: scan occupied cells instead
+        for (const auto& cell : cells_) {
+            if (cell.key == kEmptyKey) continue;
+            
+            int x, y, z;
+            decodeCellKey(cell.key, x, y, z);
+            if (range.contains(x, y, z) && test(x, y, z)) {
+                collectCell(cell);
+            }
+        }
+    } else {
+        for (int x = range.minX; x <= range.maxX; ++x) {
+            for (int y = range.minY; y <= range.maxY; ++y) {
+                for (int z = range.minZ; z <= range.maxZ; ++z) {
+                    size_t index = findCell(encodeCellKey(x, y, z));
+                    if (index != cells_.size() && test(x, y, z)) {
+                        collectCell(cells_[index]);
+                    }
+                }
+            }
+        }
+    }
+    
+    return toHandles(slots);
+}
+
+std::vector<ObjectHandle> HashedGridIndex::toHandles(std::vector<uint32_t>& slots) const {
+    std::sort(slots.begin(), slots.end());
+    slots.erase(std::unique(slots.begin(), slots.end()), slots.end());
+    
+    std::vector<ObjectHandle> result;
+    result.reserve(slots.size());
+    for (uint32_t slot : slots) {
+        result.push_back(handleBySlot_[slot]);
+    }
+    
+    return result;
+}
+
+} // namespace Scene
+} // namespace KitchenCAD
\ No newline at end of file
@@ -0,0 +1,268 @@
+#pragma once
+
+#include "../interfaces/ISceneManager.h"
+#include "../geometry/Geometry.h"
+#include "ObjectHandle.h"
+#include <array>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+#include <utility>
+#include <vector>
+
+namespace KitchenCAD {
+namespace Scene {
+
+/**
+ * @brief Available spatial index backends
+ */
+enum class SpatialIndexType {
+    Grid,           // String-keyed uniform grid
+    HashedGrid,     // Uniform grid with packed integer cell keys
+    AABBTree,       // Dynamic bounding volume hierarchy
+    HierarchicalGrid // Hashed grids at several cell sizes, one level per object
+};
+
+/**
+ * @brief Common interface for spatial index backends
+ * 
+ * The index only answers broadphase questions: results are candidates whose
+ * indexed bounds may overlap the query, and callers refine them against the
+ * exact object bounds. Objects are keyed by handle; backends may use the
+ * handle slot as a dense array index.
+ */
+class ISpatialIndex {
+public:
+    /**
+     * @brief Exact distance from the query point to an object
+     * 
+     * Must be at least the distance to the object's indexed bounds.
+     */
+    using DistanceFunction = std::function<double(ObjectHandle)>;
+    
+    virtual ~ISpatialIndex() = default;
+    
+    virtual void addObject(ObjectHandle handle, const Geometry::BoundingBox& bounds) = 0;
+    virtual void removeObject(ObjectHandle handle, const Geometry::BoundingBox& bounds) = 0;
+    virtual void updateObject(ObjectHandle handle, const Geometry::BoundingBox& oldBounds,
+                              const Geometry::BoundingBox& newBounds) = 0;
+    
+    virtual std::vector<ObjectHandle> queryRegion(const Geometry::BoundingBox& region) const = 0;
+    virtual std::vector<ObjectHandle> queryRadius(const Geometry::Point3D& center, double radius) const = 0;
+    
+    /**
+     * @brief Candidates whose indexed bounds the ray may hit within maxDistance
+     */
+    virtual std::vector<ObjectHandle> queryRay(const Geometry::Ray& ray, double maxDistance) const = 0;
+    
+    /**
+     * @brief Candidates whose indexed bounds may lie inside the frustum
+     */
+    virtual std::vector<ObjectHandle> queryFrustum(const Geometry::Frustum& frustum) const = 0;
+    
+    /**
+     * @brief Up to k (distance, handle) pairs nearest to a point within maxDistance, nearest first
+     * 
+     * Unlike the other queries this result is exact: indexed bounds only
+     * order and prune the search, and distances come from the distance function.
+     */
+    virtual std::vector<std::pair<double, ObjectHandle>> queryNearest(const Geometry::Point3D& point, size_t k,
+                                                                      double maxDistance,
+                                                                      const DistanceFunction& distance) const = 0;
+    
+    virtual void clear() = 0;
+    
+    virtual SpatialIndexType getType() const = 0;
+    
+    /**
+     * @brief Create a spatial index backend of the given type
+     */
+    static std::unique_ptr<ISpatialIndex> create(SpatialIndexType type, double cellSize = 1.0);
+};
+
+/**
+ * @brief Spatial index for efficient spatial queries
+ * 
+ * Simple spatial partitioning system for fast collision detection
+ * and spatial queries. Uses a grid-based approach for simplicity.
+ */
+class SpatialIndex : public ISpatialIndex {
+private:
+    struct GridCell {
+        std::unordered_set<ObjectHandle, ObjectHandleHash> objects;
+    };
+    
+    double cellSize_;
+    std::unordered_map<std::string, GridCell> grid_;
+
+public:
+    explicit SpatialIndex(double cellSize = 1.0);
+    
+    void addObject(ObjectHandle handle, const Geometry::BoundingBox& bounds) override;
+    void removeObject(ObjectHandle handle, const Geometry::BoundingBox& bounds) override;
+    void updateObject(ObjectHandle handle, const Geometry::BoundingBox& oldBounds,
+                      const Geometry::BoundingBox& newBounds) override;
+    
+    std::vector<ObjectHandle> queryRegion(const Geometry::BoundingBox& region) const override;
+    std::vector<ObjectHandle> queryRadius(const Geometry::Point3D& center, double radius) const override;
+    std::vector<ObjectHandle> queryRay(const Geometry::Ray& ray, double maxDistance) const override;
+    std::vector<ObjectHandle> queryFrustum(const Geometry::Frustum& frustum) const override;
+    
+    /**
+     * @brief Measures every indexed object; the string keys cannot be searched outward cheaply
+     */
+    std::vector<std::pair<double, ObjectHandle>> queryNearest(const Geometry::Point3D& point, size_t k,
+                                                              double maxDistance,
+                                                              const DistanceFunction& distance) const override;
+    
+    void clear() override;
+    
+    SpatialIndexType getType() const override { return SpatialIndexType::Grid; }
+
+private:
+    std::string getCellKey(int x, int y, int z) const;
+    std::vector<std::string> getCellsForBounds(const Geometry::BoundingBox& bounds) const;
+    
+    /**
+     * @brief Collect objects from every stored cell whose box passes the test
+     */
+    template<typename CellTest>
+    std::vector<ObjectHandle> collectCells(CellTest&& test) const;
+};
+
+/**
+ * @brief Uniform grid keyed by packed 64-bit Morton cell codes
+ * 
+ * Cells live in an open-addressing hash table (linear probing with
+ * backward-shift deletion) and hold small inline arrays of handle slots,
+ * so add/update/query never allocate per touched cell.
+ * Updates only touch the cells that differ between the old and new bounds.
+ */
+class HashedGridIndex : public ISpatialIndex {
+public:
+    explicit HashedGridIndex(double cellSize = 1.0);
+    
+    void addObject(ObjectHandle handle, const Geometry::BoundingBox& bounds) override;
+    void removeObject(ObjectHandle handle, const Geometry::BoundingBox& bounds) override;
+    void updateObject(ObjectHandle handle, const Geometry::BoundingBox& oldBounds,
+                      const Geometry::BoundingBox& newBounds) override;
+    
+    std::vector<ObjectHandle> queryRegion(const Geometry::BoundingBox& region) const override;
+    std::vector<ObjectHandle> queryRadius(const Geometry::Point3D& center, double radius) const override;
+    
+    /**
+     * @brief Walk the cells along the ray with a 3D DDA, clipped to the occupied cells
+     */
+    std::vector<ObjectHandle> queryRay(const Geometry::Ray& ray, double maxDistance) const override;
+    std::vector<ObjectHandle> queryFrustum(const Geometry::Frustum& frustum) const override;
+    
+    /**
+     * @brief Search rings of cells outward from the point until no closer object can remain
+     */
+    std::vector<std::pair<double, ObjectHandle>> queryNearest(const Geometry::Point3D& point, size_t k,
+                                                              double maxDistance,
+                                                              const DistanceFunction& distance) const override;
+    
+    void clear() override;
+    
+    SpatialIndexType getType() const override { return SpatialIndexType::HashedGrid; }
+    
+    /**
+     * @brief Number of non-empty cells currently stored
+     */
+    size_t getCellCount() const { return cellCount_; }
+    
+    /**
+     * @brief Pack integer cell coordinates into a 63-bit Morton code
+     */
+    static uint64_t encodeCellKey(int x, int y, int z);
+    
+    /**
+     * @brief Unpack a Morton code produced by encodeCellKey
+     */
+    static void decodeCellKey(uint64_t key, int& x, int& y, int& z);
+
+private:
+    static constexpr size_t kInlineObjects = 4;
+    static constexpr uint64_t kEmptyKey = ~uint64_t(0);
+    
+    /**
+     * @brief Object slots in a cell; spills to the heap past kInlineObjects
+     */
+    struct CellObjects {
+        std::array<uint32_t, kInlineObjects> inlineSlots{};
+        uint32_t count = 0;
+        std::vector<uint32_t> overflow;
+        
+        void add(uint32_t slot);
+        bool remove(uint32_t slot);
+        bool empty() const { return count == 0; }
+        
+        template<typename Fn>
+        void forEach(Fn&& fn) const {
+            uint32_t inlineCount = count < kInlineObjects ? count : static_cast<uint32_t>(kInlineObjects);
+            for (uint32_t i = 0; i < inlineCount; ++i) fn(inlineSlots[i]);
+            for (uint32_t slot : overflow) fn(slot);
+        }
+    };
+    
+    struct Cell {
+        uint64_t key = kEmptyKey;
+        CellObjects objects;
+    };
+    
+    struct CellRange {
+        int minX, minY, minZ;
+        int maxX, maxY, maxZ;
+        
+        size_t cellCount() const {
+            return static_cast<size_t>(maxX - minX + 1) * static_cast<size_t>(maxY - minY + 1) *
+                   static_cast<size_t>(maxZ - minZ + 1);
+        }
+        
+        bool contains(int x, int y, int z) const {
+            return x >= minX && x <= maxX && y >= minY && y <= maxY && z >= minZ && z <= maxZ;
+        }
+        
+        bool operator==(const CellRange& other) const {
+            return minX == other.minX && minY == other.minY && minZ == other.minZ &&
+                   maxX == other.maxX && maxY == other.maxY && maxZ == other.maxZ;
+        }
+    };
+    
+    double cellSize_;
+    double inverseCellSize_;
+    std::vector<Cell> cells_;           // Open-addressing table, power-of-two size
+    size_t cellCount_;
+    
+    // Cell range ever occupied since the last clear; bounds ray traversal
+    CellRange occupied_;
+    
+    // Cells store handle slots; the full handle is kept per slot for results
+    std::vector<ObjectHandle> handleBySlot_;
+    
+    CellRange getCellRange(const Geometry::BoundingBox& bounds) const;
+    int toCellCoordinate(double value) const;
+    Geometry::BoundingBox getCellBounds(int x, int y, int z) const;
+    
+    size_t findCell(uint64_t key) const;
+    Cell& findOrInsertCell(uint64_t key);
+    void eraseCell(size_t index);
+    void grow();
+    size_t bucketFor(uint64_t key) const;
+    
+    void insertIntoCell(int x, int y, int z, uint32_t slot);
+    void removeFromCell(int x, int y, int z, uint32_t slot);
+    
+    bool isIndexed(ObjectHandle handle) const;
+    
+    template<typename CellTest>
+    std::vector<ObjectHandle> collectRange(const CellRange& range, CellTest&& test) const;
+    std::vector<ObjectHandle> toHandles(std::vector<uint32_t>& slots) const;
+};
+
+} // namespace Scene
+} // namespace KitchenCAD
\ No newline at end of file
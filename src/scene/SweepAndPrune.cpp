@@ -0,0 +1,288 @@
+#include "SweepAndPrune.h"
+#include <algorithm>
+
+namespace KitchenCAD {
+namespace Scene {
+
+namespace {
+
+// Few pending changes are merged with insertion sort, many with a full sort
+constexpr size_t kInsertionSortRatio = 32;
+
+// Compact once dead endpoints make up a sizeable share of the lists
+constexpr size_t kMinDeadBeforeCompaction = 32;
+
+} // namespace
+
+SweepAndPrune::SweepAndPrune()
+    : objectCount_(0)
+    , pendingChanges_(0)
+    , sorted_(true) {
+}
+
+void SweepAndPrune::addObject(ObjectHandle handle, const Geometry::BoundingBox& bounds) {
+    if (findProxy(handle) != kNoProxy) {
+        updateObject(handle, bounds);
+        return;
+    }
+    
+    if (bounds.isEmpty() || !handle.isValid()) return;
+    
+    uint32_t index;
+    if (!freeProxies_.empty()) {
+        index = freeProxies_.back();
+        freeProxies_.pop_back();
+    } else {
+        index = static_cast<uint32_t>(proxies_.size());
+        proxies_.emplace_back();
+        positions_.emplace_back();
+    }
+    
+    Proxy& proxy = proxies_[index];
+    proxy.handle = handle;
+    proxy.bounds = bounds;
+    proxy.alive = true;
+    
+    if (proxyBySlot_.size() <= handle.slot) {
+        proxyBySlot_.resize(handle.slot + 1, kNoProxy);
+    }
+    proxyBySlot_[handle.slot] = index;
+    ++objectCount_;
+    
+    for (int axis = 0; axis < 3; ++axis) {
+        auto& list = axes_[axis];
+        positions_[index][axis][0] = static_cast<uint32_t>(list.size());
+        list.push_back({bounds.min[axis], index, 0});
+        positions_[index][axis][1] = static_cast<uint32_t>(list.size());
+        list.push_back({bounds.max[axis], index, 1});
+    }
+    
+    ++pendingChanges_;
+    sorted_ = false;
+}
+
+void SweepAndPrune::removeObject(ObjectHandle handle) {
+    uint32_t index = findProxy(handle);
+    if (index == kNoProxy) return;
+    
+    proxies_[index].alive = false;
+    deadProxies_.push_back(index);
+    proxyBySlot_[handle.slot] = kNoProxy;
+    --objectCount_;
+    
+    if (deadProxies_.size() > kMinDeadBeforeCompaction && deadProxies_.size() * 4 > objectCount_) {
+        compact();
+    }
+}
+
+void SweepAndPrune::updateObject(ObjectHandle handle, const Geometry::BoundingBox& bounds) {
+    uint32_t index = findProxy(handle);
+    if (index == kNoProxy) {
+        addObject(handle, bounds);
+        return;
+    }
+    
+    if (bounds.isEmpty()) {
+        removeObject(handle);
+        return;
+    }
+    
+    proxies_[index].bounds = bounds;
+    
+    for (int axis = 0; axis < 3; ++axis) {
+        // Update and re-sort one endpoint at a time so each sift sees a sorted list
+        uint32_t minPosition = positions_[index][axis][0];
+        axes_[axis][minPosition].value = bounds.min[axis];
+        if (sorted_) siftEndpoint(axis, minPosition);
+        
+        uint32_t maxPosition = positions_[index][axis][1];
+        axes_[axis][maxPosition].value = bounds.max[axis];
+        if (sorted_) siftEndpoint(axis, maxPosition);
+    }
+    
+    if (!sorted_) {
+        ++pendingChanges_;
+    }
+}
+
+void SweepAndPrune::clear() {
+    proxies_.clear();
+    proxyBySlot_.clear();
+    objectCount_ = 0;
+    freeProxies_.clear();
+    deadProxies_.clear();
+    positions_.clear();
+    for (auto& list : axes_) {
+        list.clear();
+    }
+    pendingChanges_ = 0;
+    sorted_ = true;
+}
+
+void SweepAndPrune::forEachOverlappingPair(const PairCallback& callback) const {
+    sweep([&](uint32_t a, uint32_t b) {
+        callback(proxies_[a].handle, proxies_[b].handle);
+    });
+}
+
+std::vector<std::pair<ObjectHandle, ObjectHandle>> SweepAndPrune::findOverlappingPairs() const {
+    std::vector<std::pair<ObjectHandle, ObjectHandle>> pairs;
+    
+    sweep([&](uint32_t a, uint32_t b) {
+        pairs.emplace_back(proxies_[a].handle, proxies_[b].handle);
+    });
+    
+    return pairs;
+}
+
+size_t SweepAndPrune::countOverlappingPairs() const {
+    size_t count = 0;
+    
+    sweep([&](uint32_t, uint32_t) { ++count; });
+    
+    return count;
+}
+
+uint32_t SweepAndPrune::findProxy(ObjectHandle handle) const {
+    if (!handle.isValid() || handle.slot >= proxyBySlot_.size()) {
+        return kNoProxy;
+    }
+    
+    uint32_t index = proxyBySlot_[handle.slot];
+    return (index != kNoProxy && proxies_[index].handle == handle) ? index : kNoProxy;
+}
+
+void SweepAndPrune::ensureSorted() const {
+    if (sorted_) return;
+    
+    for (int axis = 0; axis < 3; ++axis) {
+        auto& list = axes_[axis];
+        
+        if (pendingChanges_ * kInsertionSortRatio < list.size()) {
+            // Nearly sorted: insertion sort is O(n + inversions)
+            for (size_t i = 1; i < list.size(); ++i) {
+                Endpoint endpoint = list[i];
+                size_t j = i;
+                while (j > 0 && endpoint < list[j - 1]) {
+                    list[j] = list[j - 1];
+                    --j;
+                }
+                list[j] = endpoint;
+            }
+        } else {
+            std::sort(list.begin(), list.end());
+        }
+        
+        rebuildPositions(axis);
+    }
+    
+    pendingChanges_ = 0;
+    sorted_ = true;
+}
+
+void SweepAndPrune::rebuildPositions(int axis) const {
+    const auto& list = axes_[axis];
+    
+    for (uint32_t position = 0; position < list.size(); ++position) {
+        positions_[list[position].proxy][axis][list[position].isMax] = position;
+    }
+}
+
+void SweepAndPrune::compact() {
+    for (int axis = 0; axis < 3; ++axis) {
+        auto& list = axes_[axis];
+        list.erase(std::remove_if(list.begin(), list.end(),
+                                  [&](const Endpoint& endpoint) { return !proxies_[endpoint.proxy].alive; }),
+                   list.end());
+        rebuildPositions(axis);
+    }
+    
+    for (uint32_t index : deadProxies_) {
+        proxies_[index] = Proxy();
+        freeProxies_.push_back(index);
+    }
+    deadProxies_.clear();
+}
+
+void SweepAndPrune::siftEndpoint(int axis, uint32_t position) {
+    auto& list = axes_[axis];
+    Endpoint endpoint = list[position];
+    
+    while (position > 0 && endpoint < list[position - 1]) {
+        list[position] = list[position - 1];
+        positions_[list[position].proxy][axis][list[position].isMax] = position;
+        --position;
+    }
+    
+    while (position + 1 < list.size() && list[position + 1] < endpoint) {
+        list[position] = list[position + 1];
+        positions_[list[position].proxy][axis][list[position].isMax] = position;
+        ++position;
+    }
+    
+    list[position] = endpoint;
+    positions_[endpoint.proxy][axis][endpoint.isMax] = position;
+}
+
+bool SweepAndPrune::overlapsOnOtherAxes(const Geometry::BoundingBox& a, const Geometry::BoundingBox& b,
+                                        int sweepAxis) const {
+    for (int axis = 0; axis < 3; ++axis) {
+        if (axis == sweepAxis) continue;
+        if (a.max[axis] < b.min[axis] || a.min[axis] > b.max[axis]) {
+            return false;
+        }
+    }
+    return true;
+}
+
+int SweepAndPrune::chooseSweepAxis() const {
+    // The axis along which the scene is most spread out has the fewest false overlaps
+    int bestAxis = 0;
+    double bestSpread = -1.0;
+    
+    for (int axis = 0; axis < 3; ++axis) {
+        const auto& list = axes_[axis];
+        if (list.empty()) continue;
+        
+        double spread = list.back().value - list.front().value;
+        if (spread > bestSpread) {
+            bestSpread = spread;
+            bestAxis = axis;
+        }
+    }
+    
+    return bestAxis;
+}
+
+template<typename Fn>
+void SweepAndPrune::sweep(Fn&& fn) const {
+    ensureSorted();
+    
+    int axis = chooseSweepAxis();
+    std::vector<uint32_t> active;
+    std::vector<uint32_t> activeSlot(proxies_.size());
+    
+    for (const auto& endpoint : axes_[axis]) {
+        const Proxy& proxy = proxies_[endpoint.proxy];
+        if (!proxy.alive) continue;
+        
+        if (!endpoint.isMax) {
+            for (uint32_t other : active) {
+                if (overlapsOnOtherAxes(proxies_[other].bounds, proxy.bounds, axis)) {
+                    fn(other, endpoint.proxy);
+                }
+            }
+            activeSlot[endpoint.proxy] = static_cast<uint32_t>(active.size());
+            active.push_back(endpoint.proxy);
+        } else {
+            uint32_t slot = activeSlot[endpoint.proxy];
+            uint32_t last = active.back();
+            active[slot] = last;
+            activeSlot[last] = slot;
+            active.pop_back();
+        }
+    }
+}
+
+} // namespace Scene
+} // namespace KitchenCAD
\ No newline at end of file
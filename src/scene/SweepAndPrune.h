@@ -0,0 +1,108 @@
+#pragma once
+
+#include "../geometry/BoundingBox.h"
+#include "ObjectHandle.h"
+#include <array>
+#include <cstdint>
+#include <functional>
+#include <utility>
+#include <vector>
+
+namespace KitchenCAD {
+namespace Scene {
+
+/**
+ * @brief Persistent sweep-and-prune broadphase for all-pairs overlap queries
+ * 
+ * Keeps the min/max endpoints of every box sorted along each axis. Moving
+ * an object re-sorts only its own endpoints with insertion sort, which is
+ * close to O(1) for the small per-frame moves of interactive editing.
+ * Reporting all overlapping pairs sweeps the axis with the widest spread
+ * and is O(n + k) instead of O(n^2).
+ * 
+ * Bulk insertions and removals are deferred and folded into a single sort
+ * or compaction on the next query. Not thread-safe; callers synchronise.
+ */
+class SweepAndPrune {
+public:
+    using PairCallback = std::function<void(ObjectHandle, ObjectHandle)>;
+    
+    SweepAndPrune();
+    
+    void addObject(ObjectHandle handle, const Geometry::BoundingBox& bounds);
+    void removeObject(ObjectHandle handle);
+    void updateObject(ObjectHandle handle, const Geometry::BoundingBox& bounds);
+    void clear();
+    
+    /**
+     * @brief Invoke callback once for every pair of overlapping boxes
+     * 
+     * Boxes that merely touch count as overlapping, matching
+     * BoundingBox::intersects.
+     */
+    void forEachOverlappingPair(const PairCallback& callback) const;
+    
+    /**
+     * @brief All overlapping pairs
+     */
+    std::vector<std::pair<ObjectHandle, ObjectHandle>> findOverlappingPairs() const;
+    
+    /**
+     * @brief Number of overlapping pairs
+     */
+    size_t countOverlappingPairs() const;
+    
+    size_t getObjectCount() const { return objectCount_; }
+
+private:
+    struct Endpoint {
+        double value;
+        uint32_t proxy;
+        uint32_t isMax;
+        
+        bool operator<(const Endpoint& other) const {
+            // Mins sort before maxes at equal values so touching boxes overlap
+            return value < other.value || (value == other.value && isMax < other.isMax);
+        }
+    };
+    
+    static constexpr uint32_t kNoProxy = ~uint32_t(0);
+    
+    struct Proxy {
+        ObjectHandle handle;
+        Geometry::BoundingBox bounds;
+        bool alive = false;
+    };
+    
+    // Position of each proxy's endpoints, indexed [axis][min/max]
+    using EndpointPositions = std::array<std::array<uint32_t, 2>, 3>;
+    
+    std::vector<Proxy> proxies_;
+    std::vector<uint32_t> proxyBySlot_;     // Indexed by handle slot
+    std::vector<uint32_t> freeProxies_;
+    size_t objectCount_;
+    
+    // Removed proxies keep their endpoints until the next compaction
+    std::vector<uint32_t> deadProxies_;
+    
+    // Inserts append unsorted endpoints; the next query sorts them in one pass
+    mutable std::array<std::vector<Endpoint>, 3> axes_;
+    mutable std::vector<EndpointPositions> positions_;
+    mutable size_t pendingChanges_;
+    mutable bool sorted_;
+    
+    uint32_t findProxy(ObjectHandle handle) const;
+    void ensureSorted() const;
+    void rebuildPositions(int axis) const;
+    void compact();
+    void siftEndpoint(int axis, uint32_t position);
+    bool overlapsOnOtherAxes(const Geometry::BoundingBox& a, const Geometry::BoundingBox& b,
+                             int sweepAxis) const;
+    int chooseSweepAxis() const;
+    
+    template<typename Fn>
+    void sweep(Fn&& fn) const;
+};
+
+} // namespace Scene
+} // namespace KitchenCAD
\ No newline at end of file
@@ -1053,28 +1053,16 @@ void DesignCanvas::setupPickingFramebuffer()
 
 QString DesignCanvas::performObjectPicking(const QPoint& screenPos)
 {
-    if (!m_pickingFramebuffer) {
+    if (!m_sceneManager || !m_camera) {
         return QString();
     }
     
-    // Render to picking framebuffer
-    glBindFramebuffer(GL_FRAMEBUFFER, m_pickingFramebuffer);
-    glViewport(0, 0, m_viewportWidth, m_viewportHeight);
-    glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
-    
-    // Render objects with unique colors for picking
-    // TODO: Implement object picking rendering
-    
-    // Read pixel at mouse position
-    float pixelData[3];
-    glReadPixels(screenPos.x(), m_viewportHeight - screenPos.y(), 1, 1, GL_RGB, GL_FLOAT, pixelData);
-    
-    glBindFramebuffer(GL_FRAMEBUFFER, 0);
-    
-    // Convert color back to object ID
-    // TODO: Implement color to ID conversion
+    // Pick against object bounds through the scene's spatial index instead of
+    // reading back an ID buffer, so picking costs no extra render pass
+    auto ray = m_camera->screenToRay(screenPos.x(), screenPos.y(), m_viewportWidth, m_viewportHeight);
+    auto hit = m_sceneManager->raycast(ray.origin, ray.direction);
     
-    return QString(); // Placeholder
+    return hit ? QString::fromStdString(hit->objectId) : QString();
 }
 
 void DesignCanvas::renderPlaceholderObjects()
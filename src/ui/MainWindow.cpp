@@ -16,6 +16,7 @@
 #include <QSettings>
 #include <QSplitter>
 #include <QProgressBar>
+#include <QTimer>
 
 using namespace KitchenCAD::UI;
 using namespace KitchenCAD::Controllers;
@@ -39,6 +40,11 @@ MainWindow::MainWindow(QWidget *parent)
     m_catalogController = std::make_unique<CatalogController>(this);
     m_designController = std::make_unique<DesignController>(this);
     
+    // Scene edits made during one event loop iteration reach the views as one change set
+    m_designController->setEventLoopPoster([this](std::function<void()> task) {
+        QTimer::singleShot(0, this, std::move(task));
+    });
+    
     setupUI();
     setupMenus();
     setupToolbars();
@@ -0,0 +1,103 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <utility>
+
+namespace KitchenCAD {
+namespace Utils {
+
+/**
+ * @brief Value computed on first use, safe to read from many threads
+ * 
+ * The first thread to call get() computes the value; threads arriving
+ * meanwhile wait for it instead of computing it again. After that, get() is
+ * a single acquire load. If the computation throws, the value stays unset
+ * and the next caller tries again.
+ * 
+ * reset() and assignment are writes: like any other mutation of the owner,
+ * they need exclusive access.
+ */
+template<typename T>
+class LazyValue {
+public:
+    LazyValue() = default;
+    
+    LazyValue(const LazyValue& other) {
+        copyFrom(other);
+    }
+    
+    LazyValue& operator=(const LazyValue& other) {
+        if (this != &other) {
+            copyFrom(other);
+        }
+        return *this;
+    }
+    
+    /**
+     * @brief The value, computed by compute() if no thread has done so yet
+     */
+    template<typename Compute>
+    const T& get(Compute&& compute) const {
+        uint8_t state = state_.load(std::memory_order_acquire);
+        
+        while (state != kReady) {
+            if (state == kEmpty) {
+                if (state_.compare_exchange_weak(state, kComputing, std::memory_order_acquire)) {
+                    publish(std::forward<Compute>(compute));
+                    return value_;
+                }
+            } else {
+                state_.wait(kComputing, std::memory_order_acquire);
+                state = state_.load(std::memory_order_acquire);
+            }
+        }
+        return value_;
+    }
+    
+    bool isReady() const {
+        return state_.load(std::memory_order_acquire) == kReady;
+    }
+    
+    /**
+     * @brief Forget the value so the next get() computes it again
+     */
+    void reset() {
+        value_ = T();
+        state_.store(kEmpty, std::memory_order_release);
+    }
+
+private:
+    static constexpr uint8_t kEmpty = 0;
+    static constexpr uint8_t kComputing = 1;
+    static constexpr uint8_t kReady = 2;
+    
+    template<typename Compute>
+    void publish(Compute&& compute) const {
+        try {
+            value_ = compute();
+        } catch (...) {
+            state_.store(kEmpty, std::memory_order_release);
+            state_.notify_all();
+            throw;
+        }
+        state_.store(kReady, std::memory_order_release);
+        state_.notify_all();
+    }
+    
+    void copyFrom(const LazyValue& other) {
+        // A value still being computed in other is not copied
+        if (other.isReady()) {
+            value_ = other.value_;
+            state_.store(kReady, std::memory_order_release);
+        } else {
+            reset();
+        }
+    }
+    
+    mutable std::atomic<uint8_t> state_{kEmpty};
+    mutable T value_{};
+};
+
+} // namespace Utils
+} // namespace KitchenCAD
\ No newline at end of file
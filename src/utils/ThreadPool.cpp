@@ -0,0 +1,143 @@
+#include "ThreadPool.h"
+#include <algorithm>
+#include <atomic>
+#include <exception>
+#include <memory>
+
+namespace KitchenCAD {
+namespace Utils {
+
+namespace {
+
+/**
+ * @brief One parallelFor, shared with the helper tasks it queued
+ * 
+ * Helpers may start after the caller has returned, so they only touch this
+ * state, never the caller's stack, once no chunks are left to claim.
+ */
+struct ParallelLoop {
+    ThreadPool::RangeFunction body;
+    size_t count;
+    size_t grainSize;
+    size_t chunkCount;
+    
+    std::atomic<size_t> nextChunk{0};
+    std::atomic<size_t> completedChunks{0};
+    
+    std::mutex mutex;
+    std::condition_variable finished;
+    std::exception_ptr error;
+    
+    // Claim and run chunks until none are left
+    void run() {
+        for (size_t chunk = nextChunk.fetch_add(1); chunk < chunkCount; chunk = nextChunk.fetch_add(1)) {
+            size_t begin = chunk * grainSize;
+            size_t end = std::min(begin + grainSize, count);
+            
+            try {
+                body(begin, end);
+            } catch (...) {
+                std::lock_guard<std::mutex> lock(mutex);
+                if (!error) error = std::current_exception();
+            }
+            
+            if (completedChunks.fetch_add(1) + 1 == chunkCount) {
+                std::lock_guard<std::mutex> lock(mutex);
+                finished.notify_all();
+            }
+        }
+    }
+};
+
+} // namespace
+
+ThreadPool::ThreadPool(size_t threadCount) {
+    if (threadCount == 0) {
+        threadCount = std::max<size_t>(1, std::thread::hardware_concurrency());
+    }
+    
+    workers_.reserve(threadCount - 1);
+    for (size_t i = 1; i < threadCount; ++i) {
+        workers_.emplace_back([this]() { workerLoop(); });
+    }
+}
+
+ThreadPool::~ThreadPool() {
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        stopping_ = true;
+    }
+    taskAvailable_.notify_all();
+    
+    for (auto& worker : workers_) {
+        worker.join();
+    }
+}
+
+ThreadPool& ThreadPool::shared() {
+    static ThreadPool pool;
+    return pool;
+}
+
+void ThreadPool::parallelFor(size_t count, const RangeFunction& body, size_t grainSize) {
+    if (count == 0) return;
+    
+    size_t threads = getThreadCount();
+    if (grainSize == 0) {
+        // A few chunks per thread keeps threads busy when items differ in cost
+        grainSize = std::max<size_t>(1, count / (threads * 4));
+    }
+    
+    size_t chunkCount = (count + grainSize - 1) / grainSize;
+    if (threads == 1 || chunkCount == 1) {
+        body(0, count);
+        return;
+    }
+    
+    auto loop = std::make_shared<ParallelLoop>();
+    loop->body = body;
+    loop->count = count;
+    loop->grainSize = grainSize;
+    loop->chunkCount = chunkCount;
+    
+    size_t helpers = std::min(workers_.size(), chunkCount - 1);
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        for (size_t i = 0; i < helpers; ++i) {
+            tasks_.emplace_back([loop]() { loop->run(); });
+        }
+    }
+    if (helpers == 1) {
+        taskAvailable_.notify_one();
+    } else {
+        taskAvailable_.notify_all();
+    }
+    
+    loop->run();
+    
+    std::unique_lock<std::mutex> lock(loop->mutex);
+    loop->finished.wait(lock, [&loop]() { return loop->completedChunks.load() == loop->chunkCount; });
+    
+    if (loop->error) {
+        std::rethrow_exception(loop->error);
+    }
+}
+
+void ThreadPool::workerLoop() {
+    while (true) {
+        std::function<void()> task;
+        {
+            std::unique_lock<std::mutex> lock(mutex_);
+            taskAvailable_.wait(lock, [this]() { return stopping_ || !tasks_.empty(); });
+            
+            if (stopping_ && tasks_.empty()) return;
+            
+            task = std::move(tasks_.front());
+            tasks_.pop_front();
+        }
+        task();
+    }
+}
+
+} // namespace Utils
+} // namespace KitchenCAD
\ No newline at end of file
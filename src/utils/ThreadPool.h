@@ -0,0 +1,71 @@
+#pragma once
+
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace KitchenCAD {
+namespace Utils {
+
+/**
+ * @brief Fixed set of worker threads for data-parallel loops
+ * 
+ * parallelFor splits an index range into chunks that the workers and the
+ * calling thread claim one at a time, so the caller never idles and a
+ * parallelFor issued from inside another one cannot deadlock: the caller
+ * finishes the work itself if every worker is busy.
+ * 
+ * A pool of N threads runs N - 1 workers plus the caller. A pool of one
+ * thread runs everything on the caller.
+ */
+class ThreadPool {
+public:
+    using RangeFunction = std::function<void(size_t begin, size_t end)>;
+    
+    /**
+     * @brief Create a pool
+     * @param threadCount Threads including the caller; 0 uses all hardware threads
+     */
+    explicit ThreadPool(size_t threadCount = 0);
+    ~ThreadPool();
+    
+    ThreadPool(const ThreadPool&) = delete;
+    ThreadPool& operator=(const ThreadPool&) = delete;
+    
+    /**
+     * @brief Pool sized to the machine, shared by the whole process
+     */
+    static ThreadPool& shared();
+    
+    /**
+     * @brief Threads that run a parallelFor, including the caller
+     */
+    size_t getThreadCount() const { return workers_.size() + 1; }
+    
+    /**
+     * @brief Call body on consecutive sub-ranges covering [0, count)
+     * 
+     * Returns once every sub-range is done. If body throws, the remaining
+     * sub-ranges still run and the first exception is rethrown here.
+     * 
+     * @param grainSize Smallest sub-range; 0 picks one giving each thread a few chunks
+     */
+    void parallelFor(size_t count, const RangeFunction& body, size_t grainSize = 0);
+
+private:
+    void workerLoop();
+    
+    std::vector<std::thread> workers_;
+    
+    std::mutex mutex_;
+    std::condition_variable taskAvailable_;
+    std::deque<std::function<void()>> tasks_;
+    bool stopping_ = false;
+};
+
+} // namespace Utils
+} // namespace KitchenCAD
\ No newline at end of file
@@ -22,25 +22,18 @@ std::vector<ValidationError> CollisionValidationRule::validate(const SceneObject
         return errors; // Cannot validate without scene context
     }
     
-    // Get object's bounding box
-    Geometry::BoundingBox objectBounds = calculateTransformedBounds(object);
-    
-    // Check collision with all other objects
+    // The scene already confirms candidates with oriented boxes, so a rotated
+    // object is only reported when its real box overlaps another one
     auto intersectingObjects = context.sceneManager->findIntersectingObjects(object.getId());
     
     for (const auto& otherId : intersectingObjects) {
-        const SceneObject* otherObject = context.sceneManager->getObject(otherId);
-        if (otherObject && otherObject->getId() != object.getId()) {
-            Geometry::BoundingBox otherBounds = calculateTransformedBounds(*otherObject);
-            
-            if (checkBoundingBoxCollision(objectBounds, otherBounds)) {
-                errors.emplace_back(ValidationSeverity::Error,
-                                   "Object collision detected with " + otherId,
-                                   object.getId(),
-                                   object.getTransform().translation,
-                                   "Move objects to avoid overlap",
-                                   getRuleId());
-            }
+        if (otherId != object.getId()) {
+            errors.emplace_back(ValidationSeverity::Error,
+                               "Object collision detected with " + otherId,
+                               object.getId(),
+                               object.getTransform().translation,
+                               "Move objects to avoid overlap",
+                               getRuleId());
         }
     }
     
@@ -52,29 +45,6 @@ bool CollisionValidationRule::appliesTo(const SceneObject& object) const {
     return true;
 }
 
-bool CollisionValidationRule::checkBoundingBoxCollision(const Geometry::BoundingBox& a, 
-                                                       const Geometry::BoundingBox& b) const {
-    return a.intersects(b);
-}
-
-Geometry::BoundingBox CollisionValidationRule::calculateTransformedBounds(const SceneObject& object) const {
-    // For now, create a simple bounding box based on transform
-    // In a real implementation, this would use the actual geometry
-    const auto& transform = object.getTransform();
-    const auto& pos = transform.translation;
-    const auto& scale = transform.scale;
-    
-    // Assume a default size of 0.6m x 0.6m x 0.85m (typical base cabinet)
-    double width = 0.6 * scale.x;
-    double depth = 0.6 * scale.y;
-    double height = 0.85 * scale.z;
-    
-    return Geometry::BoundingBox(
-        Geometry::Point3D(pos.x - width/2, pos.y - depth/2, pos.z),
-        Geometry::Point3D(pos.x + width/2, pos.y + depth/2, pos.z + height)
-    );
-}
-
 // DimensionValidationRule Implementation
 
 DimensionValidationRule::DimensionValidationRule(double minDim, double maxDim)
@@ -41,17 +41,6 @@ public:
                                          const ValidationContext& context) override;
     
     bool appliesTo(const SceneObject& object) const override;
-
-private:
-    /**
-     * @brief Check if two bounding boxes intersect
-     */
-    bool checkBoundingBoxCollision(const Geometry::BoundingBox& a, const Geometry::BoundingBox& b) const;
-    
-    /**
-     * @brief Calculate object bounding box with transform applied
-     */
-    Geometry::BoundingBox calculateTransformedBounds(const SceneObject& object) const;
 };
 
 /**
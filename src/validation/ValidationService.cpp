@@ -253,14 +253,19 @@ std::vector<ValidationError> ValidationService::validateScene(const SceneManager
     context.enableStrictMode = strictMode_;
     context.toleranceDistance = tolerance_;
     
-    // Validate all objects in the scene
-    sceneManager.forEachObject([&](const ObjectId& id, const SceneObject* object) {
+    // Validate all objects in the scene; rules query the scene, so not from inside the iteration
+    std::vector<const SceneObject*> objects;
+    sceneManager.forEachObject([&](const ObjectId&, const SceneObject* object) {
         if (object) {
-            auto objectErrors = validateObject(*object, context);
-            errors.insert(errors.end(), objectErrors.begin(), objectErrors.end());
+            objects.push_back(object);
         }
     });
     
+    for (const SceneObject* object : objects) {
+        auto objectErrors = validateObject(*object, context);
+        errors.insert(errors.end(), objectErrors.begin(), objectErrors.end());
+    }
+    
     // Check for collisions between all objects
     auto allObjects = sceneManager.getAllObjects();
     for (size_t i = 0; i < allObjects.size(); ++i) {
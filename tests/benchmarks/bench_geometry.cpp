@@ -0,0 +1,322 @@
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include "../../src/geometry/Geometry.h"
+#include "../../src/interfaces/IGeometryEngine.h"
+#include "../../src/utils/ThreadPool.h"
+#include <algorithm>
+#include <array>
+#include <limits>
+#include <memory>
+#include <random>
+#include <string>
+#include <utility>
+#include <vector>
+
+using namespace KitchenCAD::Geometry;
+
+namespace {
+
+constexpr size_t kTransformCount = 10000;
+
+const BoundingBox kUnitBox(Point3D(-0.5, -0.5, -0.5), Point3D(0.5, 0.5, 0.5));
+
+/**
+ * @brief Cabinet placements on a 20 x 20 m floor, turned about Z as in a typical layout
+ */
+std::vector<Transform3D> generatePlacements(size_t count, unsigned seed = 42) {
+    std::mt19937 rng(seed);
+    std::uniform_real_distribution<double> position(0.0, 20.0);
+    std::uniform_real_distribution<double> angle(-GeometryUtils::PI, GeometryUtils::PI);
+    
+    std::vector<Transform3D> transforms;
+    transforms.reserve(count);
+    for (size_t i = 0; i < count; ++i) {
+        transforms.emplace_back(Point3D(position(rng), position(rng), 0.45), Vector3D(0.0, 0.0, angle(rng)),
+                                Vector3D(0.6, 0.58, 0.9));
+    }
+    return transforms;
+}
+
+/**
+ * @brief Matrix built as five 4x4 matrices multiplied together
+ */
+Matrix4x4 composedMatrix(const Transform3D& transform) {
+    return Matrix4x4::translation(Vector3D(transform.translation.x, transform.translation.y, transform.translation.z)) *
+           Matrix4x4::rotationX(transform.rotation.x) * Matrix4x4::rotationY(transform.rotation.y) *
+           Matrix4x4::rotationZ(transform.rotation.z) * Matrix4x4::scale(transform.scale);
+}
+
+/**
+ * @brief Box around the eight corners, each placed with its own matrix build
+ */
+BoundingBox boundsPerCorner(const BoundingBox& box, const Transform3D& transform) {
+    BoundingBox result;
+    for (const auto& corner : box.getCorners()) {
+        result.expand(composedMatrix(transform).transformPoint(corner));
+    }
+    return result;
+}
+
+} // namespace
+
+TEST_CASE("Transform benchmark - per-object bounds recomputation", "[!benchmark][geometry][transform]") {
+    std::vector<Transform3D> transforms = generatePlacements(kTransformCount);
+    std::vector<CachedTransform3D> cached(transforms.begin(), transforms.end());
+    for (const auto& transform : cached) {
+        transform.matrix();
+    }
+    
+    auto sumExtents = [](const BoundingBox& box) { return box.max.x - box.min.x + box.max.y - box.min.y; };
+    
+    BENCHMARK("world matrix 10k, composed T * R * S") {
+        double sum = 0.0;
+        for (const auto& transform : transforms) {
+            sum += composedMatrix(transform)(0, 0);
+        }
+        return sum;
+    };
+    
+    BENCHMARK("world matrix 10k, Transform3D::toMatrix") {
+        double sum = 0.0;
+        for (const auto& transform : transforms) {
+            sum += transform.toMatrix()(0, 0);
+        }
+        return sum;
+    };
+    
+    BENCHMARK("box bounds 10k, matrix per corner") {
+        double sum = 0.0;
+        for (const auto& transform : transforms) {
+            sum += sumExtents(boundsPerCorner(kUnitBox, transform));
+        }
+        return sum;
+    };
+    
+    BENCHMARK("box bounds 10k, BoundingBox::transformed") {
+        double sum = 0.0;
+        for (const auto& transform : transforms) {
+            sum += sumExtents(kUnitBox.transformed(transform));
+        }
+        return sum;
+    };
+    
+    BENCHMARK("box bounds 10k, CachedTransform3D") {
+        double sum = 0.0;
+        for (const auto& transform : cached) {
+            sum += sumExtents(transform.transformBounds(kUnitBox));
+        }
+        return sum;
+    };
+    
+    BENCHMARK("oriented bounds 10k, Transform3D") {
+        double sum = 0.0;
+        for (const auto& transform : transforms) {
+            sum += OrientedBoundingBox::fromTransform(kUnitBox, transform).halfExtents.x;
+        }
+        return sum;
+    };
+    
+    BENCHMARK("oriented bounds 10k, CachedTransform3D") {
+        double sum = 0.0;
+        for (const auto& transform : cached) {
+            sum += OrientedBoundingBox::fromMatrix(kUnitBox, transform.matrix()).halfExtents.x;
+        }
+        return sum;
+    };
+}
+
+TEST_CASE("Transform benchmark - batch point transform", "[!benchmark][geometry][transform]") {
+    std::vector<Transform3D> transforms = generatePlacements(kTransformCount);
+    std::array<Point3D, 8> corners;
+    std::vector<Point3D> source = kUnitBox.getCorners();
+    
+    BENCHMARK("8 corners x 10k, Transform3D::transformPoint") {
+        double sum = 0.0;
+        for (const auto& transform : transforms) {
+            for (const auto& corner : source) {
+                Point3D point = transform.transformPoint(corner);
+                sum += point.x + point.y + point.z;
+            }
+        }
+        return sum;
+    };
+    
+    BENCHMARK("8 corners x 10k, Transform3D::transformPoints") {
+        double sum = 0.0;
+        for (const auto& transform : transforms) {
+            std::copy(source.begin(), source.end(), corners.begin());
+            transform.transformPoints(corners);
+            for (const auto& corner : corners) {
+                sum += corner.x + corner.y + corner.z;
+            }
+        }
+        return sum;
+    };
+}
+
+TEST_CASE("Matrix kernel benchmark", "[!benchmark][geometry][matrix][simd]") {
+    std::vector<Transform3D> transforms = generatePlacements(kTransformCount);
+    std::vector<Matrix4x4> matrices;
+    std::vector<Point3D> source;
+    matrices.reserve(transforms.size());
+    source.reserve(transforms.size());
+    for (const auto& transform : transforms) {
+        matrices.push_back(transform.toMatrix());
+        source.push_back(transform.translation);
+    }
+    std::vector<BoundingBox> boxes(kTransformCount, kUnitBox);
+    std::vector<BoundingBox> placed(kTransformCount);
+    const Matrix4x4& view = matrices.front();
+    
+    const std::array<std::pair<MatrixKernels::Kernel, const char*>, 3> kernels = {{
+        {MatrixKernels::Kernel::Scalar, "scalar"},
+        {MatrixKernels::Kernel::SSE, "SSE"},
+        {MatrixKernels::Kernel::AVX2, "AVX2"}
+    }};
+    
+    for (const auto& [kernel, name] : kernels) {
+        if (!MatrixKernels::isKernelSupported(kernel)) continue;
+        MatrixKernels::setKernel(kernel);
+        std::string suffix = std::string(", ") + name;
+        
+        BENCHMARK("multiply 10k" + suffix) {
+            double sum = 0.0;
+            for (const auto& matrix : matrices) {
+                sum += (view * matrix)(0, 3);
+            }
+            return sum;
+        };
+        
+        BENCHMARK("inverse 10k" + suffix) {
+            double sum = 0.0;
+            for (const auto& matrix : matrices) {
+                sum += matrix.inverse()(0, 3);
+            }
+            return sum;
+        };
+        
+        BENCHMARK("transform 10k points" + suffix) {
+            std::vector<Point3D> points = source;
+            view.transformPoints(points);
+            return points.back().x + points.back().y;
+        };
+        
+        BENCHMARK("transform 10k boxes" + suffix) {
+            MatrixKernels::transformBounds(view.data(), boxes.data(), placed.data(), boxes.size());
+            return placed.back().max.x;
+        };
+    }
+    MatrixKernels::setKernel(MatrixKernels::detectKernel());
+}
+
+namespace {
+
+/**
+ * @brief Box whose distance query samples its surface, standing in for an exact B-rep query
+ */
+class SampledBoxShape : public KitchenCAD::Shape3D {
+public:
+    explicit SampledBoxShape(const BoundingBox& box) : box_(box) {
+        Vector3D size = box.size();
+        for (int i = 0; i < 4; ++i) {
+            for (int j = 0; j < 4; ++j) {
+                for (int k = 0; k < 4; ++k) {
+                    samples_.emplace_back(box.min.x + size.x * i / 3.0, box.min.y + size.y * j / 3.0,
+                                          box.min.z + size.z * k / 3.0);
+                }
+            }
+        }
+    }
+    
+    BoundingBox getBoundingBox() const override { return box_; }
+    double getVolume() const override { return box_.volume(); }
+    double getSurfaceArea() const override { return 0.0; }
+    bool isValid() const override { return true; }
+    bool isClosed() const override { return true; }
+    bool isEmpty() const override { return false; }
+    std::unique_ptr<KitchenCAD::Shape3D> transformed(const Transform3D&) const override { return clone(); }
+    void transform(const Transform3D&) override {}
+    bool contains(const Point3D& point) const override { return box_.contains(point); }
+    double distanceTo(const Point3D& point) const override { return box_.distanceTo(point); }
+    
+    double distanceTo(const KitchenCAD::Shape3D& other) const override {
+        const auto& otherSamples = static_cast<const SampledBoxShape&>(other).samples_;
+        double best = std::numeric_limits<double>::infinity();
+        for (const auto& a : samples_) {
+            for (const auto& b : otherSamples) {
+                best = std::min(best, a.distanceTo(b));
+            }
+        }
+        return best;
+    }
+    
+    bool intersects(const KitchenCAD::Shape3D& other) const override { return box_.intersects(other.getBoundingBox()); }
+    bool intersects(const BoundingBox& box) const override { return box_.intersects(box); }
+    std::unique_ptr<KitchenCAD::Shape3D> clone() const override { return std::make_unique<SampledBoxShape>(box_); }
+    std::string getType() const override { return "Solid"; }
+    bool serialize(const std::string&) const override { return false; }
+    bool deserialize(const std::string&) override { return false; }
+    
+private:
+    BoundingBox box_;
+    std::vector<Point3D> samples_;
+};
+
+class SampledGeometryEngine : public KitchenCAD::IGeometryEngine {
+public:
+    std::unique_ptr<KitchenCAD::Shape3D> createBox(const Point3D& origin, double width, double height, double depth) override {
+        return std::make_unique<SampledBoxShape>(
+            BoundingBox(origin, Point3D(origin.x + width, origin.y + height, origin.z + depth)));
+    }
+    std::unique_ptr<KitchenCAD::Shape3D> createCylinder(const Point3D&, double, double) override { return nullptr; }
+    std::unique_ptr<KitchenCAD::Shape3D> createSphere(const Point3D&, double) override { return nullptr; }
+    std::unique_ptr<KitchenCAD::Shape3D> createCone(const Point3D&, double, double, double) override { return nullptr; }
+    bool performBoolean(KitchenCAD::Shape3D&, const KitchenCAD::Shape3D&, KitchenCAD::BooleanOperation) override {
+        return false;
+    }
+    std::vector<KitchenCAD::Face> getFaces(const KitchenCAD::Shape3D&) override { return {}; }
+    BoundingBox getBoundingBox(const KitchenCAD::Shape3D& shape) override { return shape.getBoundingBox(); }
+    double getVolume(const KitchenCAD::Shape3D& shape) override { return shape.getVolume(); }
+    double getSurfaceArea(const KitchenCAD::Shape3D& shape) override { return shape.getSurfaceArea(); }
+    bool intersects(const KitchenCAD::Shape3D& a, const KitchenCAD::Shape3D& b) override { return a.intersects(b); }
+    double distanceBetween(const KitchenCAD::Shape3D& a, const KitchenCAD::Shape3D& b) override { return a.distanceTo(b); }
+    std::unique_ptr<KitchenCAD::Shape3D> transform(const KitchenCAD::Shape3D& shape, const Transform3D& t) override {
+        return shape.transformed(t);
+    }
+    bool isValidShape(const KitchenCAD::Shape3D& shape) override { return shape.isValid(); }
+    bool isClosed(const KitchenCAD::Shape3D& shape) override { return shape.isClosed(); }
+};
+
+} // namespace
+
+TEST_CASE("Batch benchmark - pairwise distances across pool sizes", "[!benchmark][geometry][batch]") {
+    SampledGeometryEngine engine;
+    
+    // 64 cabinets along the walls; every pair is a clearance check
+    std::vector<std::unique_ptr<KitchenCAD::Shape3D>> cabinets;
+    for (int i = 0; i < 64; ++i) {
+        cabinets.push_back(engine.createBox(Point3D(0.6 * (i % 16), 0.6 * (i / 16), 0.0), 0.6, 0.58, 0.9));
+    }
+    std::vector<KitchenCAD::ShapePair> pairs;
+    for (size_t i = 0; i < cabinets.size(); ++i) {
+        for (size_t j = i + 1; j < cabinets.size(); ++j) {
+            pairs.emplace_back(cabinets[i].get(), cabinets[j].get());
+        }
+    }
+    
+    BENCHMARK("2016 distances, serial loop") {
+        double sum = 0.0;
+        for (const auto& [first, second] : pairs) {
+            sum += engine.distanceBetween(*first, *second);
+        }
+        return sum;
+    };
+    
+    for (size_t threads : {1, 4, 16}) {
+        KitchenCAD::Utils::ThreadPool pool(threads);
+        BENCHMARK("2016 distances, batch on " + std::to_string(threads) + " threads") {
+            std::vector<double> distances = engine.distancesBetween(pairs, pool);
+            return distances.back();
+        };
+    }
+}
\ No newline at end of file
@@ -0,0 +1,290 @@
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/generators/catch_generators.hpp>
+#include "../../src/scene/SceneManager.h"
+#include <atomic>
+#include <cstddef>
+#include <cstdlib>
+#include <new>
+#include <random>
+#include <string>
+#include <vector>
+
+using namespace KitchenCAD;
+using namespace KitchenCAD::Scene;
+using namespace KitchenCAD::Geometry;
+
+namespace {
+
+// Net heap bytes currently allocated through the global operator new
+std::atomic<long long> liveHeapBytes{0};
+
+// Calls to the global operator new
+std::atomic<long long> heapAllocations{0};
+
+} // namespace
+
+// Size-prefixed allocations let the counter track frees as well as allocations
+void* operator new(std::size_t size) {
+    void* block = std::malloc(size + sizeof(std::max_align_t));
+    if (!block) throw std::bad_alloc();
+    
+    *static_cast<std::size_t*>(block) = size;
+    liveHeapBytes.fetch_add(static_cast<long long>(size), std::memory_order_relaxed);
+    heapAllocations.fetch_add(1, std::memory_order_relaxed);
+    return static_cast<char*>(block) + sizeof(std::max_align_t);
+}
+
+void operator delete(void* pointer) noexcept {
+    if (!pointer) return;
+    
+    void* block = static_cast<char*>(pointer) - sizeof(std::max_align_t);
+    liveHeapBytes.fetch_sub(static_cast<long long>(*static_cast<std::size_t*>(block)), std::memory_order_relaxed);
+    std::free(block);
+}
+
+void operator delete(void* pointer, std::size_t) noexcept {
+    operator delete(pointer);
+}
+
+namespace {
+
+constexpr size_t kLargeSceneObjects = 50000;
+
+/**
+ * @brief Populate a showroom-sized scene of cabinet-like boxes on a 100 x 100 m floor
+ */
+std::vector<ObjectId> populateScene(SceneManager& scene, size_t count, unsigned seed = 42) {
+    std::mt19937 rng(seed);
+    std::uniform_real_distribution<double> position(0.0, 100.0);
+    
+    std::vector<ObjectId> ids;
+    ids.reserve(count);
+    
+    for (size_t i = 0; i < count; ++i) {
+        auto object = std::make_unique<Models::SceneObject>("base_cabinet");
+        object->setTransform(Transform3D(Point3D(position(rng), position(rng), 0.45), Vector3D(),
+                                         Vector3D(0.6, 0.6, 0.9)));
+        ids.push_back(scene.addObject(std::move(object)));
+    }
+    
+    return ids;
+}
+
+} // namespace
+
+TEST_CASE("SceneManager benchmark - 50k object scene", "[!benchmark][scene][manager]") {
+    long long heapBefore = liveHeapBytes.load();
+    
+    SceneManager scene(1.0, 1e-6, SpatialIndexType::HashedGrid);
+    scene.setCollisionDetectionEnabled(false);
+    auto ids = populateScene(scene, kLargeSceneObjects);
+    
+    long long heapAfter = liveHeapBytes.load();
+    WARN("Scene memory per object: " << (heapAfter - heapBefore) / static_cast<long long>(kLargeSceneObjects)
+         << " bytes");
+    
+    BoundingBox region(Point3D(40.0, 40.0, 0.0), Point3D(45.0, 45.0, 1.0));
+    
+    BENCHMARK("getObjectsInRegion 5x5 m, 50k objects") {
+        return scene.getObjectsInRegion(region);
+    };
+    
+    BENCHMARK("findIntersectingObjects, 50k objects") {
+        return scene.findIntersectingObjects(ids[ids.size() / 2]);
+    };
+    
+    BENCHMARK("findNearbyObjects 2 m, 50k objects") {
+        return scene.findNearbyObjects(ids[ids.size() / 3], 2.0);
+    };
+    
+    BENCHMARK("findNearestObjects k=5, 50k objects") {
+        return scene.findNearestObjects(Point3D(50.0, 50.0, 0.45), 5);
+    };
+    
+    BENCHMARK_ADVANCED("translateObject 1 cm, 50k objects")(Catch::Benchmark::Chronometer meter) {
+        const ObjectId& id = ids[ids.size() / 4];
+        meter.measure([&](int i) {
+            return scene.translateObject(id, Vector3D((i % 2 == 0) ? 0.01 : -0.01, 0.0, 0.0));
+        });
+    };
+    
+    BENCHMARK("isSelected, 50k objects") {
+        return scene.isSelected(ids[ids.size() / 5]);
+    };
+    
+    scene.setCollisionDetectionEnabled(true);
+    const ObjectId& movedId = ids[ids.size() / 6];
+    Transform3D moved = static_cast<const SceneManager&>(scene).getObject(movedId)->getTransform();
+    moved.translate(Vector3D(0.05, 0.0, 0.0));
+    
+    BENCHMARK("checkCollision, 50k objects") {
+        return scene.checkCollision(movedId, moved);
+    };
+    
+    Transform3D turned = moved;
+    turned.rotate(Vector3D(0.0, 0.0, 0.785398));
+    
+    BENCHMARK("checkCollision rotated 45 degrees, 50k objects") {
+        return scene.checkCollision(movedId, turned);
+    };
+    
+    Transform3D dragStart = static_cast<const SceneManager&>(scene).getObject(movedId)->getTransform();
+    Transform3D dragEnd = dragStart;
+    dragEnd.translate(Vector3D(5.0, 0.0, 0.0));
+    
+    BENCHMARK("checkSweptCollision 5 m drag, 50k objects") {
+        return scene.checkSweptCollision(movedId, dragStart, dragEnd);
+    };
+}
+
+TEST_CASE("SceneManager benchmark - move 200-object selection", "[!benchmark][scene][manager][batch]") {
+    SceneManager scene(1.0, 1e-6, SpatialIndexType::HashedGrid);
+    scene.setCollisionDetectionEnabled(false);
+    auto ids = populateScene(scene, 5000);
+    
+    std::vector<ObjectId> selection(ids.begin(), ids.begin() + 200);
+    std::vector<Transform3D> original;
+    for (const auto& id : selection) {
+        original.push_back(static_cast<const SceneManager&>(scene).getObject(id)->getTransform());
+    }
+    
+    auto shiftedTransforms = [&](int i) {
+        std::vector<ObjectTransform> transforms;
+        transforms.reserve(selection.size());
+        for (size_t j = 0; j < selection.size(); ++j) {
+            Transform3D transform = original[j];
+            transform.translate(Vector3D((i % 2 == 0) ? 0.01 : 0.0, 0.0, 0.0));
+            transforms.emplace_back(selection[j], transform);
+        }
+        return transforms;
+    };
+    
+    BENCHMARK_ADVANCED("moveObject per object, 200 of 5000")(Catch::Benchmark::Chronometer meter) {
+        auto transforms = shiftedTransforms(meter.runs());
+        meter.measure([&] {
+            for (const auto& [id, transform] : transforms) {
+                scene.moveObject(id, transform);
+            }
+        });
+    };
+    
+    BENCHMARK_ADVANCED("applyTransforms batch, 200 of 5000")(Catch::Benchmark::Chronometer meter) {
+        auto transforms = shiftedTransforms(meter.runs());
+        meter.measure([&] {
+            return scene.applyTransforms(transforms);
+        });
+    };
+}
+TEST_CASE("SceneManager benchmark - 100k object picking and culling", "[!benchmark][scene][manager][raycast]") {
+    auto backend = GENERATE(SpatialIndexType::HashedGrid, SpatialIndexType::AABBTree);
+    std::string suffix = backend == SpatialIndexType::HashedGrid ? ", hashed grid" : ", AABB tree";
+    
+    SceneManager scene(1.0, 1e-6, backend);
+    scene.setCollisionDetectionEnabled(false);
+    populateScene(scene, 100000);
+    
+    // Pick ray along the floor from outside the scene, and an eye-level view 10 m deep
+    Point3D eye(-5.0, 50.0, 0.5);
+    Vector3D across(1.0, 0.05, 0.0);
+    Matrix4x4 view = Matrix4x4::lookAt(Point3D(20.0, 20.0, 1.6), Point3D(25.0, 25.0, 0.9), Vector3D(0.0, 0.0, 1.0));
+    Frustum frustum = Frustum::fromMatrix(Matrix4x4::perspective(1.0, 1.5, 0.1, 10.0) * view);
+    
+    BENCHMARK("raycast nearest" + suffix) {
+        return scene.raycast(eye, across);
+    };
+    
+    BENCHMARK("raycastAll through the floor" + suffix) {
+        return scene.raycastAll(eye, across);
+    };
+    
+    BENCHMARK("queryFrustum" + suffix) {
+        return scene.queryFrustum(frustum);
+    };
+}
+
+TEST_CASE("Project benchmark - 100k object load and clear", "[!benchmark][models][project][pool]") {
+    constexpr size_t kObjects = 100000;
+    
+    // Scene data as a saved showroom project holds it
+    nlohmann::json sceneJson;
+    {
+        Models::Project source("Showroom", Models::RoomDimensions(100.0, 100.0, 3.0));
+        std::mt19937 rng(42);
+        std::uniform_real_distribution<double> position(0.0, 100.0);
+        for (size_t i = 0; i < kObjects; ++i) {
+            auto object = source.createObject("base_cabinet");
+            object->setTransform(Transform3D(Point3D(position(rng), position(rng), 0.45), Vector3D(),
+                                             Vector3D(0.6, 0.6, 0.9)));
+            source.addObject(std::move(object));
+        }
+        sceneJson = source.serializeSceneToJson();
+    }
+    const auto& objectsJson = sceneJson["objects"];
+    
+    auto loadObjects = [&](std::vector<std::unique_ptr<Models::SceneObject>>& objects) {
+        objects.reserve(kObjects);
+        for (const auto& objectJson : objectsJson) {
+            auto object = std::make_unique<Models::SceneObject>();
+            object->fromJson(objectJson);
+            objects.push_back(std::move(object));
+        }
+    };
+    
+    auto pool = Models::SceneObjectPool::create();
+    
+    // Heap calls for one load, with and without the pool
+    {
+        std::vector<std::unique_ptr<Models::SceneObject>> objects;
+        long long before = heapAllocations.load();
+        loadObjects(objects);
+        long long heapCalls = heapAllocations.load() - before;
+        objects.clear();
+        
+        Models::SceneObjectPool::Scope scope(pool);
+        before = heapAllocations.load();
+        loadObjects(objects);
+        long long pooledCalls = heapAllocations.load() - before;
+        objects.clear();
+        
+        auto stats = pool->getStatistics();
+        WARN("Heap allocations per 100k load: " << heapCalls << " global, " << pooledCalls << " pooled ("
+             << stats.slabCount << " slabs, " << stats.reservedBytes / 1024 << " KiB reserved)");
+    }
+    
+    BENCHMARK("allocate and free 100k SceneObjects, global heap") {
+        std::vector<std::unique_ptr<Models::SceneObject>> objects;
+        objects.reserve(kObjects);
+        for (size_t i = 0; i < kObjects; ++i) {
+            objects.push_back(std::make_unique<Models::SceneObject>());
+        }
+        objects.clear();
+        return objects.capacity();
+    };
+    
+    BENCHMARK("allocate and free 100k SceneObjects, object pool") {
+        Models::SceneObjectPool::Scope scope(pool);
+        std::vector<std::unique_ptr<Models::SceneObject>> objects;
+        objects.reserve(kObjects);
+        for (size_t i = 0; i < kObjects; ++i) {
+            objects.push_back(std::make_unique<Models::SceneObject>());
+        }
+        objects.clear();
+        return objects.capacity();
+    };
+    
+    BENCHMARK("load and clear 100k objects, global heap") {
+        std::vector<std::unique_ptr<Models::SceneObject>> objects;
+        loadObjects(objects);
+        objects.clear();
+        return objects.capacity();
+    };
+    
+    BENCHMARK("load and clear 100k objects, object pool") {
+        Models::SceneObjectPool::Scope scope(pool);
+        std::vector<std::unique_ptr<Models::SceneObject>> objects;
+        loadObjects(objects);
+        objects.clear();
+        return objects.capacity();
+    };
+}
\ No newline at end of file
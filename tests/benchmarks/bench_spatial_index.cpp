@@ -0,0 +1,245 @@
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include "../../src/scene/SpatialIndex.h"
+#include "../../src/scene/SweepAndPrune.h"
+#include "../../src/scene/BoundsSoA.h"
+#include <random>
+#include <string>
+#include <vector>
+
+using namespace KitchenCAD;
+using namespace KitchenCAD::Scene;
+using namespace KitchenCAD::Geometry;
+
+namespace {
+
+struct IndexedBox {
+    ObjectHandle handle;
+    BoundingBox bounds;
+};
+
+/**
+ * @brief Generate a kitchen-like mix of handles, cabinets, countertops and walls
+ */
+std::vector<IndexedBox> generateKitchenLayout(size_t count, unsigned seed = 42) {
+    std::mt19937 rng(seed);
+    std::uniform_real_distribution<double> position(0.0, 20.0);
+    std::uniform_int_distribution<int> kind(0, 9);
+    
+    std::vector<IndexedBox> boxes;
+    boxes.reserve(count);
+    
+    for (size_t i = 0; i < count; ++i) {
+        Point3D origin(position(rng), position(rng), 0.0);
+        Vector3D size;
+        
+        switch (kind(rng)) {
+            case 0: case 1: case 2:
+                size = Vector3D(0.02, 0.02, 0.15);      // Handle
+                break;
+            case 3: case 4: case 5: case 6:
+                size = Vector3D(0.6, 0.6, 0.9);         // Base cabinet
+                break;
+            case 7: case 8:
+                size = Vector3D(3.0, 0.6, 0.04);        // Countertop
+                origin.z = 0.9;
+                break;
+            default:
+                size = Vector3D(4.0, 0.1, 2.5);         // Wall
+                break;
+        }
+        
+        boxes.push_back({ObjectHandle(static_cast<uint32_t>(i), 0), BoundingBox(origin, origin + size)});
+    }
+    
+    return boxes;
+}
+
+std::unique_ptr<ISpatialIndex> buildIndex(SpatialIndexType type, const std::vector<IndexedBox>& boxes,
+                                          double cellSize) {
+    auto index = ISpatialIndex::create(type, cellSize);
+    for (const auto& box : boxes) {
+        index->addObject(box.handle, box.bounds);
+    }
+    return index;
+}
+
+const char* indexName(SpatialIndexType type) {
+    switch (type) {
+        case SpatialIndexType::Grid: return "string grid";
+        case SpatialIndexType::HashedGrid: return "hashed grid";
+        case SpatialIndexType::AABBTree: return "AABB tree";
+        case SpatialIndexType::HierarchicalGrid: return "hierarchical grid";
+    }
+    return "unknown";
+}
+
+constexpr double kCellSize = 0.1;
+constexpr size_t kObjectCount = 2000;
+
+} // namespace
+
+TEST_CASE("SpatialIndex benchmark - add objects", "[!benchmark][scene][spatial]") {
+    auto boxes = generateKitchenLayout(kObjectCount);
+    
+    for (auto type : {SpatialIndexType::Grid, SpatialIndexType::HashedGrid, SpatialIndexType::AABBTree,
+                      SpatialIndexType::HierarchicalGrid}) {
+        BENCHMARK(std::string("add 2000 objects, ") + indexName(type)) {
+            return buildIndex(type, boxes, kCellSize);
+        };
+    }
+}
+
+TEST_CASE("SpatialIndex benchmark - drag countertop", "[!benchmark][scene][spatial]") {
+    auto boxes = generateKitchenLayout(kObjectCount);
+    BoundingBox countertop(Point3D(5.0, 5.0, 0.9), Point3D(8.0, 5.6, 0.94));
+    ObjectHandle countertopHandle(static_cast<uint32_t>(kObjectCount), 0);
+    
+    for (auto type : {SpatialIndexType::Grid, SpatialIndexType::HashedGrid, SpatialIndexType::AABBTree,
+                      SpatialIndexType::HierarchicalGrid}) {
+        auto index = buildIndex(type, boxes, kCellSize);
+        index->addObject(countertopHandle, countertop);
+        
+        // One mouse event: move the 3 m countertop by 1 cm
+        BENCHMARK_ADVANCED(std::string("update 3 m countertop, ") + indexName(type))(
+            Catch::Benchmark::Chronometer meter) {
+            BoundingBox current = countertop;
+            meter.measure([&](int i) {
+                Vector3D offset((i % 2 == 0) ? 0.01 : -0.01, 0.0, 0.0);
+                BoundingBox next(current.min + offset, current.max + offset);
+                index->updateObject(countertopHandle, current, next);
+                current = next;
+            });
+            index->updateObject(countertopHandle, current, countertop);
+        };
+    }
+}
+
+TEST_CASE("SpatialIndex benchmark - query region", "[!benchmark][scene][spatial]") {
+    auto boxes = generateKitchenLayout(kObjectCount);
+    BoundingBox region(Point3D(4.0, 4.0, 0.0), Point3D(7.0, 5.0, 1.0));
+    
+    for (auto type : {SpatialIndexType::Grid, SpatialIndexType::HashedGrid, SpatialIndexType::AABBTree,
+                      SpatialIndexType::HierarchicalGrid}) {
+        auto index = buildIndex(type, boxes, kCellSize);
+        
+        BENCHMARK(std::string("query 3x1x1 m region, ") + indexName(type)) {
+            return index->queryRegion(region);
+        };
+    }
+}
+
+TEST_CASE("SpatialIndex benchmark - flat vs hierarchical grid", "[!benchmark][scene][spatial][hierarchical]") {
+    auto boxes = generateKitchenLayout(kObjectCount);
+    
+    // A cell size that suits handles, one that suits cabinets, and the hierarchy spanning both
+    const std::pair<SpatialIndexType, double> configurations[] = {
+        {SpatialIndexType::HashedGrid, 0.1},
+        {SpatialIndexType::HashedGrid, 1.0},
+        {SpatialIndexType::HierarchicalGrid, 1.0}
+    };
+    
+    BoundingBox cabinetFootprint(Point3D(10.0, 10.0, 0.0), Point3D(10.6, 10.6, 0.9));
+    BoundingBox wall(Point3D(2.0, 15.0, 0.0), Point3D(6.0, 15.1, 2.5));
+    ObjectHandle wallHandle(static_cast<uint32_t>(kObjectCount), 0);
+    
+    for (const auto& [type, cellSize] : configurations) {
+        std::string name = std::string(indexName(type)) + " " + std::to_string(cellSize).substr(0, 3) + " m";
+        auto index = buildIndex(type, boxes, cellSize);
+        
+        size_t candidates = 0;
+        for (const auto& box : boxes) {
+            candidates += index->queryRegion(box.bounds).size();
+        }
+        WARN(name << ": " << static_cast<double>(candidates) / boxes.size() << " candidates per object query");
+        
+        BENCHMARK("add 2000 objects, " + name) {
+            return buildIndex(type, boxes, cellSize);
+        };
+        
+        BENCHMARK("query cabinet footprint, " + name) {
+            return index->queryRegion(cabinetFootprint);
+        };
+        
+        index->addObject(wallHandle, wall);
+        BENCHMARK_ADVANCED("update 4 m wall, " + name)(Catch::Benchmark::Chronometer meter) {
+            BoundingBox current = wall;
+            meter.measure([&](int i) {
+                Vector3D offset((i % 2 == 0) ? 0.01 : -0.01, 0.0, 0.0);
+                BoundingBox next(current.min + offset, current.max + offset);
+                index->updateObject(wallHandle, current, next);
+                current = next;
+            });
+            index->updateObject(wallHandle, current, wall);
+        };
+    }
+}
+
+TEST_CASE("SweepAndPrune benchmark - all overlapping pairs", "[!benchmark][scene][collision]") {
+    auto boxes = generateKitchenLayout(kObjectCount);
+    
+    SweepAndPrune sap;
+    for (const auto& box : boxes) {
+        sap.addObject(box.handle, box.bounds);
+    }
+    
+    BENCHMARK("count pairs 2000 objects, brute force") {
+        size_t count = 0;
+        for (size_t i = 0; i < boxes.size(); ++i) {
+            for (size_t j = i + 1; j < boxes.size(); ++j) {
+                if (boxes[i].bounds.intersects(boxes[j].bounds)) ++count;
+            }
+        }
+        return count;
+    };
+    
+    BENCHMARK("count pairs 2000 objects, sweep and prune") {
+        return sap.countOverlappingPairs();
+    };
+    
+    BoundingBox countertop(Point3D(5.0, 5.0, 0.9), Point3D(8.0, 5.6, 0.94));
+    ObjectHandle countertopHandle(static_cast<uint32_t>(kObjectCount), 0);
+    sap.addObject(countertopHandle, countertop);
+    
+    BENCHMARK_ADVANCED("update 3 m countertop, sweep and prune")(Catch::Benchmark::Chronometer meter) {
+        meter.measure([&](int i) {
+            Vector3D offset((i % 2 == 0) ? 0.01 : 0.0, 0.0, 0.0);
+            sap.updateObject(countertopHandle, BoundingBox(countertop.min + offset, countertop.max + offset));
+        });
+    };
+}
+
+TEST_CASE("BoundsSoA benchmark - overlap scan", "[!benchmark][scene][simd]") {
+    auto boxes = generateKitchenLayout(kObjectCount);
+    BoundingBox region(Point3D(4.0, 4.0, 0.0), Point3D(7.0, 5.0, 1.0));
+    
+    BoundsSoA packed;
+    for (const auto& box : boxes) {
+        packed.set(box.handle.slot, box.bounds);
+    }
+    
+    BENCHMARK("scan 2000 boxes, double BoundingBox::intersects") {
+        std::vector<uint32_t> slots;
+        for (const auto& box : boxes) {
+            if (region.intersects(box.bounds)) slots.push_back(box.handle.slot);
+        }
+        return slots;
+    };
+    
+    const std::pair<BoundsSoA::Kernel, const char*> kernels[] = {
+        {BoundsSoA::Kernel::Scalar, "scalar"},
+        {BoundsSoA::Kernel::SSE, "SSE"},
+        {BoundsSoA::Kernel::AVX2, "AVX2"}
+    };
+    
+    for (const auto& kernel : kernels) {
+        if (!BoundsSoA::isKernelSupported(kernel.first)) continue;
+        packed.setKernel(kernel.first);
+        
+        BENCHMARK(std::string("scan 2000 boxes, packed float ") + kernel.second) {
+            std::vector<uint32_t> slots;
+            packed.findOverlapping(region, slots);
+            return slots;
+        };
+    }
+}
\ No newline at end of file
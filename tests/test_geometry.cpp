@@ -1,6 +1,11 @@
 #include <catch2/catch_test_macros.hpp>
 #include <catch2/catch_approx.hpp>
+#include <catch2/generators/catch_generators.hpp>
+#include <memory>
+#include <tuple>
+#include <vector>
 #include "../src/geometry/Geometry.h"
+#include "../src/geometry/TessellationCache.h"
 
 using namespace KitchenCAD::Geometry;
 using Catch::Approx;
@@ -163,6 +168,89 @@ TEST_CASE("Matrix4x4 operations", "[geometry][matrix]") {
         REQUIRE(result.y == Approx(4.0));
         REQUIRE(result.z == Approx(5.0));
     }
+    
+    SECTION("Inverse") {
+        Matrix4x4 matrix = Transform3D(Point3D(1.0, -2.0, 3.0), Vector3D(0.3, -1.1, 2.4),
+                                       Vector3D(0.5, 2.0, 1.5)).toMatrix();
+        Matrix4x4 product = matrix * matrix.inverse();
+        for (int row = 0; row < 4; ++row) {
+            for (int col = 0; col < 4; ++col) {
+                REQUIRE(product(row, col) == Approx(row == col ? 1.0 : 0.0).margin(1e-12));
+            }
+        }
+        
+        Matrix4x4 singular = Matrix4x4::scale(Vector3D(1.0, 0.0, 1.0));
+        Matrix4x4 fallback = singular.inverse();
+        REQUIRE(fallback(1, 1) == 1.0);
+        REQUIRE(fallback(0, 3) == 0.0);
+    }
+}
+
+TEST_CASE("Matrix kernels match the scalar results", "[geometry][matrix][simd]") {
+    auto kernel = GENERATE(MatrixKernels::Kernel::SSE, MatrixKernels::Kernel::AVX2);
+    if (!MatrixKernels::isKernelSupported(kernel)) return;
+    
+    Matrix4x4 a = Transform3D(Point3D(1.0, -2.0, 3.0), Vector3D(0.3, -1.1, 2.4), Vector3D(0.5, 2.0, 1.5)).toMatrix();
+    Matrix4x4 b = Matrix4x4::perspective(0.9, 1.5, 0.1, 50.0) *
+                  Matrix4x4::lookAt(Point3D(4.0, -3.0, 2.0), Point3D(), Vector3D(0.0, 0.0, 1.0));
+    std::vector<Point3D> points = {Point3D(0.0, 0.0, 0.0), Point3D(1.0, 2.0, 3.0), Point3D(-4.0, 0.5, 2.0)};
+    std::vector<BoundingBox> boxes = {BoundingBox(Point3D(-0.5, -0.5, -0.5), Point3D(0.5, 0.5, 0.5)),
+                                      BoundingBox(Point3D(2.0, 1.0, 0.0), Point3D(2.6, 1.58, 0.9)),
+                                      BoundingBox()};
+    
+    auto compute = [&](MatrixKernels::Kernel selected) {
+        MatrixKernels::setKernel(selected);
+        
+        std::vector<Point3D> transformedPoints = points;
+        a.transformPoints(transformedPoints);
+        
+        Transform3D transform(Point3D(1.0, -2.0, 3.0), Vector3D(0.3, -1.1, 2.4), Vector3D(0.5, 2.0, 1.5));
+        return std::make_tuple(a * b, b * a, a.inverse(), b.inverse(), transformedPoints,
+                               GeometryUtils::transformBoundingBoxes(boxes, transform));
+    };
+    
+    auto [abScalar, baScalar, invAScalar, invBScalar, pointsScalar, boxesScalar] = compute(MatrixKernels::Kernel::Scalar);
+    auto [ab, ba, invA, invB, pointsSimd, boxesSimd] = compute(kernel);
+    MatrixKernels::setKernel(MatrixKernels::detectKernel());
+    
+    auto requireSame = [](const Matrix4x4& actual, const Matrix4x4& expected) {
+        for (int row = 0; row < 4; ++row) {
+            for (int col = 0; col < 4; ++col) {
+                REQUIRE(actual(row, col) == expected(row, col));
+            }
+        }
+    };
+    
+    requireSame(ab, abScalar);
+    requireSame(ba, baScalar);
+    requireSame(invA, invAScalar);
+    requireSame(invB, invBScalar);
+    
+    for (size_t i = 0; i < points.size(); ++i) {
+        REQUIRE(pointsSimd[i] == pointsScalar[i]);
+        REQUIRE(pointsScalar[i].x == Approx(a.transformPoint(points[i]).x));
+        REQUIRE(pointsScalar[i].z == Approx(a.transformPoint(points[i]).z));
+    }
+    
+    // Point3D compares with a tolerance, which never holds for the empty box's infinities
+    for (size_t i = 0; i < boxes.size(); ++i) {
+        REQUIRE(boxesSimd[i].min.x == boxesScalar[i].min.x);
+        REQUIRE(boxesSimd[i].min.y == boxesScalar[i].min.y);
+        REQUIRE(boxesSimd[i].min.z == boxesScalar[i].min.z);
+        REQUIRE(boxesSimd[i].max.x == boxesScalar[i].max.x);
+        REQUIRE(boxesSimd[i].max.y == boxesScalar[i].max.y);
+        REQUIRE(boxesSimd[i].max.z == boxesScalar[i].max.z);
+    }
+    REQUIRE(boxesSimd[2].isEmpty());
+    
+    // The extents shortcut matches the box around the eight transformed corners
+    BoundingBox corners;
+    for (const auto& corner : boxes[1].getCorners()) {
+        corners.expand(a.transformPoint(corner));
+    }
+    REQUIRE(boxesScalar[1].min.x == Approx(corners.min.x));
+    REQUIRE(boxesScalar[1].max.y == Approx(corners.max.y));
+    REQUIRE(boxesScalar[1].max.z == Approx(corners.max.z));
 }
 
 TEST_CASE("Transform3D operations", "[geometry][transform]") {
@@ -215,6 +303,95 @@ TEST_CASE("Transform3D operations", "[geometry][transform]") {
         REQUIRE(lerped.translation.y == Approx(10.0));
         REQUIRE(lerped.translation.z == Approx(15.0));
     }
+    
+    SECTION("Matrix matches the composed T * R * S") {
+        Transform3D composite(Point3D(1.0, -2.0, 3.0), Vector3D(0.3, -1.1, 2.4), Vector3D(0.5, 2.0, 1.5));
+        Matrix4x4 expected = Matrix4x4::translation(Vector3D(1.0, -2.0, 3.0)) *
+                             Matrix4x4::rotationX(0.3) * Matrix4x4::rotationY(-1.1) * Matrix4x4::rotationZ(2.4) *
+                             Matrix4x4::scale(Vector3D(0.5, 2.0, 1.5));
+        
+        Matrix4x4 matrix = composite.toMatrix();
+        for (int row = 0; row < 4; ++row) {
+            for (int col = 0; col < 4; ++col) {
+                REQUIRE(matrix(row, col) == Approx(expected(row, col)).margin(1e-12));
+            }
+        }
+    }
+    
+    SECTION("Batch point transform") {
+        Transform3D composite(Point3D(1.0, -2.0, 3.0), Vector3D(0.3, -1.1, 2.4), Vector3D(0.5, 2.0, 1.5));
+        std::vector<Point3D> points = {Point3D(0.0, 0.0, 0.0), Point3D(1.0, 2.0, 3.0), Point3D(-4.0, 0.5, 2.0)};
+        std::vector<Point3D> expected;
+        for (const auto& point : points) {
+            expected.push_back(composite.transformPoint(point));
+        }
+        
+        composite.transformPoints(points);
+        for (size_t i = 0; i < points.size(); ++i) {
+            REQUIRE(points[i].x == Approx(expected[i].x));
+            REQUIRE(points[i].y == Approx(expected[i].y));
+            REQUIRE(points[i].z == Approx(expected[i].z));
+        }
+    }
+}
+
+TEST_CASE("CachedTransform3D operations", "[geometry][transform]") {
+    CachedTransform3D cached;
+    REQUIRE_FALSE(cached.isDirty());
+    REQUIRE(cached.transformPoint(Point3D(1.0, 2.0, 3.0)) == Point3D(1.0, 2.0, 3.0));
+    
+    auto requireMatches = [](const CachedTransform3D& cached) {
+        Matrix4x4 expected = cached.get().toMatrix();
+        for (int row = 0; row < 4; ++row) {
+            for (int col = 0; col < 4; ++col) {
+                REQUIRE(cached.matrix()(row, col) == Approx(expected(row, col)).margin(1e-12));
+            }
+        }
+    };
+    
+    SECTION("Rotation and scale invalidate the matrix") {
+        cached.setRotation(Vector3D(0.0, 0.0, GeometryUtils::HALF_PI));
+        REQUIRE(cached.isDirty());
+        
+        Point3D rotated = cached.transformPoint(Point3D(1.0, 0.0, 0.0));
+        REQUIRE_FALSE(cached.isDirty());
+        REQUIRE(rotated.x == Approx(0.0).margin(1e-10));
+        REQUIRE(rotated.y == Approx(1.0));
+        
+        cached.scaleBy(Vector3D(2.0, 2.0, 2.0));
+        REQUIRE(cached.isDirty());
+        requireMatches(cached);
+    }
+    
+    SECTION("Translation patches the cached matrix") {
+        cached.set(Transform3D(Point3D(), Vector3D(0.4, 0.2, -0.7), Vector3D(1.0, 2.0, 3.0)));
+        cached.matrix();
+        
+        cached.translate(Vector3D(5.0, -1.0, 2.0));
+        REQUIRE_FALSE(cached.isDirty());
+        requireMatches(cached);
+        
+        cached.setTranslation(Point3D(-3.0, 0.0, 1.0));
+        REQUIRE_FALSE(cached.isDirty());
+        requireMatches(cached);
+    }
+    
+    SECTION("Bounds match transforming the corners") {
+        cached.set(Transform3D(Point3D(2.0, 1.0, 0.0), Vector3D(0.0, 0.0, 0.6), Vector3D(0.6, 0.58, 0.72)));
+        BoundingBox local(Point3D(-0.5, -0.5, -0.5), Point3D(0.5, 0.5, 0.5));
+        
+        BoundingBox expected;
+        for (const auto& corner : local.getCorners()) {
+            expected.expand(cached.get().transformPoint(corner));
+        }
+        
+        BoundingBox bounds = cached.transformBounds(local);
+        REQUIRE(bounds.min.x == Approx(expected.min.x));
+        REQUIRE(bounds.min.y == Approx(expected.min.y));
+        REQUIRE(bounds.max.x == Approx(expected.max.x));
+        REQUIRE(bounds.max.z == Approx(expected.max.z));
+        REQUIRE(local.transformed(cached.get()).max.y == Approx(expected.max.y));
+    }
 }
 
 TEST_CASE("BoundingBox operations", "[geometry][boundingbox]") {
@@ -270,6 +447,103 @@ TEST_CASE("BoundingBox operations", "[geometry][boundingbox]") {
     }
 }
 
+TEST_CASE("Frustum operations", "[geometry][frustum]") {
+    // Camera at z = 10 looking at the origin with a 90 degree field of view
+    Matrix4x4 view = Matrix4x4::lookAt(Point3D(0.0, 0.0, 10.0), Point3D(0.0, 0.0, 0.0), Vector3D(0.0, 1.0, 0.0));
+    Matrix4x4 projection = Matrix4x4::perspective(GeometryUtils::HALF_PI, 1.0, 1.0, 100.0);
+    Frustum frustum = Frustum::fromMatrix(projection * view);
+    
+    SECTION("Point containment") {
+        REQUIRE(frustum.contains(Point3D(0.0, 0.0, 0.0)));
+        REQUIRE(frustum.contains(Point3D(9.0, -9.0, 0.0)));
+        REQUIRE(!frustum.contains(Point3D(11.0, 0.0, 0.0)));
+        REQUIRE(!frustum.contains(Point3D(0.0, 0.0, 11.0)));
+        REQUIRE(!frustum.contains(Point3D(0.0, 0.0, -95.0)));
+    }
+    
+    SECTION("Box tests") {
+        REQUIRE(frustum.intersects(BoundingBox(Point3D(9.0, -1.0, -1.0), Point3D(11.0, 1.0, 1.0))));
+        REQUIRE(!frustum.intersects(BoundingBox(Point3D(19.0, -1.0, -1.0), Point3D(21.0, 1.0, 1.0))));
+        REQUIRE(!frustum.intersects(BoundingBox()));
+    }
+    
+    SECTION("Bounds enclose the corners") {
+        BoundingBox bounds = frustum.bounds();
+        REQUIRE(bounds.min.x == Approx(-100.0));
+        REQUIRE(bounds.max.y == Approx(100.0));
+        REQUIRE(bounds.min.z == Approx(-90.0));
+        REQUIRE(bounds.max.z == Approx(9.0));
+    }
+}
+
+TEST_CASE("OrientedBoundingBox operations", "[geometry][obb]") {
+    BoundingBox unitCube(Point3D(-0.5, -0.5, -0.5), Point3D(0.5, 0.5, 0.5));
+    Vector3D quarterTurn(0.0, 0.0, GeometryUtils::HALF_PI / 2.0);
+    
+    SECTION("From transform") {
+        auto box = OrientedBoundingBox::fromTransform(
+            unitCube, Transform3D(Point3D(1.0, 2.0, 3.0), Vector3D(0.0, 0.0, GeometryUtils::HALF_PI),
+                                  Vector3D(2.0, 1.0, 1.0)));
+        
+        REQUIRE(box.center.x == Approx(1.0));
+        REQUIRE(box.center.z == Approx(3.0));
+        REQUIRE(box.halfExtents.x == Approx(1.0));
+        REQUIRE(box.halfExtents.y == Approx(0.5));
+        
+        BoundingBox bounds = box.bounds();
+        REQUIRE(bounds.min.x == Approx(0.5));
+        REQUIRE(bounds.max.x == Approx(1.5));
+        REQUIRE(bounds.min.y == Approx(1.0));
+        REQUIRE(bounds.max.y == Approx(3.0));
+        
+        REQUIRE(OrientedBoundingBox().isEmpty());
+        REQUIRE(OrientedBoundingBox().bounds().isEmpty());
+    }
+    
+    SECTION("Rotated box clear of an axis-aligned neighbour") {
+        auto diamond = OrientedBoundingBox::fromTransform(unitCube, Transform3D(Point3D(), quarterTurn));
+        auto neighbour = OrientedBoundingBox::fromBoundingBox(
+            BoundingBox(Point3D(0.6, 0.6, -0.5), Point3D(1.6, 1.6, 0.5)));
+        
+        // The axis-aligned bounds overlap in the empty corner, the boxes do not
+        REQUIRE(diamond.bounds().intersects(neighbour.bounds()));
+        REQUIRE(!diamond.intersects(neighbour));
+        REQUIRE(!neighbour.intersects(diamond));
+        
+        auto closer = OrientedBoundingBox::fromBoundingBox(
+            BoundingBox(Point3D(0.2, 0.2, -0.5), Point3D(1.2, 1.2, 0.5)));
+        REQUIRE(diamond.intersects(closer));
+    }
+    
+    SECTION("Penetration along the axis of least overlap") {
+        auto a = OrientedBoundingBox::fromBoundingBox(unitCube);
+        auto b = OrientedBoundingBox::fromTransform(unitCube, Transform3D(Point3D(0.8, 0.1, 0.0)));
+        
+        Vector3D axis;
+        double depth;
+        REQUIRE(a.penetration(b, axis, depth));
+        REQUIRE(depth == Approx(0.2));
+        REQUIRE(axis.x == Approx(-1.0));
+        REQUIRE(axis.y == Approx(0.0).margin(1e-12));
+        
+        auto c = OrientedBoundingBox::fromTransform(unitCube, Transform3D(Point3D(), quarterTurn));
+        auto d = OrientedBoundingBox::fromTransform(unitCube, Transform3D(Point3D(1.2, 0.0, 0.0), quarterTurn));
+        REQUIRE(c.penetration(d, axis, depth));
+        REQUIRE(depth == Approx(1.0 - 1.2 / std::sqrt(2.0)));
+        REQUIRE(axis.x < 0.0);
+    }
+    
+    SECTION("Touching and tolerance") {
+        auto a = OrientedBoundingBox::fromBoundingBox(unitCube);
+        auto touching = OrientedBoundingBox::fromTransform(unitCube, Transform3D(Point3D(1.0, 0.0, 0.0)));
+        auto gap = OrientedBoundingBox::fromTransform(unitCube, Transform3D(Point3D(1.001, 0.0, 0.0)));
+        
+        REQUIRE(a.intersects(touching));
+        REQUIRE(!a.intersects(gap));
+        REQUIRE(a.intersects(gap, 0.01));
+    }
+}
+
 TEST_CASE("GeometryUtils operations", "[geometry][utils]") {
     SECTION("Angle conversions") {
         double radians = GeometryUtils::degreesToRadians(90.0);
@@ -379,4 +653,98 @@ TEST_CASE("Color operations", "[geometry][color]") {
         REQUIRE(lerped.g == Approx(0.0f));
         REQUIRE(lerped.b == Approx(0.5f));
     }
+}
+
+TEST_CASE("TessellationCache operations", "[geometry][tessellation]") {
+    auto makeMesh = [](size_t triangles) {
+        auto mesh = std::make_shared<TriangleMesh>();
+        for (size_t i = 0; i < triangles; ++i) {
+            uint32_t base = static_cast<uint32_t>(mesh->vertices.size());
+            mesh->vertices.emplace_back(0.0, 0.0, static_cast<double>(i));
+            mesh->vertices.emplace_back(1.0, 0.0, static_cast<double>(i));
+            mesh->vertices.emplace_back(0.0, 1.0, static_cast<double>(i));
+            mesh->indices.insert(mesh->indices.end(), {base, base + 1, base + 2});
+        }
+        mesh->vertices.shrink_to_fit();
+        mesh->indices.shrink_to_fit();
+        return mesh;
+    };
+    
+    TessellationCache cache;
+    TessellationCache::Key cabinet{0x1234, 0.1, 0.1};
+    
+    SECTION("Hits share one mesh") {
+        int meshed = 0;
+        auto factory = [&]() {
+            ++meshed;
+            return makeMesh(12);
+        };
+        
+        auto first = cache.getOrCreate(cabinet, factory);
+        auto second = cache.getOrCreate(cabinet, factory);
+        
+        REQUIRE(meshed == 1);
+        REQUIRE(first == second);
+        REQUIRE(first->getTriangleCount() == 12);
+        
+        auto stats = cache.getStatistics();
+        REQUIRE(stats.hits == 1);
+        REQUIRE(stats.misses == 1);
+        REQUIRE(stats.entryCount == 1);
+        REQUIRE(stats.memoryUsage == first->getMemoryUsage());
+        REQUIRE(stats.getHitRate() == Approx(0.5));
+    }
+    
+    SECTION("Deflections are part of the key") {
+        TessellationCache::Key finer{0x1234, 0.01, 0.1};
+        cache.insert(cabinet, makeMesh(12));
+        
+        REQUIRE(cache.find(finer) == nullptr);
+        REQUIRE(cache.find(cabinet) != nullptr);
+    }
+    
+    SECTION("First insert wins") {
+        auto kept = cache.insert(cabinet, makeMesh(12));
+        auto duplicate = cache.insert(cabinet, makeMesh(4));
+        
+        REQUIRE(duplicate == kept);
+        REQUIRE(cache.getStatistics().insertions == 1);
+    }
+    
+    SECTION("Failed meshing is not cached") {
+        auto mesh = cache.getOrCreate(cabinet, []() { return std::shared_ptr<TriangleMesh>(); });
+        
+        REQUIRE(mesh == nullptr);
+        REQUIRE_FALSE(cache.contains(cabinet));
+    }
+    
+    SECTION("Least recently used entries are evicted") {
+        size_t meshBytes = makeMesh(12)->getMemoryUsage();
+        cache.setCapacity(meshBytes * 2);
+        
+        TessellationCache::Key a{1, 0.1, 0.1}, b{2, 0.1, 0.1}, c{3, 0.1, 0.1};
+        auto held = cache.insert(a, makeMesh(12));
+        cache.insert(b, makeMesh(12));
+        cache.find(a);
+        cache.insert(c, makeMesh(12));
+        
+        REQUIRE(cache.contains(a));
+        REQUIRE_FALSE(cache.contains(b));
+        REQUIRE(cache.contains(c));
+        REQUIRE(cache.getStatistics().evictions == 1);
+        REQUIRE(cache.getStatistics().memoryUsage <= cache.getCapacity());
+        
+        // Evicted meshes stay valid for their holders
+        cache.setCapacity(0);
+        REQUIRE(cache.getStatistics().entryCount == 0);
+        REQUIRE(held->getTriangleCount() == 12);
+    }
+    
+    SECTION("Meshes larger than the capacity are returned uncached") {
+        cache.setCapacity(64);
+        auto mesh = cache.insert(cabinet, makeMesh(12));
+        
+        REQUIRE(mesh != nullptr);
+        REQUIRE_FALSE(cache.contains(cabinet));
+    }
 }
\ No newline at end of file
@@ -1,9 +1,22 @@
 #include <catch2/catch_test_macros.hpp>
 #include <catch2/catch_approx.hpp>
+#include <catch2/generators/catch_generators.hpp>
 #include "../src/models/Project.h"
 #include "../src/models/CatalogItem.h"
+#include "../src/models/ShapePrototype.h"
+#include "../src/models/WallShapeCache.h"
+#include "../src/geometry/GeometryUtils.h"
+#include "../src/interfaces/IGeometryEngine.h"
+#include "../src/utils/ThreadPool.h"
+#include "../src/utils/LazyValue.h"
 #include <nlohmann/json.hpp>
+#include <algorithm>
+#include <atomic>
 #include <memory>
+#include <mutex>
+#include <stdexcept>
+#include <thread>
+#include <vector>
 
 using namespace KitchenCAD::Models;
 using namespace KitchenCAD;
@@ -309,6 +322,89 @@ TEST_CASE("Project object management", "[models][project]") {
     }
 }
 
+TEST_CASE("SceneObject pool allocation", "[models][project][pool]") {
+    SECTION("Objects outside a scope use the global heap") {
+        auto object = std::make_unique<SceneObject>("catalog_item_1");
+        REQUIRE(object->getCatalogItemId() == "catalog_item_1");
+    }
+    
+    SECTION("Project objects come from the project's pool") {
+        Project project("Test Kitchen", RoomDimensions(5.0, 3.0, 2.5));
+        auto pool = project.getObjectPool();
+        REQUIRE(pool != nullptr);
+        
+        std::vector<const SceneObject*> addresses;
+        for (int i = 0; i < 300; ++i) {
+            auto object = project.createObject("catalog_item_" + std::to_string(i));
+            addresses.push_back(object.get());
+            project.addObject(std::move(object));
+        }
+        
+        auto stats = pool->getStatistics();
+        REQUIRE(stats.allocations == 300);
+        REQUIRE(stats.liveObjects == 300);
+        REQUIRE(stats.slabCount == 2);
+        REQUIRE(stats.reservedBytes == 2 * SceneObjectPool::kBlocksPerSlab * pool->getBlockSize());
+        
+        // Addresses stay put while the project's object list grows
+        for (size_t i = 0; i < addresses.size(); ++i) {
+            REQUIRE(project.getObjects()[i].get() == addresses[i]);
+        }
+        
+        std::string removedId = project.getObjects().front()->getId();
+        REQUIRE(project.removeObject(removedId));
+        stats = pool->getStatistics();
+        REQUIRE(stats.deallocations == 1);
+        REQUIRE(stats.liveObjects == 299);
+        
+        // A freed block is reused before any new slab is taken
+        auto reused = project.createObject();
+        REQUIRE(reused.get() == addresses.front());
+        REQUIRE(pool->getStatistics().slabCount == 2);
+    }
+    
+    SECTION("Reloading reuses the slabs") {
+        Project project("Test Kitchen", RoomDimensions(5.0, 3.0, 2.5));
+        for (int i = 0; i < 100; ++i) {
+            project.addObject(project.createObject("catalog_item_1"));
+        }
+        
+        project.fromJson(project.toJson());
+        
+        auto stats = project.getObjectPool()->getStatistics();
+        REQUIRE(project.getObjectCount() == 100);
+        REQUIRE(stats.allocations == 200);
+        REQUIRE(stats.liveObjects == 100);
+        REQUIRE(stats.slabCount == 1);
+    }
+    
+    SECTION("Objects may outlive their project") {
+        std::unique_ptr<SceneObject> survivor;
+        std::weak_ptr<SceneObjectPool> weakPool;
+        {
+            Project project("Test Kitchen", RoomDimensions(5.0, 3.0, 2.5));
+            survivor = project.createObject("catalog_item_1");
+            weakPool = project.getObjectPool();
+        }
+        
+        // The owner is gone but the block remains valid until the object is destroyed
+        REQUIRE(weakPool.expired());
+        REQUIRE(survivor->getCatalogItemId() == "catalog_item_1");
+        survivor.reset();
+    }
+    
+    SECTION("Subclasses larger than a block fall back to the heap") {
+        struct LargeObject : SceneObject {
+            char payload[512] = {};
+        };
+        
+        Project project("Test Kitchen", RoomDimensions(5.0, 3.0, 2.5));
+        SceneObjectPool::Scope scope(project.getObjectPool());
+        auto object = std::make_unique<LargeObject>();
+        REQUIRE(project.getObjectPool()->getStatistics().allocations == 0);
+    }
+}
+
 TEST_CASE("Project wall management", "[models][project]") {
     SECTION("Adding and managing walls") {
         Project project("Test Kitchen", RoomDimensions(5.0, 3.0, 2.5));
@@ -1076,4 +1172,498 @@ TEST_CASE("CatalogItem utility functions", "[models][catalog][utility]") {
         REQUIRE(std::find(categories.begin(), categories.end(), "appliances") != categories.end());
         REQUIRE(std::find(categories.begin(), categories.end(), "countertops") != categories.end());
     }
+}
+
+namespace {
+
+/**
+ * @brief Axis-aligned box standing in for an OpenCascade solid
+ */
+class TestBoxShape : public Shape3D {
+public:
+    explicit TestBoxShape(const Geom::BoundingBox& box) : box_(box) {}
+    
+    Geom::BoundingBox getBoundingBox() const override { return box_; }
+    double getVolume() const override { return box_.volume(); }
+    double getSurfaceArea() const override {
+        Geom::Vector3D size = box_.size();
+        return 2.0 * (size.x * size.y + size.y * size.z + size.z * size.x);
+    }
+    
+    bool isValid() const override { return box_.isValid(); }
+    bool isClosed() const override { return true; }
+    bool isEmpty() const override { return box_.isEmpty(); }
+    
+    // Axis-aligned placements only: rotation is ignored
+    std::unique_ptr<Shape3D> transformed(const Geom::Transform3D& transform) const override {
+        Geom::Point3D min(box_.min.x * transform.scale.x, box_.min.y * transform.scale.y, box_.min.z * transform.scale.z);
+        Geom::Point3D max(box_.max.x * transform.scale.x, box_.max.y * transform.scale.y, box_.max.z * transform.scale.z);
+        Geom::Vector3D offset(transform.translation.x, transform.translation.y, transform.translation.z);
+        return std::make_unique<TestBoxShape>(Geom::BoundingBox(min + offset, max + offset));
+    }
+    void transform(const Geom::Transform3D& transform) override {
+        box_ = static_cast<TestBoxShape&>(*transformed(transform)).box_;
+    }
+    
+    bool contains(const Geom::Point3D& point) const override { return box_.contains(point); }
+    double distanceTo(const Geom::Point3D&) const override { return 0.0; }
+    double distanceTo(const Shape3D&) const override { return 0.0; }
+    bool intersects(const Shape3D& other) const override { return box_.intersects(other.getBoundingBox()); }
+    bool intersects(const Geom::BoundingBox& box) const override { return box_.intersects(box); }
+    
+    std::unique_ptr<Shape3D> clone() const override { return std::make_unique<TestBoxShape>(box_); }
+    std::string getType() const override { return "Solid"; }
+    
+    bool serialize(const std::string&) const override { return false; }
+    bool deserialize(const std::string&) override { return false; }
+    
+private:
+    Geom::BoundingBox box_;
+};
+
+/**
+ * @brief Engine answering queries from TestBoxShape bounds
+ */
+class TestGeometryEngine : public IGeometryEngine {
+public:
+    std::unique_ptr<Shape3D> createBox(const Geom::Point3D& origin, double width, double height, double depth) override {
+        return std::make_unique<TestBoxShape>(
+            Geom::BoundingBox(origin, Geom::Point3D(origin.x + width, origin.y + height, origin.z + depth)));
+    }
+    std::unique_ptr<Shape3D> createCylinder(const Geom::Point3D&, double, double) override { return nullptr; }
+    std::unique_ptr<Shape3D> createSphere(const Geom::Point3D&, double) override { return nullptr; }
+    std::unique_ptr<Shape3D> createCone(const Geom::Point3D&, double, double, double) override { return nullptr; }
+    
+    bool performBoolean(Shape3D&, const Shape3D&, BooleanOperation) override { return false; }
+    
+    std::vector<Face> getFaces(const Shape3D&) override { return {}; }
+    Geom::BoundingBox getBoundingBox(const Shape3D& shape) override { return shape.getBoundingBox(); }
+    double getVolume(const Shape3D& shape) override { return shape.getVolume(); }
+    double getSurfaceArea(const Shape3D& shape) override { return shape.getSurfaceArea(); }
+    
+    bool intersects(const Shape3D& shape1, const Shape3D& shape2) override { return shape1.intersects(shape2); }
+    double distanceBetween(const Shape3D& shape1, const Shape3D& shape2) override {
+        return shape1.getBoundingBox().center().distanceTo(shape2.getBoundingBox().center());
+    }
+    
+    std::unique_ptr<Shape3D> transform(const Shape3D& shape, const Geom::Transform3D& transform) override {
+        return shape.transformed(transform);
+    }
+    
+    bool isValidShape(const Shape3D& shape) override { return shape.isValid(); }
+    bool isClosed(const Shape3D& shape) override { return shape.isClosed(); }
+};
+
+ShapePrototypeRegistry::Builder testBoxBuilder(int& builds) {
+    return [&builds](const ShapePrototypeKey& key) {
+        ++builds;
+        return std::make_unique<TestBoxShape>(key.dimensions.toBoundingBox());
+    };
+}
+
+} // namespace
+
+TEST_CASE("ShapePrototypeRegistry sharing", "[models][prototype]") {
+    int builds = 0;
+    ShapePrototypeRegistry registry(testBoxBuilder(builds));
+    
+    CatalogItem baseUnit("base_60", "Base Unit 60", "base_cabinets");
+    baseUnit.setDimensions(Dimensions3D(0.6, 0.85, 0.58));
+    
+    SECTION("Placements of one item share a prototype") {
+        std::vector<std::unique_ptr<SceneObject>> placements;
+        for (int i = 0; i < 40; ++i) {
+            auto object = std::make_unique<SceneObject>(baseUnit.getId());
+            object->setTransform(Geom::Transform3D(Geom::Point3D(0.6 * i, 0.0, 0.0)));
+            object->setShapePrototype(registry.acquire(baseUnit));
+            placements.push_back(std::move(object));
+        }
+        
+        REQUIRE(builds == 1);
+        REQUIRE(registry.size() == 1);
+        REQUIRE(placements.front()->getShapePrototype() == placements.back()->getShapePrototype());
+        
+        auto stats = registry.getStatistics();
+        REQUIRE(stats.builds == 1);
+        REQUIRE(stats.hits == 39);
+        
+        // Copies share it too
+        SceneObject copy = *placements.front();
+        REQUIRE(copy.getShapePrototype() == placements.front()->getShapePrototype());
+    }
+    
+    SECTION("Dimensions are part of the key") {
+        auto standard = registry.acquire(ShapePrototypeKey("base_60", Dimensions3D(0.6, 0.85, 0.58)));
+        auto converted = registry.acquire(ShapePrototypeKey("base_60", Dimensions3D(0.6 + 1e-9, 0.85, 0.58)));
+        auto wider = registry.acquire(ShapePrototypeKey("base_60", Dimensions3D(0.8, 0.85, 0.58)));
+        auto otherItem = registry.acquire(ShapePrototypeKey("wall_60", Dimensions3D(0.6, 0.85, 0.58)));
+        
+        REQUIRE(standard == converted);
+        REQUIRE(standard != wider);
+        REQUIRE(standard != otherItem);
+        REQUIRE(builds == 3);
+    }
+    
+    SECTION("Invalid dimensions and failed builds give no prototype") {
+        REQUIRE(registry.acquire(ShapePrototypeKey("base_60", Dimensions3D())) == nullptr);
+        REQUIRE(builds == 0);
+        
+        ShapePrototypeRegistry failing([](const ShapePrototypeKey&) { return std::unique_ptr<Shape3D>(); });
+        REQUIRE(failing.acquire(baseUnit) == nullptr);
+        REQUIRE(failing.getStatistics().failedBuilds == 1);
+        REQUIRE(failing.size() == 0);
+    }
+    
+    SECTION("Unused prototypes are purged") {
+        auto kept = registry.acquire(baseUnit);
+        registry.acquire(ShapePrototypeKey("wall_60", Dimensions3D(0.6, 0.7, 0.35)));
+        
+        REQUIRE(registry.purgeUnused() == 1);
+        REQUIRE(registry.find(kept->getKey()) == kept);
+        REQUIRE(registry.find(ShapePrototypeKey("wall_60", Dimensions3D(0.6, 0.7, 0.35))) == nullptr);
+    }
+}
+
+TEST_CASE("ShapePrototype placement queries", "[models][prototype]") {
+    int builds = 0;
+    ShapePrototypeRegistry registry(testBoxBuilder(builds));
+    auto prototype = registry.acquire(ShapePrototypeKey("base_60", Dimensions3D(0.6, 0.85, 0.58)));
+    REQUIRE(prototype != nullptr);
+    
+    SECTION("Cached properties") {
+        REQUIRE(prototype->getVolume() == Approx(0.6 * 0.85 * 0.58));
+        REQUIRE(prototype->getSurfaceArea() == Approx(2.0 * (0.6 * 0.85 + 0.85 * 0.58 + 0.58 * 0.6)));
+        REQUIRE(prototype->getLocalBounds().max.x == Approx(0.6));
+    }
+    
+    SECTION("Rigid and uniformly scaled placements") {
+        Geom::Transform3D rigid(Geom::Point3D(2.0, 1.0, 0.0), Geom::Vector3D(0.0, 0.0, 1.2));
+        REQUIRE(prototype->getVolume(rigid) == Approx(prototype->getVolume()));
+        REQUIRE(prototype->getSurfaceArea(rigid) == Approx(prototype->getSurfaceArea()));
+        
+        Geom::Transform3D doubled(Geom::Point3D(), Geom::Vector3D(), Geom::Vector3D(2.0, 2.0, 2.0));
+        REQUIRE(prototype->getVolume(doubled) == Approx(8.0 * prototype->getVolume()));
+        REQUIRE(prototype->getSurfaceArea(doubled) == Approx(4.0 * prototype->getSurfaceArea()));
+    }
+    
+    SECTION("Non-uniform scale measures the placed shape") {
+        Geom::Transform3D stretched(Geom::Point3D(), Geom::Vector3D(), Geom::Vector3D(2.0, 1.0, 1.0));
+        REQUIRE(prototype->getVolume(stretched) == Approx(2.0 * prototype->getVolume()));
+        REQUIRE(prototype->getSurfaceArea(stretched) == Approx(2.0 * (1.2 * 0.85 + 0.85 * 0.58 + 0.58 * 1.2)));
+    }
+    
+    SECTION("World bounds and instantiation") {
+        Geom::Transform3D placement(Geom::Point3D(3.0, 0.0, 0.0), Geom::Vector3D(0.0, 0.0, Geom::GeometryUtils::PI / 2.0));
+        Geom::BoundingBox bounds = prototype->getBoundingBox(placement.toMatrix());
+        REQUIRE(bounds.min.x == Approx(3.0 - 0.85));
+        REQUIRE(bounds.max.x == Approx(3.0).margin(1e-12));
+        REQUIRE(bounds.max.y == Approx(0.6));
+        
+        auto placed = prototype->instantiate(Geom::Transform3D(Geom::Point3D(1.0, 0.0, 0.0)));
+        REQUIRE(placed->getBoundingBox().min.x == Approx(1.0));
+        REQUIRE(prototype->getLocalBounds().min.x == Approx(0.0));
+    }
+}
+
+TEST_CASE("ThreadPool parallelFor", "[utils][threadpool]") {
+    auto threads = GENERATE(1, 4, 16);
+    Utils::ThreadPool pool(threads);
+    REQUIRE(pool.getThreadCount() == static_cast<size_t>(threads));
+    
+    SECTION("Every index is visited once") {
+        std::vector<int> visits(1000, 0);
+        pool.parallelFor(visits.size(), [&](size_t begin, size_t end) {
+            for (size_t i = begin; i < end; ++i) {
+                ++visits[i];
+            }
+        }, 7);
+        
+        REQUIRE(std::all_of(visits.begin(), visits.end(), [](int count) { return count == 1; }));
+    }
+    
+    SECTION("Nested loops complete") {
+        std::atomic<int> total{0};
+        pool.parallelFor(8, [&](size_t begin, size_t end) {
+            for (size_t i = begin; i < end; ++i) {
+                pool.parallelFor(100, [&](size_t innerBegin, size_t innerEnd) {
+                    total += static_cast<int>(innerEnd - innerBegin);
+                });
+            }
+        }, 1);
+        
+        REQUIRE(total == 800);
+    }
+    
+    SECTION("Exceptions reach the caller after all chunks ran") {
+        std::atomic<int> visited{0};
+        REQUIRE_THROWS_AS(pool.parallelFor(10, [&](size_t begin, size_t end) {
+            visited += static_cast<int>(end - begin);
+            if (begin <= 3 && 3 < end) throw std::runtime_error("chunk failed");
+        }, 1), std::runtime_error);
+        REQUIRE(visited == 10);
+    }
+}
+
+TEST_CASE("LazyValue concurrent initialization", "[utils][lazy]") {
+    constexpr int kThreads = 8;
+    
+    SECTION("Concurrent readers compute the value once") {
+        for (int round = 0; round < 50; ++round) {
+            Utils::LazyValue<std::vector<int>> value;
+            std::atomic<int> computations{0};
+            std::atomic<bool> go{false};
+            std::atomic<int> mismatches{0};
+            
+            std::vector<std::thread> threads;
+            for (int t = 0; t < kThreads; ++t) {
+                threads.emplace_back([&]() {
+                    while (!go.load()) std::this_thread::yield();
+                    const auto& result = value.get([&]() {
+                        ++computations;
+                        return std::vector<int>(64, round);
+                    });
+                    if (result.size() != 64 || result.back() != round) ++mismatches;
+                });
+            }
+            go = true;
+            for (auto& thread : threads) thread.join();
+            
+            REQUIRE(computations == 1);
+            REQUIRE(mismatches == 0);
+            REQUIRE(value.isReady());
+        }
+    }
+    
+    SECTION("A failed computation is retried") {
+        Utils::LazyValue<int> value;
+        REQUIRE_THROWS_AS(value.get([]() -> int { throw std::runtime_error("failed"); }), std::runtime_error);
+        REQUIRE_FALSE(value.isReady());
+        
+        std::atomic<int> computations{0};
+        std::vector<std::thread> threads;
+        for (int t = 0; t < kThreads; ++t) {
+            threads.emplace_back([&]() {
+                value.get([&]() { ++computations; return 42; });
+            });
+        }
+        for (auto& thread : threads) thread.join();
+        
+        REQUIRE(computations == 1);
+        REQUIRE(value.get([]() { return 0; }) == 42);
+    }
+    
+    SECTION("Copies keep ready values and reset forgets them") {
+        Utils::LazyValue<int> value;
+        Utils::LazyValue<int> emptyCopy(value);
+        value.get([]() { return 7; });
+        Utils::LazyValue<int> readyCopy(value);
+        
+        REQUIRE_FALSE(emptyCopy.isReady());
+        REQUIRE(readyCopy.get([]() { return 0; }) == 7);
+        
+        value.reset();
+        REQUIRE(value.get([]() { return 9; }) == 9);
+    }
+}
+
+TEST_CASE("IGeometryEngine batch queries", "[geometry][batch]") {
+    TestGeometryEngine engine;
+    Utils::ThreadPool pool(4);
+    
+    std::vector<std::unique_ptr<Shape3D>> shapes;
+    for (int i = 0; i < 50; ++i) {
+        shapes.push_back(engine.createBox(Geom::Point3D(0.5 * i, 0.0, 0.0), 0.6, 0.85, 0.58));
+    }
+    std::vector<const Shape3D*> shapePointers;
+    for (const auto& shape : shapes) {
+        shapePointers.push_back(shape.get());
+    }
+    
+    SECTION("Properties in input order") {
+        std::vector<ShapeProperties> properties = engine.computeProperties(shapePointers, pool);
+        
+        REQUIRE(properties.size() == shapes.size());
+        for (size_t i = 0; i < shapes.size(); ++i) {
+            REQUIRE(properties[i].volume == Approx(shapes[i]->getVolume()));
+            REQUIRE(properties[i].surfaceArea == Approx(shapes[i]->getSurfaceArea()));
+            REQUIRE(properties[i].boundingBox == shapes[i]->getBoundingBox());
+        }
+    }
+    
+    SECTION("Pairs match the per-pair calls") {
+        std::vector<ShapePair> pairs;
+        for (size_t i = 0; i < shapes.size(); ++i) {
+            for (size_t j = i + 1; j < shapes.size(); ++j) {
+                pairs.emplace_back(shapes[i].get(), shapes[j].get());
+            }
+        }
+        
+        std::vector<bool> hits = engine.intersectsPairs(pairs, pool);
+        std::vector<double> distances = engine.distancesBetween(pairs);
+        
+        REQUIRE(hits.size() == pairs.size());
+        REQUIRE(distances.size() == pairs.size());
+        for (size_t i = 0; i < pairs.size(); ++i) {
+            REQUIRE(hits[i] == engine.intersects(*pairs[i].first, *pairs[i].second));
+            REQUIRE(distances[i] == engine.distanceBetween(*pairs[i].first, *pairs[i].second));
+        }
+        
+        // Neighbours 0.5 apart overlap, boxes two steps apart do not
+        REQUIRE(hits[0]);
+        REQUIRE_FALSE(hits[1]);
+    }
+    
+    SECTION("Empty batches") {
+        REQUIRE(engine.computeProperties(std::span<const Shape3D* const>(), pool).empty());
+        REQUIRE(engine.intersectsPairs(std::span<const ShapePair>(), pool).empty());
+    }
+}
+
+namespace {
+
+/**
+ * @brief Engine recording batch cuts; shapes keep their bounds
+ */
+class CutRecordingEngine : public TestGeometryEngine {
+public:
+    bool performBooleanBatch(Shape3D&, std::span<const Shape3D* const> tools, BooleanOperation op) override {
+        std::lock_guard<std::mutex> lock(mutex);
+        ++batchCalls;
+        lastOperation = op;
+        lastTools.clear();
+        for (const Shape3D* tool : tools) {
+            lastTools.push_back(tool->getBoundingBox());
+        }
+        return true;
+    }
+    
+    std::mutex mutex;
+    int batchCalls = 0;
+    BooleanOperation lastOperation = BooleanOperation::Union;
+    std::vector<Geom::BoundingBox> lastTools;
+};
+
+} // namespace
+
+TEST_CASE("WallShapeCache cuts openings in one batch", "[models][wall][boolean]") {
+    CutRecordingEngine engine;
+    WallShapeCache cache(engine);
+    
+    Wall wall("wall_1", Geom::Point3D(0, 0, 0), Geom::Point3D(5, 0, 0), 2.5, 0.1);
+    std::vector<Opening> openings = {
+        Opening("window_1", "wall_1", "window", 0.2, 1.2, 1.0, 1.0),
+        Opening("door_1", "wall_1", "door", 0.5, 0.8, 2.0, 0.0),
+        Opening("door_2", "wall_2", "door", 0.5, 0.8, 2.0, 0.0)
+    };
+    
+    SECTION("All openings of the wall go to one boolean") {
+        auto shape = cache.getWallShape(wall, openings);
+        
+        REQUIRE(shape != nullptr);
+        REQUIRE(engine.batchCalls == 1);
+        REQUIRE(engine.lastOperation == BooleanOperation::Difference);
+        REQUIRE(engine.lastTools.size() == 2);
+        
+        // Ordered by id: the door, centred on the wall, cuts through both faces
+        const Geom::BoundingBox& door = engine.lastTools[0];
+        REQUIRE(door.min.x == Approx(2.1));
+        REQUIRE(door.max.x == Approx(2.9));
+        REQUIRE(door.min.y == Approx(-0.05 - WallShapeCache::kToolOvershoot));
+        REQUIRE(door.max.y == Approx(0.05 + WallShapeCache::kToolOvershoot));
+        REQUIRE(door.min.z == Approx(0.0));
+        REQUIRE(door.max.z == Approx(2.0));
+        REQUIRE(engine.lastTools[1].min.z == Approx(1.0));
+        
+        REQUIRE(shape->getBoundingBox().max.x == Approx(5.0));
+        REQUIRE(shape->getBoundingBox().max.z == Approx(2.5));
+    }
+    
+    SECTION("Unchanged walls reuse the cut shape") {
+        auto first = cache.getWallShape(wall, openings);
+        std::reverse(openings.begin(), openings.end());
+        auto second = cache.getWallShape(wall, openings);
+        
+        REQUIRE(first == second);
+        REQUIRE(engine.batchCalls == 1);
+        REQUIRE(cache.getStatistics().hits == 1);
+        REQUIRE(cache.getStatistics().builds == 1);
+    }
+    
+    SECTION("Editing the wall or one of its openings rebuilds it") {
+        auto first = cache.getWallShape(wall, openings);
+        
+        openings[2].width = 1.0;  // Another wall's opening
+        REQUIRE(cache.getWallShape(wall, openings) == first);
+        
+        openings[1].width = 0.9;
+        auto widened = cache.getWallShape(wall, openings);
+        REQUIRE(widened != first);
+        REQUIRE(engine.batchCalls == 2);
+        
+        wall.height = 2.7;
+        auto taller = cache.getWallShape(wall, openings);
+        REQUIRE(taller != widened);
+        REQUIRE(engine.batchCalls == 3);
+        REQUIRE(cache.size() == 1);
+    }
+    
+    SECTION("Walls without openings need no boolean") {
+        Wall plain("wall_3", Geom::Point3D(0, 0, 0), Geom::Point3D(3, 0, 0), 2.5, 0.1);
+        REQUIRE(cache.getWallShape(plain, openings) != nullptr);
+        REQUIRE(engine.batchCalls == 0);
+    }
+    
+    SECTION("Invalid walls are not cached") {
+        Wall degenerate("wall_1", Geom::Point3D(0, 0, 0), Geom::Point3D(0, 0, 0), 2.5, 0.1);
+        REQUIRE(cache.getWallShape(degenerate, openings) == nullptr);
+        REQUIRE(cache.getStatistics().failedBuilds == 1);
+        REQUIRE(cache.size() == 0);
+    }
+}
+
+TEST_CASE("WallShapeCache project walls", "[models][wall][boolean]") {
+    auto threads = GENERATE(1, 4);
+    Utils::ThreadPool pool(threads);
+    CutRecordingEngine engine;
+    WallShapeCache cache(engine);
+    
+    Project project("Test Kitchen", RoomDimensions(5.0, 2.5, 3.0));
+    for (int i = 0; i < 6; ++i) {
+        std::string id = "wall_" + std::to_string(i);
+        project.addWall(Wall(id, Geom::Point3D(0, i, 0), Geom::Point3D(4, i, 0), 2.5, 0.1));
+        project.addOpening(Opening("window_" + std::to_string(i), id, "window", 0.5, 1.0, 1.0, 1.0));
+    }
+    
+    auto shapes = cache.getWallShapes(project, pool);
+    REQUIRE(shapes.size() == 6);
+    REQUIRE(std::all_of(shapes.begin(), shapes.end(), [](const auto& shape) { return shape != nullptr; }));
+    REQUIRE(engine.batchCalls == 6);
+    
+    SECTION("Only changed walls are rebuilt") {
+        project.getOpening("window_3")->sillHeight = 0.9;
+        auto updated = cache.getWallShapes(project, pool);
+        
+        REQUIRE(engine.batchCalls == 7);
+        REQUIRE(cache.getStatistics().hits == 5);
+        for (size_t i = 0; i < shapes.size(); ++i) {
+            REQUIRE((updated[i] == shapes[i]) == (i != 3));
+        }
+    }
+    
+    SECTION("Removed walls are purged") {
+        project.removeWall("wall_0");
+        project.removeWall("wall_5");
+        REQUIRE(cache.purgeRemoved(project) == 2);
+        REQUIRE(cache.size() == 4);
+    }
+    
+    SECTION("Batches fall back to one boolean per tool") {
+        TestGeometryEngine sequential;
+        auto target = sequential.createBox(Geom::Point3D(0, 0, 0), 1.0, 1.0, 1.0);
+        const Shape3D* tool = target.get();
+        
+        REQUIRE(sequential.performBooleanBatch(*target, std::span<const Shape3D* const>(), BooleanOperation::Difference));
+        REQUIRE_FALSE(sequential.performBooleanBatch(*target, std::span<const Shape3D* const>(&tool, 1),
+                                                     BooleanOperation::Difference));
+    }
 }
\ No newline at end of file
@@ -4,6 +4,10 @@
 #include <catch2/catch_approx.hpp>
 #include "../src/geometry/OpenCascadeGeometryEngine.h"
 #include "../src/geometry/OCCTShape3D.h"
+#include "../src/geometry/TessellationCache.h"
+#include <atomic>
+#include <thread>
+#include <vector>
 
 using namespace KitchenCAD;
 using namespace KitchenCAD::Geometry;
@@ -501,4 +505,146 @@ TEST_CASE("OpenCascadeGeometryEngine - Multiple Shape Operations", "[opencascade
     }
 }
 
+TEST_CASE("OpenCascadeGeometryEngine - Tessellation Cache", "[opencascade][geometry][tessellation]") {
+    OpenCascadeGeometryEngine engine;
+    TessellationCache cache;
+    engine.setTessellationCache(cache);
+    
+    SECTION("Identical shapes are meshed once") {
+        auto cabinet1 = engine.createBox(Point3D(0.0, 0.0, 0.0), 0.6, 0.58, 0.9);
+        auto cabinet2 = engine.createBox(Point3D(0.0, 0.0, 0.0), 0.6, 0.58, 0.9);
+        
+        auto mesh1 = engine.meshShape(*cabinet1);
+        auto mesh2 = engine.meshShape(*cabinet2);
+        
+        REQUIRE(mesh1 != nullptr);
+        REQUIRE(mesh1 == mesh2);
+        REQUIRE(mesh1->getTriangleCount() == 12);  // Two per box face
+        REQUIRE(cache.getStatistics().hits == 1);
+        REQUIRE(cache.getStatistics().misses == 1);
+    }
+    
+    SECTION("Placed copies share the local mesh") {
+        auto cabinet = engine.createBox(Point3D(0.0, 0.0, 0.0), 0.6, 0.58, 0.9);
+        auto placed = engine.transform(*cabinet, Transform3D(Point3D(3.0, 1.0, 0.0)));
+        
+        auto* occCabinet = dynamic_cast<OCCTShape3D*>(cabinet.get());
+        auto* occPlaced = dynamic_cast<OCCTShape3D*>(placed.get());
+        REQUIRE(occCabinet->getGeometryHash() == occPlaced->getGeometryHash());
+        REQUIRE(engine.meshShape(*cabinet) == engine.meshShape(*placed));
+        
+        Matrix4x4 location = occPlaced->getLocationMatrix();
+        REQUIRE(location(0, 3) == Approx(3.0));
+        REQUIRE(location(1, 3) == Approx(1.0));
+    }
+    
+    SECTION("Different dimensions and deflections mesh separately") {
+        auto cabinet = engine.createBox(Point3D(0.0, 0.0, 0.0), 0.6, 0.58, 0.9);
+        auto wider = engine.createBox(Point3D(0.0, 0.0, 0.0), 0.8, 0.58, 0.9);
+        
+        REQUIRE(engine.meshShape(*cabinet) != engine.meshShape(*wider));
+        REQUIRE(engine.meshShape(*cabinet, 0.1) != engine.meshShape(*cabinet, 0.01));
+        REQUIRE(cache.getStatistics().entryCount == 3);
+    }
+}
+
+TEST_CASE("OpenCascadeGeometryEngine - Concurrent Property Queries", "[opencascade][geometry][threading]") {
+    OpenCascadeGeometryEngine engine;
+    auto makeShape = [&engine]() {
+        auto shape = engine.createBox(Point3D(0.0, 0.0, 0.0), 2.0, 3.0, 4.0);
+        auto cylinder = engine.createCylinder(Point3D(2.0, 1.5, 0.0), 1.0, 6.0);
+        engine.performBoolean(*shape, *cylinder, BooleanOperation::Union);
+        return shape;
+    };
+    
+    // Reference values come from a second shape so the shared one starts with empty caches
+    auto shared = makeShape();
+    auto reference = makeShape();
+    REQUIRE(shared != nullptr);
+    double expectedVolume = reference->getVolume();
+    double expectedArea = reference->getSurfaceArea();
+    BoundingBox expectedBounds = reference->getBoundingBox();
+    
+    constexpr int kThreads = 8;
+    std::atomic<bool> go{false};
+    std::atomic<int> mismatches{0};
+    
+    std::vector<std::thread> threads;
+    for (int t = 0; t < kThreads; ++t) {
+        threads.emplace_back([&, t]() {
+            while (!go.load()) std::this_thread::yield();
+            for (int i = 0; i < 100; ++i) {
+                // Vary the order so threads race on different caches first
+                switch ((t + i) % 3) {
+                    case 0: if (shared->getVolume() != expectedVolume) ++mismatches; break;
+                    case 1: if (shared->getSurfaceArea() != expectedArea) ++mismatches; break;
+                    default: if (!(shared->getBoundingBox().max == expectedBounds.max)) ++mismatches; break;
+                }
+            }
+        });
+    }
+    go = true;
+    for (auto& thread : threads) thread.join();
+    
+    REQUIRE(mismatches == 0);
+}
+
+TEST_CASE("OpenCascadeGeometryEngine - Batch Boolean Operations", "[opencascade][geometry][boolean]") {
+    OpenCascadeGeometryEngine engine;
+    
+    // A 4 x 0.1 x 2.5 wall with two openings cut through it
+    auto makeWall = [&engine]() { return engine.createBox(Point3D(0.0, 0.0, 0.0), 4.0, 0.1, 2.5); };
+    auto door = engine.createBox(Point3D(0.5, -0.01, 0.0), 0.8, 0.12, 2.0);
+    auto window = engine.createBox(Point3D(2.0, -0.01, 1.0), 1.2, 0.12, 1.0);
+    std::vector<const Shape3D*> tools = {door.get(), window.get()};
+    
+    double expectedVolume = 4.0 * 0.1 * 2.5 - 0.8 * 0.1 * 2.0 - 1.2 * 0.1 * 1.0;
+    
+    SECTION("Difference with all tools at once") {
+        auto wall = makeWall();
+        REQUIRE(engine.performBooleanBatch(*wall, tools, BooleanOperation::Difference));
+        REQUIRE(wall->getVolume() == Approx(expectedVolume));
+        REQUIRE(wall->isValid());
+        
+        // The tools are left untouched
+        REQUIRE(door->getVolume() == Approx(0.8 * 0.12 * 2.0));
+    }
+    
+    SECTION("Matches cutting one tool at a time") {
+        auto batched = makeWall();
+        auto sequential = makeWall();
+        
+        REQUIRE(engine.performBooleanBatch(*batched, tools, BooleanOperation::Difference));
+        for (const Shape3D* tool : tools) {
+            REQUIRE(engine.performBoolean(*sequential, *tool, BooleanOperation::Difference));
+        }
+        
+        REQUIRE(batched->getVolume() == Approx(sequential->getVolume()));
+        REQUIRE(batched->getSurfaceArea() == Approx(sequential->getSurfaceArea()));
+    }
+    
+    SECTION("Flush tools cut cleanly with a fuzzy value") {
+        auto wall = makeWall();
+        auto flushDoor = engine.createBox(Point3D(0.5, 0.0, 0.0), 0.8, 0.1, 2.0);
+        std::vector<const Shape3D*> flushTools = {flushDoor.get(), window.get()};
+        
+        REQUIRE(engine.getBooleanFuzzyValue() > 0.0);
+        REQUIRE(engine.performBooleanBatch(*wall, flushTools, BooleanOperation::Difference));
+        REQUIRE(wall->getVolume() == Approx(expectedVolume));
+    }
+    
+    SECTION("Empty and invalid tool lists") {
+        auto wall = makeWall();
+        double volume = wall->getVolume();
+        
+        REQUIRE(engine.performBooleanBatch(*wall, std::span<const Shape3D* const>(), BooleanOperation::Difference));
+        REQUIRE(wall->getVolume() == Approx(volume));
+        
+        OCCTShape3D empty{TopoDS_Shape()};
+        std::vector<const Shape3D*> badTools = {door.get(), &empty};
+        REQUIRE_FALSE(engine.performBooleanBatch(*wall, badTools, BooleanOperation::Difference));
+        REQUIRE(wall->getVolume() == Approx(volume));
+    }
+}
+
 #endif // HAVE_OPENCASCADE
\ No newline at end of file
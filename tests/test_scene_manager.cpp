@@ -1,6 +1,20 @@
 #include <catch2/catch_test_macros.hpp>
 #include <catch2/catch_approx.hpp>
+#include <catch2/generators/catch_generators.hpp>
 #include "../src/scene/SceneManager.h"
+#include "../src/scene/PartitionedSceneManager.h"
+#include "../src/scene/DynamicAABBTree.h"
+#include "../src/scene/HierarchicalGridIndex.h"
+#include "../src/scene/SweepAndPrune.h"
+#include "../src/scene/SceneSnapshot.h"
+#include "../src/scene/BoundsSoA.h"
+#include <random>
+#include <map>
+#include <set>
+#include <thread>
+#include <atomic>
+#include <algorithm>
+#include <limits>
 #include "../src/models/Project.h"
 
 using namespace KitchenCAD;
@@ -479,41 +493,42 @@ TEST_CASE("SceneManager - Statistics and Validation", "[scene][manager][stats]")
 
 TEST_CASE("SpatialIndex - Basic Operations", "[scene][spatial][index]") {
     SpatialIndex spatialIndex(1.0);
+    ObjectHandle obj1(1, 0), obj2(2, 0), obj3(3, 0);
     
     BoundingBox box1(Point3D(0.0, 0.0, 0.0), Point3D(1.0, 1.0, 1.0));
     BoundingBox box2(Point3D(2.0, 0.0, 0.0), Point3D(3.0, 1.0, 1.0));
     BoundingBox box3(Point3D(0.5, 0.5, 0.5), Point3D(1.5, 1.5, 1.5));
     
     SECTION("Add and query objects") {
-        spatialIndex.addObject("obj1", box1);
-        spatialIndex.addObject("obj2", box2);
-        spatialIndex.addObject("obj3", box3);
+        spatialIndex.addObject(obj1, box1);
+        spatialIndex.addObject(obj2, box2);
+        spatialIndex.addObject(obj3, box3);
         
         BoundingBox queryRegion(Point3D(-0.5, -0.5, -0.5), Point3D(1.5, 1.5, 1.5));
         auto results = spatialIndex.queryRegion(queryRegion);
         
         REQUIRE(results.size() >= 1);  // Should find at least obj1
         
-        bool foundObj1 = std::find(results.begin(), results.end(), "obj1") != results.end();
+        bool foundObj1 = std::find(results.begin(), results.end(), obj1) != results.end();
         REQUIRE(foundObj1);
     }
     
     SECTION("Remove objects") {
-        spatialIndex.addObject("obj1", box1);
-        spatialIndex.addObject("obj2", box2);
+        spatialIndex.addObject(obj1, box1);
+        spatialIndex.addObject(obj2, box2);
         
-        spatialIndex.removeObject("obj1", box1);
+        spatialIndex.removeObject(obj1, box1);
         
         BoundingBox queryRegion(Point3D(-0.5, -0.5, -0.5), Point3D(1.5, 1.5, 1.5));
         auto results = spatialIndex.queryRegion(queryRegion);
         
-        bool foundObj1 = std::find(results.begin(), results.end(), "obj1") != results.end();
+        bool foundObj1 = std::find(results.begin(), results.end(), obj1) != results.end();
         REQUIRE(!foundObj1);
     }
     
     SECTION("Query radius") {
-        spatialIndex.addObject("obj1", box1);
-        spatialIndex.addObject("obj2", box2);
+        spatialIndex.addObject(obj1, box1);
+        spatialIndex.addObject(obj2, box2);
         
         Point3D center(0.5, 0.5, 0.5);
         auto results = spatialIndex.queryRadius(center, 1.0);
@@ -522,8 +537,8 @@ TEST_CASE("SpatialIndex - Basic Operations", "[scene][spatial][index]") {
     }
     
     SECTION("Clear index") {
-        spatialIndex.addObject("obj1", box1);
-        spatialIndex.addObject("obj2", box2);
+        spatialIndex.addObject(obj1, box1);
+        spatialIndex.addObject(obj2, box2);
         
         spatialIndex.clear();
         
@@ -562,4 +577,1549 @@ TEST_CASE("CollisionDetector - Collision Detection", "[scene][collision][detecto
         bool wouldCollide = CollisionDetector::wouldCollide(box1, transform, otherBounds);
         REQUIRE(wouldCollide);  // Should collide with box2
     }
+}
+
+TEST_CASE("HashedGridIndex - Basic Operations", "[scene][spatial][index]") {
+    HashedGridIndex spatialIndex(0.5);
+    ObjectHandle obj1(1, 0), obj2(2, 0), obj3(3, 0);
+    
+    BoundingBox box1(Point3D(0.0, 0.0, 0.0), Point3D(1.0, 1.0, 1.0));
+    BoundingBox box2(Point3D(2.0, 0.0, 0.0), Point3D(3.0, 1.0, 1.0));
+    BoundingBox box3(Point3D(-1.5, -1.5, -1.5), Point3D(-0.5, -0.5, -0.5));
+    
+    SECTION("Add and query objects") {
+        spatialIndex.addObject(obj1, box1);
+        spatialIndex.addObject(obj2, box2);
+        spatialIndex.addObject(obj3, box3);
+        
+        auto results = spatialIndex.queryRegion(BoundingBox(Point3D(0.2, 0.2, 0.2), Point3D(0.4, 0.4, 0.4)));
+        REQUIRE(results.size() == 1);
+        REQUIRE(results[0] == obj1);
+        
+        auto negativeResults = spatialIndex.queryRegion(BoundingBox(Point3D(-1.0, -1.0, -1.0), Point3D(-0.9, -0.9, -0.9)));
+        REQUIRE(negativeResults.size() == 1);
+        REQUIRE(negativeResults[0] == obj3);
+    }
+    
+    SECTION("Results are unique") {
+        spatialIndex.addObject(obj1, box1);
+        
+        auto results = spatialIndex.queryRegion(BoundingBox(Point3D(-10.0, -10.0, -10.0), Point3D(10.0, 10.0, 10.0)));
+        REQUIRE(results.size() == 1);
+    }
+    
+    SECTION("Update moves object between cells") {
+        spatialIndex.addObject(obj1, box1);
+        spatialIndex.updateObject(obj1, box1, box2);
+        
+        auto oldResults = spatialIndex.queryRegion(BoundingBox(Point3D(0.2, 0.2, 0.2), Point3D(0.4, 0.4, 0.4)));
+        REQUIRE(oldResults.empty());
+        
+        auto newResults = spatialIndex.queryRegion(BoundingBox(Point3D(2.2, 0.2, 0.2), Point3D(2.4, 0.4, 0.4)));
+        REQUIRE(newResults.size() == 1);
+        REQUIRE(newResults[0] == obj1);
+    }
+    
+    SECTION("Remove and clear") {
+        spatialIndex.addObject(obj1, box1);
+        spatialIndex.addObject(obj2, box2);
+        
+        spatialIndex.removeObject(obj1, box1);
+        auto results = spatialIndex.queryRegion(BoundingBox(Point3D(-10.0, -10.0, -10.0), Point3D(10.0, 10.0, 10.0)));
+        REQUIRE(results.size() == 1);
+        REQUIRE(results[0] == obj2);
+        
+        spatialIndex.clear();
+        REQUIRE(spatialIndex.getCellCount() == 0);
+        REQUIRE(spatialIndex.queryRegion(BoundingBox(Point3D(-10.0, -10.0, -10.0), Point3D(10.0, 10.0, 10.0))).empty());
+    }
+    
+    SECTION("Many objects per cell and table growth") {
+        for (int i = 0; i < 500; ++i) {
+            double offset = (i % 50) * 0.5;
+            spatialIndex.addObject(ObjectHandle(i, 0),
+                                   BoundingBox(Point3D(offset, 0.0, 0.0), Point3D(offset + 0.1, 0.1, 0.1)));
+        }
+        
+        auto results = spatialIndex.queryRegion(BoundingBox(Point3D(0.0, 0.0, 0.0), Point3D(0.1, 0.1, 0.1)));
+        REQUIRE(results.size() == 10);
+        
+        for (int i = 0; i < 500; i += 2) {
+            double offset = (i % 50) * 0.5;
+            spatialIndex.removeObject(ObjectHandle(i, 0),
+                                      BoundingBox(Point3D(offset, 0.0, 0.0), Point3D(offset + 0.1, 0.1, 0.1)));
+        }
+        
+        auto remaining = spatialIndex.queryRegion(BoundingBox(Point3D(-1.0, -1.0, -1.0), Point3D(30.0, 1.0, 1.0)));
+        REQUIRE(remaining.size() == 250);
+    }
+    
+    SECTION("Cell key round trip") {
+        int x, y, z;
+        HashedGridIndex::decodeCellKey(HashedGridIndex::encodeCellKey(-7, 12, 0), x, y, z);
+        REQUIRE(x == -7);
+        REQUIRE(y == 12);
+        REQUIRE(z == 0);
+        
+        REQUIRE(HashedGridIndex::encodeCellKey(1, 0, 0) != HashedGridIndex::encodeCellKey(0, 1, 0));
+    }
+}
+
+TEST_CASE("SceneManager - Spatial index backends", "[scene][manager][spatial]") {
+    auto backend = GENERATE(SpatialIndexType::Grid, SpatialIndexType::HashedGrid, SpatialIndexType::AABBTree,
+                            SpatialIndexType::HierarchicalGrid);
+    SceneManager sceneManager(1.0, 1e-6, backend);
+    
+    REQUIRE(sceneManager.getSpatialIndexType() == backend);
+    
+    ObjectId id1 = sceneManager.addObject(createTestObject("item1"));
+    ObjectId id2 = sceneManager.addObject(createTestObject("item2"));
+    sceneManager.moveObject(id1, Transform3D(Point3D(0.0, 0.0, 0.0)));
+    sceneManager.moveObject(id2, Transform3D(Point3D(5.0, 0.0, 0.0)));
+    
+    auto inRegion = sceneManager.getObjectsInRegion(BoundingBox(Point3D(4.0, -1.0, -1.0), Point3D(6.0, 1.0, 1.0)));
+    REQUIRE(inRegion.size() == 1);
+    REQUIRE(inRegion[0] == id2);
+    
+    SECTION("Switch backend at runtime") {
+        sceneManager.setSpatialIndexType(SpatialIndexType::AABBTree);
+        REQUIRE(sceneManager.getSpatialIndexType() == SpatialIndexType::AABBTree);
+        
+        auto rebuilt = sceneManager.getObjectsInRegion(BoundingBox(Point3D(4.0, -1.0, -1.0), Point3D(6.0, 1.0, 1.0)));
+        REQUIRE(rebuilt.size() == 1);
+        REQUIRE(rebuilt[0] == id2);
+    }
+}
+
+TEST_CASE("HierarchicalGridIndex - Basic Operations", "[scene][spatial][index]") {
+    HierarchicalGridIndex spatialIndex(1.0);
+    ObjectHandle handleId(0, 0), cabinetId(1, 0), wallId(2, 0);
+    
+    BoundingBox handle(Point3D(0.0, 0.0, 0.0), Point3D(0.02, 0.02, 0.15));
+    BoundingBox cabinet(Point3D(5.0, 0.0, 0.0), Point3D(5.6, 0.6, 0.9));
+    BoundingBox wall(Point3D(-2.0, 1.0, 0.0), Point3D(2.0, 1.1, 2.5));
+    
+    SECTION("Level selection follows object size") {
+        REQUIRE(spatialIndex.getLevelCellSize(0) == 0.5);
+        REQUIRE(spatialIndex.selectLevel(handle) == 0);
+        REQUIRE(spatialIndex.selectLevel(cabinet) == 0);
+        REQUIRE(spatialIndex.selectLevel(BoundingBox(Point3D(0.0, 0.0, 0.9), Point3D(1.5, 0.6, 0.94))) == 1);
+        REQUIRE(spatialIndex.selectLevel(wall) == 2);
+        
+        BoundingBox building(Point3D(0.0, 0.0, 0.0), Point3D(1000.0, 1.0, 1.0));
+        REQUIRE(spatialIndex.selectLevel(building) == HierarchicalGridIndex::kLevelCount - 1);
+    }
+    
+    SECTION("Each object covers at most 3 x 3 x 3 cells") {
+        spatialIndex.addObject(handleId, handle);
+        spatialIndex.addObject(cabinetId, cabinet);
+        spatialIndex.addObject(wallId, wall);
+        
+        REQUIRE(spatialIndex.getCellCount() <= 3 * 27);
+    }
+    
+    SECTION("Queries span all levels") {
+        spatialIndex.addObject(handleId, handle);
+        spatialIndex.addObject(cabinetId, cabinet);
+        spatialIndex.addObject(wallId, wall);
+        
+        auto nearOrigin = spatialIndex.queryRegion(BoundingBox(Point3D(-0.1, -0.1, 0.0), Point3D(0.1, 1.05, 0.1)));
+        REQUIRE(nearOrigin.size() == 2);
+        REQUIRE(std::find(nearOrigin.begin(), nearOrigin.end(), handleId) != nearOrigin.end());
+        REQUIRE(std::find(nearOrigin.begin(), nearOrigin.end(), wallId) != nearOrigin.end());
+        
+        auto hits = spatialIndex.queryRay(Ray(Point3D(-10.0, 0.3, 0.3), Vector3D(1.0, 0.0, 0.0)), 100.0);
+        REQUIRE(std::find(hits.begin(), hits.end(), cabinetId) != hits.end());
+        
+        auto nearest = spatialIndex.queryNearest(Point3D(4.0, 0.3, 0.3), 2, 100.0, [&](ObjectHandle candidate) {
+            if (candidate == handleId) return handle.distanceTo(Point3D(4.0, 0.3, 0.3));
+            if (candidate == cabinetId) return cabinet.distanceTo(Point3D(4.0, 0.3, 0.3));
+            return wall.distanceTo(Point3D(4.0, 0.3, 0.3));
+        });
+        REQUIRE(nearest.size() == 2);
+        REQUIRE(nearest[0].second == cabinetId);
+        REQUIRE(nearest[1].second == wallId);
+    }
+    
+    SECTION("Resizing moves an object between levels") {
+        spatialIndex.addObject(cabinetId, cabinet);
+        
+        BoundingBox stretched(Point3D(5.0, 0.0, 0.0), Point3D(9.0, 0.6, 0.9));
+        spatialIndex.updateObject(cabinetId, cabinet, stretched);
+        
+        auto farEnd = spatialIndex.queryRegion(BoundingBox(Point3D(8.5, 0.0, 0.0), Point3D(8.6, 0.1, 0.1)));
+        REQUIRE(farEnd.size() == 1);
+        REQUIRE(farEnd[0] == cabinetId);
+        
+        spatialIndex.removeObject(cabinetId, stretched);
+        REQUIRE(spatialIndex.getCellCount() == 0);
+    }
+    
+    SECTION("Clear") {
+        spatialIndex.addObject(handleId, handle);
+        spatialIndex.addObject(wallId, wall);
+        spatialIndex.clear();
+        
+        REQUIRE(spatialIndex.getCellCount() == 0);
+        REQUIRE(spatialIndex.queryRegion(BoundingBox(Point3D(-10.0, -10.0, -10.0), Point3D(10.0, 10.0, 10.0))).empty());
+    }
+}
+
+TEST_CASE("DynamicAABBTree - Basic Operations", "[scene][spatial][bvh]") {
+    DynamicAABBTree tree(0.1);
+    ObjectHandle handleId(0, 0), wallId(1, 0), cabinetId(2, 0);
+    
+    BoundingBox handle(Point3D(0.0, 0.0, 0.0), Point3D(0.02, 0.02, 0.15));
+    BoundingBox wall(Point3D(-2.0, 1.0, 0.0), Point3D(2.0, 1.1, 2.5));
+    BoundingBox cabinet(Point3D(5.0, 0.0, 0.0), Point3D(5.6, 0.6, 0.9));
+    
+    SECTION("Add and query objects") {
+        tree.addObject(handleId, handle);
+        tree.addObject(wallId, wall);
+        tree.addObject(cabinetId, cabinet);
+        
+        REQUIRE(tree.getObjectCount() == 3);
+        
+        auto results = tree.queryRegion(BoundingBox(Point3D(1.5, 0.9, 1.0), Point3D(1.6, 1.05, 1.1)));
+        REQUIRE(results.size() == 1);
+        REQUIRE(results[0] == wallId);
+        
+        auto nearHandle = tree.queryRadius(Point3D(0.0, -0.2, 0.0), 0.25);
+        REQUIRE(std::find(nearHandle.begin(), nearHandle.end(), handleId) != nearHandle.end());
+        REQUIRE(std::find(nearHandle.begin(), nearHandle.end(), cabinetId) == nearHandle.end());
+    }
+    
+    SECTION("Fat bounds absorb small moves") {
+        tree.addObject(cabinetId, cabinet);
+        BoundingBox fatBefore = tree.getFatBounds(cabinetId);
+        REQUIRE(fatBefore.contains(cabinet));
+        
+        BoundingBox nudged(cabinet.min + Vector3D(0.01, 0.0, 0.0), cabinet.max + Vector3D(0.01, 0.0, 0.0));
+        tree.updateObject(cabinetId, cabinet, nudged);
+        REQUIRE(tree.getFatBounds(cabinetId) == fatBefore);
+        
+        BoundingBox moved(cabinet.min + Vector3D(3.0, 0.0, 0.0), cabinet.max + Vector3D(3.0, 0.0, 0.0));
+        tree.updateObject(cabinetId, nudged, moved);
+        REQUIRE(tree.getFatBounds(cabinetId).contains(moved));
+        REQUIRE(tree.queryRegion(cabinet).empty());
+    }
+    
+    SECTION("Tree stays balanced for sorted insertion") {
+        for (int i = 0; i < 1024; ++i) {
+            double x = i * 0.7;
+            tree.addObject(ObjectHandle(i, 0), BoundingBox(Point3D(x, 0.0, 0.0), Point3D(x + 0.6, 0.6, 0.9)));
+        }
+        
+        REQUIRE(tree.getMaxBalance() <= 1);
+        REQUIRE(tree.getHeight() <= 20);
+        
+        auto results = tree.queryRegion(BoundingBox(Point3D(-1.0, -1.0, -1.0), Point3D(1000.0, 1.0, 1.0)));
+        REQUIRE(results.size() == 1024);
+    }
+    
+    SECTION("Remove and clear") {
+        tree.addObject(handleId, handle);
+        tree.addObject(wallId, wall);
+        
+        tree.removeObject(handleId, handle);
+        REQUIRE(tree.getObjectCount() == 1);
+        REQUIRE(tree.queryRegion(handle).empty());
+        
+        tree.clear();
+        REQUIRE(tree.getHeight() == -1);
+        REQUIRE(tree.queryRegion(wall).empty());
+    }
+    
+    SECTION("Queries never miss after random updates") {
+        std::mt19937 rng(7);
+        std::uniform_real_distribution<double> position(0.0, 10.0);
+        std::uniform_real_distribution<double> extent(0.02, 3.0);
+        
+        auto randomBox = [&]() {
+            Point3D min(position(rng), position(rng), position(rng));
+            return BoundingBox(min, min + Vector3D(extent(rng), extent(rng), extent(rng)));
+        };
+        
+        std::vector<BoundingBox> boxes;
+        for (int i = 0; i < 200; ++i) {
+            boxes.push_back(randomBox());
+            tree.addObject(ObjectHandle(i, 0), boxes.back());
+        }
+        
+        for (int i = 0; i < 200; i += 3) {
+            BoundingBox next = randomBox();
+            tree.updateObject(ObjectHandle(i, 0), boxes[i], next);
+            boxes[i] = next;
+        }
+        
+        REQUIRE(tree.getMaxBalance() <= 1);
+        
+        for (int q = 0; q < 20; ++q) {
+            BoundingBox region = randomBox();
+            auto results = tree.queryRegion(region);
+            
+            for (int i = 0; i < 200; ++i) {
+                if (boxes[i].intersects(region)) {
+                    REQUIRE(std::find(results.begin(), results.end(), ObjectHandle(i, 0)) != results.end());
+                }
+            }
+        }
+    }
+}
+
+TEST_CASE("SweepAndPrune - Overlapping Pairs", "[scene][collision][sap]") {
+    SweepAndPrune sap;
+    ObjectHandle a(0, 0), b(1, 0), c(2, 0);
+    
+    SECTION("Touching and separated boxes") {
+        sap.addObject(a, BoundingBox(Point3D(0.0, 0.0, 0.0), Point3D(1.0, 1.0, 1.0)));
+        sap.addObject(b, BoundingBox(Point3D(1.0, 0.0, 0.0), Point3D(2.0, 1.0, 1.0)));
+        sap.addObject(c, BoundingBox(Point3D(5.0, 0.0, 0.0), Point3D(6.0, 1.0, 1.0)));
+        
+        REQUIRE(sap.getObjectCount() == 3);
+        REQUIRE(sap.countOverlappingPairs() == 1);
+        
+        sap.updateObject(c, BoundingBox(Point3D(1.5, 0.5, 0.5), Point3D(2.5, 1.5, 1.5)));
+        REQUIRE(sap.countOverlappingPairs() == 2);
+        
+        sap.removeObject(b);
+        REQUIRE(sap.countOverlappingPairs() == 0);
+        
+        sap.clear();
+        REQUIRE(sap.getObjectCount() == 0);
+    }
+    
+    SECTION("Matches brute force after random updates and removals") {
+        std::mt19937 rng(11);
+        std::uniform_real_distribution<double> position(0.0, 10.0);
+        std::uniform_real_distribution<double> extent(0.02, 2.0);
+        
+        auto randomBox = [&]() {
+            Point3D min(position(rng), position(rng), position(rng));
+            return BoundingBox(min, min + Vector3D(extent(rng), extent(rng), extent(rng)));
+        };
+        
+        std::map<ObjectHandle, BoundingBox> boxes;
+        for (int i = 0; i < 300; ++i) {
+            ObjectHandle id(i, 0);
+            boxes[id] = randomBox();
+            sap.addObject(id, boxes[id]);
+        }
+        
+        auto checkAgainstBruteForce = [&]() {
+            std::set<std::pair<ObjectHandle, ObjectHandle>> expected;
+            for (auto a = boxes.begin(); a != boxes.end(); ++a) {
+                for (auto b = std::next(a); b != boxes.end(); ++b) {
+                    if (a->second.intersects(b->second)) {
+                        expected.insert({a->first, b->first});
+                    }
+                }
+            }
+            
+            std::set<std::pair<ObjectHandle, ObjectHandle>> found;
+            for (const auto& pair : sap.findOverlappingPairs()) {
+                found.insert(std::minmax(pair.first, pair.second));
+            }
+            
+            REQUIRE(found == expected);
+            REQUIRE(sap.countOverlappingPairs() == expected.size());
+        };
+        
+        checkAgainstBruteForce();
+        
+        for (int i = 0; i < 300; i += 2) {
+            ObjectHandle id(i, 0);
+            boxes[id] = randomBox();
+            sap.updateObject(id, boxes[id]);
+        }
+        checkAgainstBruteForce();
+        
+        for (int i = 0; i < 300; i += 3) {
+            ObjectHandle id(i, 0);
+            boxes.erase(id);
+            sap.removeObject(id);
+        }
+        checkAgainstBruteForce();
+    }
+}
+
+TEST_CASE("BoundsSoA - Conservative overlap kernels", "[scene][collision][simd]") {
+    BoundsSoA packed;
+    
+    SECTION("Boxes touching at coordinates not representable in float") {
+        // 0.1 rounds up in float, so a naive narrowing would separate these boxes
+        packed.set(0, BoundingBox(Point3D(-1.0, -1.0, -1.0), Point3D(0.1, 1.0, 1.0)));
+        packed.set(1, BoundingBox(Point3D(0.1, -1.0, -1.0), Point3D(1.0, 1.0, 1.0)));
+        packed.set(2, BoundingBox(Point3D(5.0, 5.0, 5.0), Point3D(6.0, 6.0, 6.0)));
+        
+        std::vector<uint32_t> slots;
+        packed.findOverlapping(BoundingBox(Point3D(0.1, 0.0, 0.0), Point3D(0.1, 0.0, 0.0)), slots);
+        REQUIRE(slots == std::vector<uint32_t>{0, 1});
+        
+        packed.reset(1);
+        slots.clear();
+        packed.findOverlapping(BoundingBox(Point3D(0.1, 0.0, 0.0), Point3D(0.1, 0.0, 0.0)), slots);
+        REQUIRE(slots == std::vector<uint32_t>{0});
+        
+        slots.clear();
+        packed.findOverlapping(BoundingBox(), slots);
+        REQUIRE(slots.empty());
+    }
+    
+    SECTION("Every supported kernel agrees and never misses an exact overlap") {
+        std::mt19937 rng(5);
+        std::uniform_real_distribution<double> position(0.0, 10.0);
+        std::uniform_real_distribution<double> extent(0.01, 1.5);
+        
+        auto randomBox = [&]() {
+            Point3D min(position(rng), position(rng), position(rng));
+            return BoundingBox(min, min + Vector3D(extent(rng), extent(rng), extent(rng)));
+        };
+        
+        // An odd count leaves a partially filled block at the end
+        std::vector<BoundingBox> boxes;
+        for (uint32_t slot = 0; slot < 203; ++slot) {
+            boxes.push_back(randomBox());
+            packed.set(slot, boxes.back());
+        }
+        REQUIRE(packed.getSlotCount() == 203);
+        
+        for (int query = 0; query < 50; ++query) {
+            BoundingBox region = randomBox();
+            
+            std::vector<uint32_t> expected;
+            for (uint32_t slot = 0; slot < boxes.size(); ++slot) {
+                if (region.intersects(boxes[slot])) {
+                    expected.push_back(slot);
+                }
+            }
+            
+            std::vector<uint32_t> reference;
+            packed.setKernel(BoundsSoA::Kernel::Scalar);
+            packed.findOverlapping(region, reference);
+            REQUIRE(std::includes(reference.begin(), reference.end(), expected.begin(), expected.end()));
+            
+            for (auto kernel : {BoundsSoA::Kernel::SSE, BoundsSoA::Kernel::AVX2}) {
+                if (!BoundsSoA::isKernelSupported(kernel)) continue;
+                
+                std::vector<uint32_t> slots;
+                packed.setKernel(kernel);
+                REQUIRE(packed.getKernel() == kernel);
+                packed.findOverlapping(region, slots);
+                REQUIRE(slots == reference);
+            }
+        }
+    }
+}
+
+TEST_CASE("SceneManager - Scene-wide collisions", "[scene][manager][collision]") {
+    SceneManager scene;
+    
+    auto first = scene.addObject(createTestObject());
+    auto second = scene.addObject(createTestObject());
+    auto third = scene.addObject(createTestObject());
+    
+    // Unit cubes at the origin all overlap until moved apart
+    REQUIRE(scene.detectAllCollisions().size() == 3);
+    REQUIRE(scene.getStatistics().collisions == 3);
+    
+    scene.removeObject(third);
+    
+    auto collisions = scene.detectAllCollisions();
+    REQUIRE(collisions.size() == 1);
+    REQUIRE(std::minmax(collisions[0].objectA, collisions[0].objectB) == std::minmax(first, second));
+    REQUIRE(scene.getStatistics().collisions == 1);
+    
+    scene.clear();
+    REQUIRE(scene.detectAllCollisions().empty());
+}
+
+TEST_CASE("SceneManager - Rotated objects use oriented boxes", "[scene][manager][collision][obb]") {
+    SceneManager scene;
+    Vector3D quarterTurn(0.0, 0.0, GeometryUtils::HALF_PI / 2.0);
+    
+    // A cabinet turned 45 degrees, and a neighbour inside its axis-aligned bounds but clear of the box
+    auto rotated = createTestObject("rotated");
+    rotated->setTransform(Transform3D(Point3D(), quarterTurn));
+    ObjectId rotatedId = scene.addObject(std::move(rotated));
+    
+    auto neighbour = createTestObject("neighbour");
+    neighbour->setTransform(Transform3D(Point3D(1.1, 1.1, 0.0)));
+    ObjectId neighbourId = scene.addObject(std::move(neighbour));
+    
+    REQUIRE(scene.findIntersectingObjects(rotatedId).empty());
+    REQUIRE(scene.getCurrentCollisions().empty());
+    REQUIRE(scene.detectAllCollisions().empty());
+    
+    REQUIRE(!scene.checkCollision(neighbourId, Transform3D(Point3D(0.9, 0.9, 0.0))));
+    REQUIRE(scene.checkCollision(neighbourId, Transform3D(Point3D(0.7, 0.7, 0.0))));
+    
+    SECTION("Moves into the empty corner are allowed") {
+        REQUIRE(scene.moveObject(neighbourId, Transform3D(Point3D(0.9, 0.9, 0.0))));
+        REQUIRE(!scene.moveObject(neighbourId, Transform3D(Point3D(0.7, 0.7, 0.0))));
+    }
+    
+    SECTION("Penetration comes from the oriented boxes") {
+        scene.setCollisionDetectionEnabled(false);
+        REQUIRE(scene.moveObject(neighbourId, Transform3D(Point3D(0.7, 0.7, 0.0))));
+        
+        auto collisions = scene.detectAllCollisions();
+        REQUIRE(collisions.size() == 1);
+        REQUIRE(scene.getCurrentCollisions().size() == 1);
+        
+        // Depth along the diamond's face normal: 0.5 + 0.5 * sqrt(2) - 0.7 * sqrt(2)
+        REQUIRE(collisions[0].penetrationDepth == Approx(0.5 - 0.2 * std::sqrt(2.0)));
+        REQUIRE(collisions[0].penetrationVector.length() == Approx(collisions[0].penetrationDepth));
+    }
+}
+
+TEST_CASE("SceneManager - Live collision pairs", "[scene][manager][collision]") {
+    SceneManager scene;
+    scene.setCollisionDetectionEnabled(false);
+    
+    std::vector<SceneManager::CollisionPair> started;
+    std::vector<SceneManager::CollisionPair> stopped;
+    scene.setCollisionChangedCallback([&](const std::vector<SceneManager::CollisionPair>& s,
+                                          const std::vector<SceneManager::CollisionPair>& e) {
+        started.insert(started.end(), s.begin(), s.end());
+        stopped.insert(stopped.end(), e.begin(), e.end());
+    });
+    
+    auto first = scene.addObject(createTestObject());
+    auto second = scene.addObject(createTestObject());
+    
+    REQUIRE(started.size() == 1);
+    REQUIRE(started[0] == SceneManager::CollisionPair(std::minmax(first, second)));
+    REQUIRE(scene.getCurrentCollisions().size() == 1);
+    REQUIRE(scene.getStatistics().collisions == 1);
+    
+    SECTION("Moving apart and back reports stop and start") {
+        started.clear();
+        REQUIRE(scene.translateObject(second, Vector3D(3.0, 0.0, 0.0)));
+        REQUIRE(stopped.size() == 1);
+        REQUIRE(scene.getCurrentCollisions().empty());
+        REQUIRE(scene.getStatistics().collisions == 0);
+        
+        // Small moves that keep the same overlap state report nothing
+        REQUIRE(scene.translateObject(second, Vector3D(0.1, 0.0, 0.0)));
+        REQUIRE(started.empty());
+        REQUIRE(stopped.size() == 1);
+        
+        REQUIRE(scene.translateObject(second, Vector3D(-2.8, 0.0, 0.0)));
+        REQUIRE(started.size() == 1);
+        REQUIRE(scene.getCurrentCollisions().size() == 1);
+    }
+    
+    SECTION("Removing an object stops its pairs") {
+        auto third = scene.addObject(createTestObject());
+        REQUIRE(scene.getCurrentCollisions().size() == 3);
+        
+        scene.removeObject(first);
+        REQUIRE(stopped.size() == 2);
+        REQUIRE(scene.getCurrentCollisions().size() == 1);
+        REQUIRE(scene.getCurrentCollisions()[0] == SceneManager::CollisionPair(std::minmax(second, third)));
+    }
+    
+    SECTION("Matches a full rescan") {
+        for (int i = 0; i < 20; ++i) {
+            auto id = scene.addObject(createTestObject());
+            scene.translateObject(id, Vector3D(0.4 * i, 0.3 * (i % 3), 0.0));
+        }
+        
+        std::set<SceneManager::CollisionPair> live;
+        for (const auto& pair : scene.getCurrentCollisions()) {
+            live.insert(pair);
+        }
+        
+        std::set<SceneManager::CollisionPair> rescanned;
+        for (const auto& info : scene.detectAllCollisions()) {
+            rescanned.insert(std::minmax(info.objectA, info.objectB));
+        }
+        
+        REQUIRE(live == rescanned);
+        REQUIRE(scene.getStatistics().collisions == rescanned.size());
+    }
+    
+    SECTION("Clearing the scene stops every pair") {
+        scene.clear();
+        REQUIRE(stopped.size() == 1);
+        REQUIRE(scene.getCurrentCollisions().empty());
+    }
+    
+    SECTION("The callback may query the scene") {
+        // A canvas highlighting collisions reads the live pairs and their bounds
+        std::vector<size_t> pairsSeen;
+        scene.setCollisionChangedCallback([&](const std::vector<SceneManager::CollisionPair>& s,
+                                              const std::vector<SceneManager::CollisionPair>&) {
+            pairsSeen.push_back(scene.getCurrentCollisions().size());
+            for (const auto& pair : s) {
+                REQUIRE_FALSE(scene.getObjectBounds(pair.first).isEmpty());
+            }
+        });
+        
+        auto third = scene.addObject(createTestObject());
+        REQUIRE(scene.translateObject(third, Vector3D(5.0, 0.0, 0.0)));
+        scene.removeObject(first);
+        REQUIRE(pairsSeen == std::vector<size_t>{3, 1, 0});
+    }
+}
+
+TEST_CASE("SceneManager - Snapshots", "[scene][manager][snapshot]") {
+    SceneManager scene;
+    scene.setCollisionDetectionEnabled(false);
+    
+    auto first = scene.addObject(createTestObject("cabinet"));
+    auto second = scene.addObject(createTestObject("drawer"));
+    scene.translateObject(second, Vector3D(2.0, 0.0, 0.0));
+    scene.addToSelection(first);
+    
+    auto snapshot = scene.getSnapshot();
+    REQUIRE(snapshot->getVersion() == scene.getVersion());
+    REQUIRE(snapshot->getObjectCount() == 2);
+    REQUIRE(snapshot->isSelected(first));
+    REQUIRE(snapshot->getObject(second)->getCatalogItemId() == "drawer");
+    REQUIRE(snapshot->getObjectsInRegion(BoundingBox(Point3D(1.8, -0.1, -0.1), Point3D(2.2, 0.1, 0.1))).size() == 1);
+    
+    SECTION("Unchanged scene reuses the cached snapshot") {
+        REQUIRE(scene.getSnapshot() == snapshot);
+    }
+    
+    SECTION("Snapshots are isolated from later edits") {
+        scene.translateObject(first, Vector3D(0.0, 5.0, 0.0));
+        scene.removeObject(second);
+        
+        REQUIRE(snapshot->getObjectCount() == 2);
+        REQUIRE(snapshot->getObjectBounds(first).center().y == Approx(0.0));
+        
+        auto next = scene.getSnapshot();
+        REQUIRE(next->getVersion() > snapshot->getVersion());
+        REQUIRE(next->getObjectCount() == 1);
+        REQUIRE(next->getObjectBounds(first).center().y == Approx(5.0));
+        REQUIRE(next->getObject(first)->getTransform().translation.y == Approx(5.0));
+    }
+    
+    SECTION("Unmodified objects are shared between snapshots") {
+        scene.translateObject(first, Vector3D(0.0, 1.0, 0.0));
+        
+        auto next = scene.getSnapshot();
+        REQUIRE(next->getObject(second) == snapshot->getObject(second));
+        REQUIRE(next->getObject(first) != snapshot->getObject(first));
+    }
+    
+    SECTION("Const iteration visits the live objects, not snapshot copies") {
+        scene.translateObject(first, Vector3D(0.0, 1.0, 0.0));
+        
+        const SceneManager& constScene = scene;
+        std::map<ObjectId, const SceneObject*> visited;
+        constScene.forEachObject([&](const ObjectId& id, const SceneObject* object) { visited[id] = object; });
+        
+        REQUIRE(visited.size() == 2);
+        REQUIRE(visited[first] == constScene.getObject(first));
+        REQUIRE(visited[second] == constScene.getObject(second));
+    }
+}
+
+TEST_CASE("SceneManager - Concurrent readers and writer", "[scene][manager][snapshot][threading]") {
+    SceneManager scene;
+    scene.setCollisionDetectionEnabled(false);
+    
+    std::vector<ObjectId> ids;
+    for (int i = 0; i < 50; ++i) {
+        ids.push_back(scene.addObject(createTestObject()));
+        scene.translateObject(ids.back(), Vector3D(2.0 * i, 0.0, 0.0));
+    }
+    
+    std::atomic<bool> done{false};
+    std::atomic<size_t> inconsistent{0};
+    
+    std::vector<std::thread> readers;
+    for (int t = 0; t < 4; ++t) {
+        readers.emplace_back([&]() {
+            while (!done) {
+                auto snapshot = scene.getSnapshot();
+                
+                // Bounds and objects inside one snapshot always agree
+                snapshot->forEachObject([&](const ObjectId& id, const SceneObject* object) {
+                    double x = object->getTransform().translation.x;
+                    if (std::abs(snapshot->getObjectBounds(id).center().x - x) > 1e-9) {
+                        ++inconsistent;
+                    }
+                });
+                
+                scene.getObjectsInRegion(BoundingBox(Point3D(0.0, -1.0, -1.0), Point3D(20.0, 1.0, 1.0)));
+                scene.detectAllCollisions();
+            }
+        });
+    }
+    
+    for (int step = 0; step < 200; ++step) {
+        const auto& id = ids[step % ids.size()];
+        scene.translateObject(id, Vector3D(0.0, (step % 2 == 0) ? 0.5 : -0.5, 0.0));
+    }
+    
+    done = true;
+    for (auto& reader : readers) {
+        reader.join();
+    }
+    
+    REQUIRE(inconsistent == 0);
+    REQUIRE(scene.getSnapshot()->getObjectCount() == 50);
+}
+
+TEST_CASE("SceneManager - Object handles", "[scene][manager][handles]") {
+    SceneManager scene;
+    
+    auto first = scene.addObject(createTestObject());
+    ObjectHandle handle = scene.getHandle(first);
+    
+    REQUIRE(handle.isValid());
+    REQUIRE(scene.isValidHandle(handle));
+    REQUIRE(scene.getObjectId(handle) == first);
+    REQUIRE(ObjectHandle::unpack(handle.pack()) == handle);
+    REQUIRE_FALSE(scene.getHandle("missing").isValid());
+    
+    SECTION("Removed objects invalidate their handles") {
+        scene.removeObject(first);
+        REQUIRE_FALSE(scene.isValidHandle(handle));
+        REQUIRE(scene.getObjectId(handle).empty());
+        
+        // The slot is reused with a new generation
+        auto second = scene.addObject(createTestObject());
+        ObjectHandle reused = scene.getHandle(second);
+        REQUIRE(reused.slot == handle.slot);
+        REQUIRE(reused.generation != handle.generation);
+        REQUIRE_FALSE(scene.isValidHandle(handle));
+        REQUIRE(scene.getObjectId(reused) == second);
+    }
+    
+    SECTION("Clearing the scene invalidates every handle") {
+        scene.clear();
+        REQUIRE_FALSE(scene.isValidHandle(handle));
+        
+        auto second = scene.addObject(createTestObject());
+        ObjectHandle reused = scene.getHandle(second);
+        REQUIRE(reused.slot == handle.slot);
+        REQUIRE_FALSE(scene.isValidHandle(handle));
+        REQUIRE(scene.getObjectId(handle).empty());
+        REQUIRE(scene.getObjectId(reused) == second);
+    }
+}
+
+TEST_CASE("SceneManager - Batched transforms", "[scene][manager][transform][batch]") {
+    SceneManager scene;
+    
+    auto addAt = [&](double x) {
+        auto object = createTestObject();
+        object->setTransform(Transform3D(Point3D(x, 0.0, 0.0)));
+        return scene.addObject(std::move(object));
+    };
+    
+    // Unit cubes at x = 0, 2 and 4, plus an obstacle at x = 10
+    auto a = addAt(0.0);
+    auto b = addAt(2.0);
+    auto c = addAt(4.0);
+    auto obstacle = addAt(10.0);
+    
+    std::vector<ObjectId> perObjectEvents;
+    std::vector<std::vector<ObjectId>> batchEvents;
+    scene.setObjectModifiedCallback([&](const ObjectId& id) { perObjectEvents.push_back(id); });
+    scene.setObjectsModifiedCallback([&](const std::vector<ObjectId>& ids) { batchEvents.push_back(ids); });
+    
+    SECTION("Group move is one event and may pass through the group's old positions") {
+        std::vector<ObjectTransform> transforms = {
+            {a, Transform3D(Point3D(2.0, 0.0, 0.0))},
+            {b, Transform3D(Point3D(4.0, 0.0, 0.0))},
+            {c, Transform3D(Point3D(6.0, 0.0, 0.0))}
+        };
+        
+        REQUIRE(scene.applyTransforms(transforms));
+        REQUIRE(batchEvents.size() == 1);
+        REQUIRE(batchEvents[0].size() == 3);
+        REQUIRE(perObjectEvents.empty());
+        
+        REQUIRE(scene.getObjectsInRegion(BoundingBox(Point3D(5.6, -0.1, -0.1), Point3D(5.7, 0.1, 0.1))) ==
+                std::vector<ObjectId>{c});
+        REQUIRE(scene.getObjectsInRegion(BoundingBox(Point3D(-0.1, -0.1, -0.1), Point3D(0.1, 0.1, 0.1))).empty());
+    }
+    
+    SECTION("A collision outside the batch rejects the whole batch") {
+        uint64_t version = scene.getVersion();
+        std::vector<ObjectTransform> transforms = {
+            {a, Transform3D(Point3D(0.0, 3.0, 0.0))},
+            {b, Transform3D(Point3D(9.5, 0.0, 0.0))}
+        };
+        
+        REQUIRE_FALSE(scene.applyTransforms(transforms));
+        REQUIRE(batchEvents.empty());
+        REQUIRE(scene.getVersion() == version);
+        
+        const SceneManager& constScene = scene;
+        REQUIRE(constScene.getObject(a)->getTransform().translation.y == Approx(0.0));
+    }
+    
+    SECTION("Members may not end up overlapping each other") {
+        uint64_t version = scene.getVersion();
+        std::vector<ObjectTransform> transforms = {
+            {a, Transform3D(Point3D(6.0, 0.0, 0.0))},
+            {b, Transform3D(Point3D(6.5, 0.0, 0.0))}
+        };
+        
+        REQUIRE_FALSE(scene.applyTransforms(transforms));
+        REQUIRE(batchEvents.empty());
+        REQUIRE(scene.getVersion() == version);
+        
+        // Only an object's last transform counts
+        transforms.push_back({a, Transform3D(Point3D(8.0, 0.0, 0.0))});
+        REQUIRE(scene.applyTransforms(transforms));
+        
+        const SceneManager& constScene = scene;
+        REQUIRE(constScene.getObject(a)->getTransform().translation.x == Approx(8.0));
+    }
+    
+    SECTION("Members already in contact may move together") {
+        // Side by side and touching, as placed by a snap, then shifted as one
+        scene.setCollisionDetectionEnabled(false);
+        REQUIRE(scene.translateObject(b, Vector3D(-1.0, 0.0, 0.0)));
+        scene.setCollisionDetectionEnabled(true);
+        batchEvents.clear();
+        perObjectEvents.clear();
+        
+        std::vector<ObjectTransform> transforms = {
+            {a, Transform3D(Point3D(0.0, 2.0, 0.0))},
+            {b, Transform3D(Point3D(1.0, 2.0, 0.0))}
+        };
+        
+        REQUIRE(scene.applyTransforms(transforms));
+        REQUIRE(batchEvents.size() == 1);
+    }
+    
+    SECTION("An empty batch reports nothing") {
+        REQUIRE(scene.applyTransforms(std::span<const ObjectTransform>()));
+        REQUIRE(batchEvents.empty());
+        REQUIRE(perObjectEvents.empty());
+    }
+    
+    SECTION("Unknown ids reject the batch") {
+        std::vector<ObjectTransform> transforms = {
+            {a, Transform3D(Point3D(0.0, 3.0, 0.0))},
+            {"missing", Transform3D()}
+        };
+        
+        REQUIRE_FALSE(scene.applyTransforms(transforms));
+        REQUIRE(batchEvents.empty());
+    }
+    
+    SECTION("Collision pairs are reported once for the final positions") {
+        scene.setCollisionDetectionEnabled(false);
+        
+        int collisionEvents = 0;
+        scene.setCollisionChangedCallback([&](const std::vector<SceneManager::CollisionPair>&,
+                                              const std::vector<SceneManager::CollisionPair>&) {
+            ++collisionEvents;
+        });
+        
+        std::vector<ObjectTransform> transforms = {
+            {a, Transform3D(Point3D(10.0, 0.5, 0.0))},
+            {b, Transform3D(Point3D(10.0, -0.5, 0.0))}
+        };
+        
+        REQUIRE(scene.applyTransforms(transforms));
+        REQUIRE(collisionEvents == 1);
+        REQUIRE(scene.getCurrentCollisions().size() == 3);
+        REQUIRE(scene.findIntersectingObjects(obstacle).size() == 2);
+    }
+    
+    SECTION("Without a batch callback each object is reported individually") {
+        scene.setObjectsModifiedCallback(nullptr);
+        
+        std::vector<ObjectTransform> transforms = {
+            {a, Transform3D(Point3D(0.0, 3.0, 0.0))},
+            {b, Transform3D(Point3D(2.0, 3.0, 0.0))}
+        };
+        
+        REQUIRE(scene.applyTransforms(transforms));
+        REQUIRE(perObjectEvents.size() == 2);
+    }
+}
+
+TEST_CASE("SceneManager - Batched change notifications", "[scene][manager][events][batch]") {
+    SceneManager scene;
+    scene.setCollisionDetectionEnabled(false);
+    
+    auto existing = scene.addObject(createTestObject());
+    auto removedLater = scene.addObject(createTestObject());
+    
+    std::vector<SceneChangeSet> changeSets;
+    scene.setChangeSetCallback([&](const SceneChangeSet& changes) { changeSets.push_back(changes); });
+    
+    SECTION("Changes outside a batch arrive one at a time") {
+        scene.translateObject(existing, Vector3D(1.0, 0.0, 0.0));
+        REQUIRE(changeSets.size() == 1);
+        REQUIRE(changeSets[0].modified == std::vector<ObjectId>{existing});
+    }
+    
+    SECTION("A batch delivers its net changes once") {
+        ObjectId added;
+        ObjectId transient;
+        {
+            SceneChangeBatch batch(scene);
+            
+            added = scene.addObject(createTestObject());
+            scene.translateObject(added, Vector3D(1.0, 0.0, 0.0));
+            
+            transient = scene.addObject(createTestObject());
+            scene.removeObject(transient);
+            
+            scene.translateObject(existing, Vector3D(1.0, 0.0, 0.0));
+            scene.rotateObject(existing, Vector3D(0.0, 0.0, 0.5));
+            
+            scene.removeObject(removedLater);
+            
+            REQUIRE(changeSets.empty());
+        }
+        
+        REQUIRE(changeSets.size() == 1);
+        REQUIRE(changeSets[0].added == std::vector<ObjectId>{added});
+        REQUIRE(changeSets[0].removed == std::vector<ObjectId>{removedLater});
+        REQUIRE(changeSets[0].modified == std::vector<ObjectId>{existing});
+    }
+    
+    SECTION("Nested batches deliver at the outermost end") {
+        scene.beginBatch();
+        scene.beginBatch();
+        scene.translateObject(existing, Vector3D(1.0, 0.0, 0.0));
+        scene.endBatch();
+        REQUIRE(changeSets.empty());
+        
+        scene.endBatch();
+        REQUIRE(changeSets.size() == 1);
+    }
+    
+    SECTION("An object removed and re-added under its id is modified") {
+        {
+            SceneChangeBatch batch(scene);
+            scene.removeObject(existing);
+            
+            auto replacement = createTestObject();
+            replacement->setId(existing);
+            scene.addObject(std::move(replacement));
+        }
+        
+        REQUIRE(changeSets.size() == 1);
+        REQUIRE(changeSets[0].added.empty());
+        REQUIRE(changeSets[0].removed.empty());
+        REQUIRE(changeSets[0].modified == std::vector<ObjectId>{existing});
+    }
+    
+    SECTION("An empty batch delivers nothing") {
+        { SceneChangeBatch batch(scene); }
+        REQUIRE(changeSets.empty());
+    }
+    
+    SECTION("Scheduled flushes batch until the next tick") {
+        std::vector<std::function<void()>> eventLoop;
+        scene.setChangeFlushScheduler([&]() { eventLoop.push_back([&]() { scene.flushChanges(); }); });
+        
+        auto added = scene.addObject(createTestObject());
+        scene.translateObject(added, Vector3D(1.0, 0.0, 0.0));
+        scene.translateObject(existing, Vector3D(1.0, 0.0, 0.0));
+        
+        REQUIRE(eventLoop.size() == 1);
+        REQUIRE(changeSets.empty());
+        
+        eventLoop.front()();
+        REQUIRE(changeSets.size() == 1);
+        REQUIRE(changeSets[0].added == std::vector<ObjectId>{added});
+        REQUIRE(changeSets[0].modified == std::vector<ObjectId>{existing});
+        
+        // The next change schedules a new flush
+        scene.translateObject(existing, Vector3D(1.0, 0.0, 0.0));
+        REQUIRE(eventLoop.size() == 2);
+        
+        // Removing the scheduler delivers what is still pending
+        scene.setChangeFlushScheduler(nullptr);
+        REQUIRE(changeSets.size() == 2);
+    }
+    
+    SECTION("Subscribers and the scheduler run with the scene unlocked") {
+        std::vector<size_t> countsSeen;
+        scene.setChangeSetCallback([&](const SceneChangeSet& changes) {
+            changeSets.push_back(changes);
+            countsSeen.push_back(scene.getObjectCount());
+        });
+        
+        scene.addObject(createTestObject());
+        scene.translateObject(existing, Vector3D(1.0, 0.0, 0.0));
+        REQUIRE(countsSeen == std::vector<size_t>{3, 3});
+        
+        // A scheduler flushing at once must not find the scene locked either
+        scene.setChangeFlushScheduler([&]() { scene.flushChanges(); });
+        scene.removeObject(removedLater);
+        REQUIRE(countsSeen == std::vector<size_t>{3, 3, 2});
+        REQUIRE(changeSets.back().removed == std::vector<ObjectId>{removedLater});
+    }
+    
+    SECTION("Without a change set callback batches replay per object") {
+        scene.setChangeSetCallback(nullptr);
+        
+        std::vector<std::string> events;
+        scene.setObjectAddedCallback([&](const ObjectId& id) { events.push_back("added " + id); });
+        scene.setObjectRemovedCallback([&](const ObjectId& id) { events.push_back("removed " + id); });
+        scene.setObjectModifiedCallback([&](const ObjectId& id) { events.push_back("modified " + id); });
+        
+        ObjectId added;
+        {
+            SceneChangeBatch batch(scene);
+            added = scene.addObject(createTestObject());
+            scene.translateObject(existing, Vector3D(1.0, 0.0, 0.0));
+            scene.translateObject(existing, Vector3D(1.0, 0.0, 0.0));
+            scene.removeObject(removedLater);
+            REQUIRE(events.empty());
+        }
+        
+        REQUIRE(events == std::vector<std::string>{"removed " + removedLater, "added " + added,
+                                                   "modified " + existing});
+    }
+}
+
+TEST_CASE("SceneManager - Changes since a version", "[scene][manager][version]") {
+    SceneManager scene;
+    scene.setCollisionDetectionEnabled(false);
+    
+    auto a = scene.addObject(createTestObject());
+    auto b = scene.addObject(createTestObject());
+    uint64_t start = scene.getVersion();
+    
+    SECTION("Nothing changed") {
+        auto delta = scene.getChangesSince(start);
+        REQUIRE(delta.complete);
+        REQUIRE(delta.fromVersion == start);
+        REQUIRE(delta.toVersion == start);
+        REQUIRE(delta.changes.empty());
+        REQUIRE_FALSE(delta.selectionChanged);
+    }
+    
+    SECTION("Net changes are reported once per object") {
+        scene.translateObject(a, Vector3D(1.0, 0.0, 0.0));
+        scene.translateObject(a, Vector3D(1.0, 0.0, 0.0));
+        auto c = scene.addObject(createTestObject());
+        scene.translateObject(c, Vector3D(0.0, 1.0, 0.0));
+        scene.removeObject(b);
+        
+        auto delta = scene.getChangesSince(start);
+        REQUIRE(delta.complete);
+        REQUIRE(delta.toVersion == scene.getVersion());
+        REQUIRE(delta.changes.added == std::vector<ObjectId>{c});
+        REQUIRE(delta.changes.removed == std::vector<ObjectId>{b});
+        REQUIRE(delta.changes.modified == std::vector<ObjectId>{a});
+        
+        // Only later changes show up from a later version
+        auto later = scene.getChangesSince(delta.toVersion);
+        REQUIRE(later.complete);
+        REQUIRE(later.changes.empty());
+    }
+    
+    SECTION("Per-object versions track the last change") {
+        uint64_t before = scene.getObjectVersion(a);
+        REQUIRE(before > 0);
+        REQUIRE(scene.getObjectVersion(b) > before);
+        
+        scene.translateObject(a, Vector3D(1.0, 0.0, 0.0));
+        REQUIRE(scene.getObjectVersion(a) == scene.getVersion());
+        REQUIRE(scene.getObjectVersion("missing") == 0);
+    }
+    
+    SECTION("Reading objects is not a change") {
+        REQUIRE(scene.getObject(a) != nullptr);
+        scene.forEachObject([](const ObjectId&, SceneObject*) {});
+        
+        REQUIRE(scene.getVersion() == start);
+        REQUIRE(scene.getChangesSince(start).changes.empty());
+    }
+    
+    SECTION("Edits through modifyObject are changes") {
+        std::vector<ObjectId> modified;
+        scene.setObjectModifiedCallback([&](const ObjectId& id) { modified.push_back(id); });
+        
+        REQUIRE(scene.modifyObject(a, [](SceneObject& object) {
+            object.setTransform(Transform3D(Point3D(3.0, 0.0, 0.0)));
+        }));
+        REQUIRE_FALSE(scene.modifyObject("missing", [](SceneObject&) {}));
+        
+        REQUIRE(scene.getObjectVersion(a) == scene.getVersion());
+        REQUIRE(scene.getChangesSince(start).changes.modified == std::vector<ObjectId>{a});
+        REQUIRE(modified == std::vector<ObjectId>{a});
+        REQUIRE(scene.getObjectsInRegion(BoundingBox(Point3D(2.9, -0.1, -0.1), Point3D(3.1, 0.1, 0.1))) ==
+                std::vector<ObjectId>{a});
+        REQUIRE(scene.getSnapshot()->getObject(a)->getTransform().translation.x == Approx(3.0));
+    }
+    
+    SECTION("Selection changes are flagged") {
+        scene.addToSelection(a);
+        auto delta = scene.getChangesSince(start);
+        REQUIRE(delta.selectionChanged);
+        REQUIRE(delta.changes.empty());
+    }
+    
+    SECTION("Versions older than the retained log are incomplete") {
+        scene.setChangeLogCapacity(2);
+        scene.translateObject(a, Vector3D(1.0, 0.0, 0.0));
+        uint64_t middle = scene.getVersion();
+        scene.translateObject(b, Vector3D(1.0, 0.0, 0.0));
+        scene.translateObject(a, Vector3D(1.0, 0.0, 0.0));
+        
+        REQUIRE_FALSE(scene.getChangesSince(start).complete);
+        
+        auto delta = scene.getChangesSince(middle);
+        REQUIRE(delta.complete);
+        REQUIRE(delta.changes.modified == std::vector<ObjectId>{b, a});
+    }
+    
+    SECTION("Clearing the scene requires a rebuild") {
+        scene.clear();
+        REQUIRE_FALSE(scene.getChangesSince(start).complete);
+        
+        uint64_t cleared = scene.getVersion();
+        auto c = scene.addObject(createTestObject());
+        auto delta = scene.getChangesSince(cleared);
+        REQUIRE(delta.complete);
+        REQUIRE(delta.changes.added == std::vector<ObjectId>{c});
+    }
+}
+
+TEST_CASE("SceneManager - Raycast and frustum queries", "[scene][manager][spatial][raycast]") {
+    auto backend = GENERATE(SpatialIndexType::Grid, SpatialIndexType::HashedGrid, SpatialIndexType::AABBTree,
+                            SpatialIndexType::HierarchicalGrid);
+    SceneManager scene(1.0, 1e-6, backend);
+    scene.setCollisionDetectionEnabled(false);
+    
+    auto addAt = [&](const Point3D& position) {
+        auto object = createTestObject();
+        object->setTransform(Transform3D(position));
+        return scene.addObject(std::move(object));
+    };
+    
+    // Unit cubes along the x axis, plus one off to the side
+    auto near = addAt(Point3D(2.0, 0.0, 0.0));
+    auto middle = addAt(Point3D(5.0, 0.0, 0.0));
+    auto far = addAt(Point3D(-9.0, 0.0, 0.0));
+    auto aside = addAt(Point3D(5.0, 4.0, 0.0));
+    
+    SECTION("Nearest hit") {
+        auto hit = scene.raycast(Point3D(0.0, 0.0, 0.0), Vector3D(1.0, 0.0, 0.0));
+        REQUIRE(hit.has_value());
+        REQUIRE(hit->objectId == near);
+        REQUIRE(hit->distance == Approx(1.5));
+        REQUIRE(hit->point.x == Approx(1.5));
+        
+        auto backwards = scene.raycast(Point3D(0.0, 0.0, 0.0), Vector3D(-2.0, 0.0, 0.0));
+        REQUIRE(backwards.has_value());
+        REQUIRE(backwards->objectId == far);
+        REQUIRE(backwards->distance == Approx(8.5));
+    }
+    
+    SECTION("Max distance and misses") {
+        REQUIRE_FALSE(scene.raycast(Point3D(0.0, 0.0, 0.0), Vector3D(1.0, 0.0, 0.0), 1.0).has_value());
+        REQUIRE_FALSE(scene.raycast(Point3D(0.0, 0.0, 0.0), Vector3D(0.0, 0.0, 1.0)).has_value());
+        REQUIRE_FALSE(scene.raycast(Point3D(0.0, 0.0, 0.0), Vector3D(0.0, 0.0, 0.0)).has_value());
+    }
+    
+    SECTION("All hits sorted by distance") {
+        auto hits = scene.raycastAll(Point3D(-20.0, 0.0, 0.0), Vector3D(1.0, 0.0, 0.0));
+        REQUIRE(hits.size() == 3);
+        REQUIRE(hits[0].objectId == far);
+        REQUIRE(hits[1].objectId == near);
+        REQUIRE(hits[2].objectId == middle);
+        REQUIRE(hits[2].distance == Approx(24.5));
+    }
+    
+    SECTION("Diagonal ray through empty cells") {
+        auto hit = scene.raycast(Point3D(0.0, -0.8, 0.2), Vector3D(1.0, 1.0, 0.0));
+        REQUIRE(hit.has_value());
+        REQUIRE(hit->objectId == aside);
+    }
+    
+    SECTION("Hits follow moved objects") {
+        scene.moveObject(near, Transform3D(Point3D(2.0, 10.0, 0.0)));
+        
+        auto hit = scene.raycast(Point3D(0.0, 0.0, 0.0), Vector3D(1.0, 0.0, 0.0));
+        REQUIRE(hit.has_value());
+        REQUIRE(hit->objectId == middle);
+    }
+    
+    SECTION("Frustum query") {
+        // Box-shaped frustum around x in [1, 6], y in [-1, 1], z in [-1, 1]
+        Frustum frustum({
+            Plane(Vector3D(1.0, 0.0, 0.0), -1.0), Plane(Vector3D(-1.0, 0.0, 0.0), 6.0),
+            Plane(Vector3D(0.0, 1.0, 0.0), 1.0), Plane(Vector3D(0.0, -1.0, 0.0), 1.0),
+            Plane(Vector3D(0.0, 0.0, 1.0), 1.0), Plane(Vector3D(0.0, 0.0, -1.0), 1.0)
+        });
+        
+        auto visible = scene.queryFrustum(frustum);
+        std::sort(visible.begin(), visible.end());
+        std::vector<ObjectId> expected = {near, middle};
+        std::sort(expected.begin(), expected.end());
+        REQUIRE(visible == expected);
+    }
+}
+
+TEST_CASE("SceneManager - Nearest objects", "[scene][manager][spatial][knn]") {
+    auto backend = GENERATE(SpatialIndexType::Grid, SpatialIndexType::HashedGrid, SpatialIndexType::AABBTree,
+                            SpatialIndexType::HierarchicalGrid);
+    SceneManager scene(1.0, 1e-6, backend);
+    scene.setCollisionDetectionEnabled(false);
+    
+    // Scene bounds are the unit cube under the object transform
+    std::map<ObjectId, BoundingBox> boundsById;
+    auto addAt = [&](const Point3D& position, const Vector3D& scale = Vector3D(1.0, 1.0, 1.0)) {
+        auto object = createTestObject();
+        Transform3D transform(position, Vector3D(), scale);
+        object->setTransform(transform);
+        ObjectId id = scene.addObject(std::move(object));
+        boundsById[id] = BoundingBox(Point3D(-0.5, -0.5, -0.5), Point3D(0.5, 0.5, 0.5)).transformed(transform);
+        return id;
+    };
+    
+    SECTION("Distance is measured to bounds, not centres") {
+        // A 20 m long wall whose centre is far away but whose end is close
+        auto wall = addAt(Point3D(12.0, 0.0, 0.0), Vector3D(20.0, 0.2, 1.0));
+        auto cabinet = addAt(Point3D(0.0, 3.0, 0.0));
+        
+        auto nearest = scene.findNearestObjects(Point3D(0.0, 0.0, 0.0), 2);
+        REQUIRE(nearest == std::vector<ObjectId>{wall, cabinet});
+        
+        REQUIRE(scene.findNearestObjects(Point3D(0.0, 0.0, 0.0), 5, 1.0) == std::vector<ObjectId>{});
+        REQUIRE(scene.findNearestObjects(Point3D(0.0, 2.6, 0.0), 5, 1.0) == std::vector<ObjectId>{cabinet});
+        REQUIRE(scene.findNearestObjects(Point3D(0.0, 0.0, 0.0), 0).empty());
+    }
+    
+    SECTION("Matches a brute-force search") {
+        std::mt19937 rng(7);
+        std::uniform_real_distribution<double> position(-30.0, 30.0);
+        std::uniform_real_distribution<double> size(0.2, 3.0);
+        
+        for (int i = 0; i < 300; ++i) {
+            addAt(Point3D(position(rng), position(rng), position(rng) * 0.1),
+                  Vector3D(size(rng), size(rng), size(rng)));
+        }
+        
+        for (int query = 0; query < 20; ++query) {
+            Point3D point(position(rng) * 1.5, position(rng) * 1.5, position(rng) * 0.2);
+            
+            std::vector<double> expected;
+            for (const auto& [id, bounds] : boundsById) {
+                expected.push_back(bounds.distanceTo(point));
+            }
+            std::sort(expected.begin(), expected.end());
+            
+            auto nearest = scene.findNearestObjects(point, 5);
+            REQUIRE(nearest.size() == 5);
+            for (size_t i = 0; i < nearest.size(); ++i) {
+                REQUIRE(boundsById[nearest[i]].distanceTo(point) == Approx(expected[i]));
+            }
+            
+            // Uncapped, as snapping asks: everything within the distance
+            auto withinReach = scene.findNearestObjects(point, std::numeric_limits<size_t>::max(), 4.0);
+            REQUIRE(withinReach.size() == static_cast<size_t>(std::count_if(expected.begin(), expected.end(),
+                                                                             [](double d) { return d <= 4.0; })));
+        }
+    }
+}
+
+TEST_CASE("SceneManager - Swept collision", "[scene][manager][collision][sweep]") {
+    SceneManager scene;
+    
+    auto addAt = [&](const Point3D& position, const Vector3D& scale = Vector3D(1.0, 1.0, 1.0)) {
+        auto object = createTestObject();
+        object->setTransform(Transform3D(position, Vector3D(), scale));
+        return scene.addObject(std::move(object));
+    };
+    
+    // A thin wall spanning x 4.9 to 5.1, and a unit cabinet at the origin
+    auto wall = addAt(Point3D(5.0, 0.0, 0.0), Vector3D(0.2, 4.0, 2.0));
+    auto cabinet = addAt(Point3D(0.0, 0.0, 0.0));
+    
+    SECTION("A fast move stops at the wall instead of tunnelling") {
+        Transform3D from(Point3D(0.0, 0.0, 0.0));
+        Transform3D to(Point3D(10.0, 0.0, 0.0));
+        REQUIRE_FALSE(scene.checkCollision(cabinet, to));
+        
+        SweepResult sweep = scene.checkSweptCollision(cabinet, from, to);
+        REQUIRE(sweep.collided);
+        REQUIRE(sweep.blockingObject == wall);
+        REQUIRE(sweep.timeOfImpact == Approx(0.44));
+        REQUIRE(sweep.transform.translation.x == Approx(4.4));
+        REQUIRE(sweep.transform.translation.x < 4.4 - scene.getCollisionTolerance());
+        
+        // The clamped transform is one the scene accepts
+        REQUIRE_FALSE(scene.checkCollision(cabinet, sweep.transform));
+        REQUIRE(scene.moveObject(cabinet, sweep.transform));
+        
+        // Pushing on into the wall goes nowhere, sliding along it is free
+        SweepResult further = scene.checkSweptCollision(cabinet, sweep.transform, Transform3D(Point3D(6.0, 0.0, 0.0)));
+        REQUIRE(further.collided);
+        REQUIRE(further.timeOfImpact == Approx(0.0).margin(1e-5));
+        
+        Transform3D along = sweep.transform;
+        along.translation.y = 3.0;
+        REQUIRE_FALSE(scene.checkSweptCollision(cabinet, sweep.transform, along).collided);
+    }
+    
+    SECTION("Unobstructed moves reach the target") {
+        Transform3D to(Point3D(0.0, 3.0, 0.0), Vector3D(0.0, 0.0, 0.5));
+        SweepResult sweep = scene.checkSweptCollision(cabinet, Transform3D(Point3D(0.0, 0.0, 0.0)), to);
+        REQUIRE_FALSE(sweep.collided);
+        REQUIRE(sweep.timeOfImpact == Approx(1.0));
+        REQUIRE(sweep.transform == to);
+    }
+    
+    SECTION("Moves ending in contact stop short of it, as checkCollision counts contact") {
+        Transform3D flush(Point3D(4.4, 0.0, 0.0));
+        REQUIRE(scene.checkCollision(cabinet, flush));
+        
+        SweepResult sweep = scene.checkSweptCollision(cabinet, Transform3D(Point3D(0.0, 0.0, 0.0)), flush);
+        REQUIRE(sweep.collided);
+        REQUIRE(sweep.timeOfImpact < 1.0);
+        REQUIRE_FALSE(scene.checkCollision(cabinet, sweep.transform));
+    }
+    
+    SECTION("Objects overlapping at the start do not block dragging free") {
+        scene.setCollisionDetectionEnabled(false);
+        auto overlapping = addAt(Point3D(0.5, 0.0, 0.0));
+        scene.setCollisionDetectionEnabled(true);
+        
+        SweepResult sweep = scene.checkSweptCollision(overlapping, Transform3D(Point3D(0.5, 0.0, 0.0)),
+                                                      Transform3D(Point3D(0.5, -3.0, 0.0)));
+        REQUIRE_FALSE(sweep.collided);
+    }
+    
+    SECTION("Disabled collision detection never clamps") {
+        scene.setCollisionDetectionEnabled(false);
+        SweepResult sweep = scene.checkSweptCollision(cabinet, Transform3D(Point3D(0.0, 0.0, 0.0)),
+                                                      Transform3D(Point3D(10.0, 0.0, 0.0)));
+        REQUIRE_FALSE(sweep.collided);
+        REQUIRE(sweep.transform.translation.x == Approx(10.0));
+    }
+}
+
+TEST_CASE("SceneManager - Type and category indexes", "[scene][manager][attributes]") {
+    SceneManager scene;
+    scene.setCollisionDetectionEnabled(false);
+    
+    auto base1 = scene.addObject(createTestObject("base_60"));
+    auto base2 = scene.addObject(createTestObject("base_60"));
+    auto tall = scene.addObject(createTestObject("tall_60"));
+    auto wall = scene.addObject(createTestObject("wall_80"));
+    
+    auto sorted = [](std::vector<ObjectId> ids) {
+        std::sort(ids.begin(), ids.end());
+        return ids;
+    };
+    
+    SECTION("Catalog items and default types") {
+        REQUIRE(sorted(scene.getObjectsByCatalogItem("base_60")) == sorted({base1, base2}));
+        REQUIRE(scene.getObjectsOfType("tall_60") == std::vector<ObjectId>{tall});
+        REQUIRE(scene.countObjectsByCatalogItem("base_60") == 2);
+        REQUIRE(scene.countObjectsByCatalogItem("missing") == 0);
+        REQUIRE(scene.getObjectsByCategory("base_cabinets").empty());
+    }
+    
+    SECTION("Resolver classifies by catalog category") {
+        scene.setClassificationResolver([](const SceneObject& object) {
+            const std::string& item = object.getCatalogItemId();
+            std::string category = item.rfind("wall", 0) == 0 ? "wall_cabinets"
+                                 : item.rfind("tall", 0) == 0 ? "tall_cabinets" : "base_cabinets";
+            return SceneManager::ObjectClassification{"cabinet", category};
+        });
+        
+        REQUIRE(scene.countObjectsOfType("cabinet") == 4);
+        REQUIRE(scene.countObjectsOfType("base_60") == 0);
+        REQUIRE(sorted(scene.getObjectsByCategory("base_cabinets")) == sorted({base1, base2}));
+        REQUIRE(scene.getObjectsByCategory("wall_cabinets") == std::vector<ObjectId>{wall});
+        
+        auto stats = scene.getStatistics();
+        REQUIRE(stats.objectsByType["cabinet"] == 4);
+        REQUIRE(stats.objectsByCategory["tall_cabinets"] == 1);
+    }
+    
+    SECTION("Indexes follow removal and catalog item changes") {
+        scene.removeObject(base1);
+        REQUIRE(scene.getObjectsByCatalogItem("base_60") == std::vector<ObjectId>{base2});
+        
+        // Indexes update when the edit is applied, not on a later move
+        scene.modifyObject(base2, [](SceneObject& object) { object.setCatalogItemId("wall_80"); });
+        REQUIRE(scene.countObjectsByCatalogItem("base_60") == 0);
+        REQUIRE(sorted(scene.getObjectsByCatalogItem("wall_80")) == sorted({wall, base2}));
+        REQUIRE(sorted(scene.getObjectsOfType("wall_80")) == sorted({wall, base2}));
+        
+        auto stats = scene.getStatistics();
+        REQUIRE(stats.objectsByType.count("base_60") == 0);
+        REQUIRE(stats.objectsByType["wall_80"] == 2);
+        
+        scene.clear();
+        REQUIRE(scene.countObjectsOfType("wall_80") == 0);
+    }
+}
+
+TEST_CASE("PartitionedSceneManager - Partitions and cross-partition queries", "[scene][manager][partition]") {
+    // 2 m regions: a unit cabinet at x 1.5 and another at x 3.0 land in neighbouring partitions
+    PartitionedSceneManager scene(2.0);
+    
+    auto addAt = [&](const Point3D& position) {
+        auto object = createTestObject();
+        object->setTransform(Transform3D(position));
+        return scene.addObject(std::move(object));
+    };
+    
+    auto left = addAt(Point3D(1.5, 0.0, 0.0));
+    auto right = addAt(Point3D(3.0, 0.0, 0.0));
+    auto far = addAt(Point3D(20.0, 0.0, 0.0));
+    
+    SECTION("Objects are assigned by region and stay there") {
+        REQUIRE(scene.getObjectCount() == 3);
+        REQUIRE(scene.getPartitionCount() == 3);
+        REQUIRE(scene.getPartitionOf(left) != scene.getPartitionOf(right));
+        REQUIRE_FALSE(scene.getPartitionOf("missing").has_value());
+        
+        auto partition = scene.getPartitionOf(left);
+        REQUIRE(scene.translateObject(left, Vector3D(-5.0, 0.0, 0.0)));
+        REQUIRE(scene.getPartitionOf(left) == partition);
+        REQUIRE(scene.getPartition(*partition)->getObjectCount() == 1);
+    }
+    
+    SECTION("Scaling multiplies the current scale") {
+        REQUIRE(scene.scaleObject(far, Vector3D(0.5, 0.5, 0.5)));
+        REQUIRE(scene.scaleObject(far, Vector3D(0.5, 1.0, 2.0)));
+        
+        Vector3D scale = scene.getObject(far)->getTransform().scale;
+        REQUIRE(scale.x == Approx(0.25));
+        REQUIRE(scale.y == Approx(0.5));
+        REQUIRE(scale.z == Approx(1.0));
+    }
+    
+    SECTION("Collisions are checked against neighbouring partitions") {
+        REQUIRE(scene.checkCollision(left, Transform3D(Point3D(2.4, 0.0, 0.0))));
+        REQUIRE_FALSE(scene.moveObject(left, Transform3D(Point3D(2.4, 0.0, 0.0))));
+        REQUIRE(scene.getObject(left)->getTransform().translation.x == Approx(1.5));
+        REQUIRE(scene.translateObject(left, Vector3D(0.2, 0.0, 0.0)));
+        
+        SweepResult sweep = scene.checkSweptCollision(left, Transform3D(Point3D(1.5, 0.0, 0.0)),
+                                                      Transform3D(Point3D(6.0, 0.0, 0.0)));
+        REQUIRE(sweep.collided);
+        REQUIRE(sweep.blockingObject == right);
+        REQUIRE(sweep.transform.translation.x == Approx(1.5 + 4.5 * sweep.timeOfImpact));
+        REQUIRE(sweep.transform.translation.x <= Approx(2.0));
+    }
+    
+    SECTION("Intersecting, nearby and nearest objects span partitions") {
+        scene.setCollisionDetectionEnabled(false);
+        REQUIRE(scene.moveObject(left, Transform3D(Point3D(2.6, 0.0, 0.0))));
+        REQUIRE(scene.findIntersectingObjects(left) == std::vector<ObjectId>{right});
+        REQUIRE(scene.findNearbyObjects(right, 2.0) == std::vector<ObjectId>{left});
+        
+        REQUIRE(scene.findNearestObjects(Point3D(4.0, 0.0, 0.0), 1) == std::vector<ObjectId>{right});
+        REQUIRE(scene.findNearestObjects(Point3D(19.0, 0.0, 0.0), 2) == std::vector<ObjectId>{far, right});
+        REQUIRE(scene.findNearestObjects(Point3D(10.0, 0.0, 0.0), 3, 1.0).empty());
+    }
+    
+    SECTION("Region queries only visit overlapping partitions") {
+        BoundingBox region(Point3D(2.2, -1.0, -1.0), Point3D(4.0, 1.0, 1.0));
+        REQUIRE(scene.getPartitionsInRegion(region) == std::vector<PartitionedSceneManager::PartitionId>{
+            *scene.getPartitionOf(right)});
+        REQUIRE(scene.getObjectsInRegion(region) == std::vector<ObjectId>{right});
+        REQUIRE(scene.getSceneBounds().max.x == Approx(20.5));
+    }
+    
+    SECTION("Batch moves across partitions are all or nothing") {
+        // The right cabinet takes the left one's place as the left one moves away
+        std::vector<ObjectTransform> swap = {{left, Transform3D(Point3D(-1.0, 0.0, 0.0))},
+                                             {right, Transform3D(Point3D(1.5, 0.0, 0.0))}};
+        REQUIRE(scene.applyTransforms(swap));
+        REQUIRE(scene.getObject(right)->getTransform().translation.x == Approx(1.5));
+        
+        std::vector<ObjectTransform> blocked = {{left, Transform3D(Point3D(-3.0, 0.0, 0.0))},
+                                                {right, Transform3D(Point3D(20.2, 0.0, 0.0))}};
+        REQUIRE_FALSE(scene.applyTransforms(blocked));
+        REQUIRE(scene.getObject(left)->getTransform().translation.x == Approx(-1.0));
+        
+        // Members in different partitions may not end up on top of each other
+        std::vector<ObjectTransform> stacked = {{left, Transform3D(Point3D(10.0, 0.0, 0.0))},
+                                                {right, Transform3D(Point3D(10.2, 0.0, 0.0))}};
+        REQUIRE_FALSE(scene.applyTransforms(stacked));
+        REQUIRE(scene.getObject(left)->getTransform().translation.x == Approx(-1.0));
+        REQUIRE(scene.getObject(right)->getTransform().translation.x == Approx(1.5));
+    }
+    
+    SECTION("Selection and notifications span partitions") {
+        std::vector<ObjectId> lastSelection;
+        int removed = 0;
+        scene.setSelectionChangedCallback([&](const std::vector<ObjectId>& selection) { lastSelection = selection; });
+        scene.setObjectRemovedCallback([&](const ObjectId&) { ++removed; });
+        
+        scene.setSelection({left, far, "missing"});
+        REQUIRE(scene.getSelection().size() == 2);
+        
+        REQUIRE(scene.removeObject(far));
+        REQUIRE(lastSelection == std::vector<ObjectId>{left});
+        REQUIRE(removed == 1);
+        
+        // Partitions created later pick up the callbacks too
+        auto added = addAt(Point3D(-9.0, 0.0, 0.0));
+        REQUIRE(scene.removeObject(added));
+        REQUIRE(removed == 2);
+        
+        scene.clear();
+        REQUIRE(scene.isEmpty());
+        REQUIRE(scene.getPartitionCount() == 0);
+        REQUIRE(lastSelection.empty());
+    }
+}
+
+TEST_CASE("PartitionedSceneManager - Custom partitioner and concurrent edits", "[scene][manager][partition][threading]") {
+    // One partition per room, read from the catalog item the object was placed with
+    PartitionedSceneManager scene([](const SceneObject& object) {
+        return static_cast<PartitionedSceneManager::PartitionId>(object.getCatalogItemId() == "island" ? 1 : 0);
+    });
+    
+    constexpr int kObjectsPerRoom = 8;
+    std::vector<ObjectId> ids;
+    for (int i = 0; i < kObjectsPerRoom * 2; ++i) {
+        auto object = createTestObject(i % 2 == 0 ? "island" : "base");
+        object->setTransform(Transform3D(Point3D(i * 2.0, 0.0, 0.0)));
+        ids.push_back(scene.addObject(std::move(object)));
+    }
+    
+    REQUIRE(scene.getPartitionCount() == 2);
+    REQUIRE(scene.getPartition(1)->getObjectCount() == kObjectsPerRoom);
+    REQUIRE(scene.getPartition(2) == nullptr);
+    
+    // Every object moves up in small steps from its own thread
+    constexpr int kSteps = 50;
+    std::vector<std::thread> threads;
+    std::atomic<int> failures{0};
+    for (const auto& id : ids) {
+        threads.emplace_back([&scene, &failures, id]() {
+            for (int step = 0; step < kSteps; ++step) {
+                if (!scene.translateObject(id, Vector3D(0.0, 0.1, 0.0))) {
+                    ++failures;
+                }
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    
+    REQUIRE(failures == 0);
+    for (const auto& id : ids) {
+        REQUIRE(scene.getObject(id)->getTransform().translation.y == Approx(kSteps * 0.1));
+    }
+}
+
+TEST_CASE("createSceneManager - Partitions large projects", "[scene][manager][partition]") {
+    auto small = createSceneManager(kPartitionedSceneObjectThreshold - 1);
+    REQUIRE(dynamic_cast<SceneManager*>(small.get()) != nullptr);
+    
+    auto large = createSceneManager(kPartitionedSceneObjectThreshold);
+    REQUIRE(dynamic_cast<PartitionedSceneManager*>(large.get()) != nullptr);
 }
\ No newline at end of file